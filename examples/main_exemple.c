@@ -26,15 +26,17 @@
  * ========================================================================= */
 
 /* Get current SNTP time (seconds + fractional part) */
-static void app_get_sntp_time(uint32_t *pulseconds, uint32_t *pulfraction)
+static int8_t app_get_sntp_time(uint32_t *pulseconds, uint32_t *pulfraction)
 {
     /* Provide current local time if available (optional) */
     *pulseconds  = 0;
     *pulfraction = 0;
+
+    return 0;
 }
 
-/* Get current Unix timestamp (seconds) */
-static uint32_t app_get_unix_timestamp(void)
+/* Get current Unix timestamp (microseconds) */
+static uint64_t app_get_unix_timestamp(void)
 {
     /* Return current system Unix time if RTC is already set */
     return 0;
@@ -70,6 +72,7 @@ void app_sntp_init(void)
 {
     sntp_ud_t ret;
     SlNetSock_Addr_t serverAddr;
+    InterfaceIndex_t interface;
 
     /* Initialize SNTP client */
     ret = sntpex_clientInitialization(&g_sntp_client, &g_ud_vtable);
@@ -80,7 +83,8 @@ void app_sntp_init(void)
     }
 
     /* Resolve NTP server hostname */
-    ret = sntpex_resolve_server(
+    ret = sntpex_dns_host_by_name_get(
+            &interface,
             "pool.ntp.org",
             &serverAddr,
             SLNETSOCK_AF_INET
@@ -111,9 +115,10 @@ void app_sntp_init(void)
  * This function MUST be called from the SimpleLink internal
  * Spawn task context (for example inside _SlInternalSpawn()).
  */
-void SimpleLinkSpawnHook(void)
+void SimpleLinkSpawnHook(int16_t sd, uint8_t event)
 {
-    sntpex_eventTriggingFromISR();
+    /* event: exlibSNTP_SOFTSR_RECV_BIT on a reception, exlibSNTP_SOFTSR_SEND_BIT on a transmission */
+    sntpex_eventTriggingFromISR(sd, event);
 }
 
 /* =========================================================================
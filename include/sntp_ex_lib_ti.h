@@ -37,22 +37,7 @@
 #include <ti/net/slnetsock.h>   /* socket APIs file */
 #include <ti/net/slnetutils.h>  /* net utility APIs file */
 #include <ti/net/slneterr.h>    /* specific error type and status file */
-
-/* Lib configurations ------------------------------------------------------------*/
-
-/**
- * @brief  Non blocking Timeout option, so timeout mecanism is handled on the @ref sntp_ex_ti_lib file
- *  Keep pooling until the return status is different from @ref SLNETERR_BSD_EAGAIN and timeout is not occured.
- * @remark Comment this line, to use the internal socket timeout which is configured on @ref p_client->sock->descriptor.timeout */
-#define exlibSNTP_CLIENT_USE_NONBLOCKING_TIMEOUT_OPTION
-/**
- * @brief  Default client timeout.
- * @remark This timeout will be used when application ignore the call of @ref sntpex_SetClientTimeout APIs. */
-#define exlibSNTP_CLIENT_DEFAULT_TIMEOUT 3000 
-/**
- * @brief  Define the maximum size of the packet NTP/SNTP time message
- * @remark includes 20 bytes for optional authentication data. */
-#define exlibSNTP_TIME_MESSAGE_MAX_SIZE  68
+#include "sntpex_config.h"       /* lib configurations file */
 
 /* Private macros ----------------------------------------------------------------*/
 
@@ -62,6 +47,19 @@
 /* socket poll-out event option */
 #define exlibPOLLOUT_EVENT              (1u << 0)
 
+/* NTP server UDP port */
+#define exlibSNTP_SERVER_PORT           (123u)
+
+/* maximum length of a cached server name, including the null terminator */
+#define exlibSNTP_DNS_HOSTNAME_MAX      (64u)
+
+/* number of words of a cached address, an IPV6 address needs four words */
+#if ( exlibSNTP_CONFIG_IPV6 == 1 )
+  #define exlibSNTP_DNS_ADDRESS_WORDS   (4u)
+#else
+  #define exlibSNTP_DNS_ADDRESS_WORDS   (1u)
+#endif
+
 /* number of seconds between 1900 and 1970 (MSB=1)*/
 #define exlibDIFF_SEC_1900_1970         (2208988800) 
 
@@ -80,15 +78,54 @@
  * order to network order(Big endian) */
 #define exlibSLNETUTIL_HTONS( ulvalue ) SlNetUtil_htons( ulvalue )
 
+/* Kiss-of-Death codes, four-character ASCII strings (RFC 4330 section 8) */
+#define exlibSNTP_KOD_RATE                         ( 0x52415445u ) /* "RATE" */
+#define exlibSNTP_KOD_DENY                         ( 0x44454E59u ) /* "DENY" */
+#define exlibSNTP_KOD_RSTR                         ( 0x52535452u ) /* "RSTR" */
+
+/* Client option bit mask definition */
+#define exlibSNTP_CLIENT_OPT_STEP_MODE             ( 1u << 0 ) /* request driven by @ref sntpex_client_step */
+#define exlibSNTP_CLIENT_OPT_PERSISTENT_SOCKET     ( 1u << 1 ) /* socket kept opened across sync cycles   */
+#define exlibSNTP_CLIENT_OPT_BROADCAST             ( 1u << 2 ) /* socket bound to the NTP port, listen mode */
+#define exlibSNTP_CLIENT_OPT_RESPONDER             ( 1u << 3 ) /* socket bound to the NTP port, server mode */
+
+/* Responder definition */
+#define exlibSNTP_RESPONDER_MAX_STRATUM            ( 15u )      /* highest synchronized stratum (RFC 5905)          */
+#define exlibSNTP_RESPONDER_PHI_PPM                ( 15u )      /* frequency tolerance added to the root dispersion */
+
 /**
- * @brief UD config protection */
-#ifndef exlibSNTP_CLIENT_DEFAULT_TIMEOUT
-#define exlibSNTP_CLIENT_DEFAULT_TIMEOUT  3000
-#endif
+ * @brief Time message header size and field offsets (RFC 4330 section 4), used by the codec @ref sntpex_packet_decode */
+#define exlibSNTP_PACKET_HEADER_SIZE               ( 48u )
+#define exlibSNTP_PKT_OFFSET_FLAGS                 ( 0u  ) /* LI, VN and Mode */
+#define exlibSNTP_PKT_OFFSET_STRATUM               ( 1u  )
+#define exlibSNTP_PKT_OFFSET_POLL                  ( 2u  )
+#define exlibSNTP_PKT_OFFSET_PRECISION             ( 3u  )
+#define exlibSNTP_PKT_OFFSET_ROOT_DELAY            ( 4u  )
+#define exlibSNTP_PKT_OFFSET_ROOT_DISP             ( 8u  )
+#define exlibSNTP_PKT_OFFSET_REF_ID                ( 12u )
+#define exlibSNTP_PKT_OFFSET_REF_TS                ( 16u )
+#define exlibSNTP_PKT_OFFSET_ORIG_TS               ( 24u )
+#define exlibSNTP_PKT_OFFSET_RECV_TS               ( 32u )
+#define exlibSNTP_PKT_OFFSET_XMIT_TS               ( 40u )
 
-#ifndef exlibSNTP_TIME_MESSAGE_MAX_SIZE
-#define exlibSNTP_TIME_MESSAGE_MAX_SIZE   68
-#endif
+/**
+ * @brief Authentication data sizes (RFC 5905 section 7.3), following the header */
+#define exlibSNTP_AUTH_KEY_ID_SIZE                 ( 4u  )
+#define exlibSNTP_AUTH_MAC_MAX_SIZE                ( 20u ) /* SHA1 digest */
+#define exlibSNTP_AUTH_KEY_MAX_SIZE                ( 20u )
+
+/**
+ * @brief Extension field sizes (RFC 7822 section 7.5), a field is a multiple of 4 bytes */
+#define exlibSNTP_EXT_FIELD_MIN_SIZE               ( 16u )
+#define exlibSNTP_EXT_FIELD_LAST_MIN_SIZE          ( 28u ) /* last field of a packet without MAC */
+
+/**
+ * @brief Saved state record identification, @ref sntpex_client_state_save */
+#define exlibSNTP_PERSIST_MAGIC                    ( 0x534E5450u ) /* "SNTP" */
+#define exlibSNTP_PERSIST_VERSION                  ( 3u )
+
+/* Statistics definition, one status counter per @ref sntp_ud_t code */
+#define exlibSNTP_STATS_STATUS_COUNT               ( ( uint8_t )SNTPEX_ERR_PERSIST + 1u )
 
 /* Event bit mask definition */
 #define exlibSNTP_SOFTSR_RECV_BIT                  ( 1u << 0 )
@@ -97,10 +134,27 @@
 /* event function pointer type definition */
 typedef void( * pf_eventCallback )( uint8_t eventFiled );
 
-/* sntpex event structure */
+/* sntpex event slot, one per Spawn event */
+struct xSntpEventSlot_t
+{
+  uint64_t  timestamp;     /* 64-UNIX Time captured on the event, used for T1 or T4 timestamp */
+  uint8_t   type;          /* @ref exlibSNTP_SOFTSR_RECV_BIT or @ref exlibSNTP_SOFTSR_SEND_BIT     */
+  uint8_t   epoch;         /* arming epoch of the event type, stale events are discarded       */
+};
+
+/**
+ * @brief  sntpex event structure
+ * @remark Single-producer single-consumer ring : the Spawn task only writes the slots and @ref head ,
+ *         the client task only writes @ref tail , the event flags and the epochs. No field is
+ *         read-modify-written by both sides, so the Spawn path needs no critical section. */
 struct ux_sntpAsynchEvent
 {
-  uint64_t  timestamp;  /* 64-UNIX Time used for T1 and T4 timestamp */
+  struct xSntpEventSlot_t slot[ exlibSNTP_EVENT_RING_SIZE ];
+  uint32_t  head;          /* next slot written by the Spawn task                    */
+  uint32_t  tail;          /* next slot read by the client task                      */
+  uint32_t  dropped;       /* events lost on a full ring, written by the Spawn task  */
+  uint8_t   rx_epoch;      /* receive arming epoch, increased on every disarm        */
+  uint8_t   tx_epoch;      /* send arming epoch, increased on every disarm           */
 
   pf_eventCallback event_cb;
   /**
@@ -134,6 +188,10 @@ typedef enum
   SNTPEX_ERR_REQUEST_REJECTED, /* NTP request rejected.                        */
   SNTPEX_ERR_INVALID_MESSAGE,  /* Invalid NTP message received.                */
   SNTPEX_ERR_TIMEOUT,          /* Timeout occured in RX/TX.                    */
+  SNTPEX_PENDING,              /* Request in progress, call the step APIs again. */
+  SNTPEX_ERR_UNSYNCHRONIZED,   /* Server not synchronized (LI=3 or stratum 16+). */
+  SNTPEX_ERR_AUTH,             /* Authentication failed (MAC, key or crypto-NAK). */
+  SNTPEX_ERR_PERSIST,          /* No valid saved state, or storage error.       */
 } sntp_ud_t;
 
 /**
@@ -146,6 +204,26 @@ enum
   specNTP_VERSION_V4  = 4,
 };
 
+/**
+ * @brief Symmetric-key authentication algorithm */
+typedef enum
+{
+  SNTPEX_AUTH_NONE     = 0, /* No authentication.                      */
+  SNTPEX_AUTH_MD5      = 1, /* MD5( key || header ), 16 bytes MAC.     */
+  SNTPEX_AUTH_SHA1     = 2, /* SHA1( key || header ), 20 bytes MAC.    */
+  SNTPEX_AUTH_AES_CMAC = 3, /* AES-128-CMAC( key, header ), 16 bytes MAC (RFC 8573). */
+} sntpex_auth_type_t;
+
+/**
+ * @brief SNTP Leap Indicator enumeration */
+enum
+{
+  specNTP_LI_NO_WARNING    = 0,
+  specNTP_LI_LAST_MIN_61   = 1,
+  specNTP_LI_LAST_MIN_59   = 2,
+  specNTP_LI_ALARM         = 3,
+};
+
 /**
  * @brief SNTP Mode enumeration */
 enum
@@ -173,6 +251,17 @@ enum
   specNTP_STRATUM_RESERVED_HI   = 255,
 } ;
 
+/**
+ * @brief Source of the receive timestamp (T4), from the most to the least accurate */
+typedef enum
+{
+  SNTPEX_TS_SOURCE_NONE      = 0, /* No timestamp captured yet.                                     */
+  SNTPEX_TS_SOURCE_DRIVER    = 1, /* Driver facility, @ref get_rx_timestamp vtable API.             */
+  SNTPEX_TS_SOURCE_HOST_IRQ  = 2, /* Host IRQ capture, @ref sntpex_rx_timestamp_capture_from_irq.   */
+  SNTPEX_TS_SOURCE_SPAWN     = 3, /* Spawn task event, @ref sntpex_eventTriggingFromISR.            */
+  SNTPEX_TS_SOURCE_LOCAL     = 4, /* Local time read after the reception.                          */
+} sntpex_ts_source_t;
+
 /**
  * @brief state machine enumeration */
 typedef enum
@@ -204,6 +293,21 @@ typedef union
   };
 }NtpTimestamp ;
 
+/**
+ * @brief Server header fields of a reply, the root delay and dispersion are converted from 16.16 fixed-point */
+struct xSntpServerInfo_t
+{
+  uint8_t      li;                   /* Leap Indicator, @ref specNTP_LI_ALARM when not synchronized. */
+  uint8_t      vn;                   /* Version Number.                                              */
+  uint8_t      mode;                 /* Mode, server (4) or broadcast (5).                           */
+  uint8_t      stratum;              /* Server stratum, 0 for a kiss-of-death reply.                 */
+  uint8_t      poll;                 /* Server poll exponent.                                        */
+  int8_t       precision;            /* Server clock precision exponent, 2^precision seconds.        */
+  uint32_t     rootDelay;            /* Round-trip delay of the server to the reference clock, in us. */
+  uint32_t     rootDispersion;       /* Maximum error of the server relative to the reference, in us. */
+  uint32_t     referenceId;          /* Reference identifier (ASCII source or IPV4 address), kiss code. */
+};
+
 /**
  * @brief NTP timestamp list */
 struct xTimestampCtx_t
@@ -218,16 +322,91 @@ struct xTimestampCtx_t
   uint64_t     receive64_ts;         /* 64-UNIX Time at which the server received the Client request in a server time message.     */
   uint64_t     transmit64_ts;        /* 64-UNIX Time at which the server transmitted its reply to the Client in a server time message
                                         (or the time client request was sent in the client request message).  */
+  struct xSntpServerInfo_t server;   /* Server header fields of the reply, used by the servers selection.  */
+};
+
+/**
+ * @brief Clock sample, computed from T1,T2,T3 and T4 (RFC 4330 section 5)
+ *        offset = ((T2 - T1) + (T3 - T4)) / 2 , delay = (T4 - T1) - (T3 - T2) */
+struct xSntpSample_t
+{
+  int64_t      offset;               /* Clock offset (theta) in us, server time minus local time.    */
+  int64_t      delay;                /* Round-trip delay (delta) in us.                              */
+  uint64_t     epoch;                /* 64-UNIX local time (T4) at which the sample is taken.        */
+};
+
+/**
+ * @brief Clock filter, ring of the recent samples */
+struct xSntpFilter_t
+{
+  struct xSntpSample_t samples[ exlibSNTP_FILTER_SIZE ]; /* recent samples ring.                     */
+  uint8_t      head;                 /* index of the next sample to be written.                      */
+  uint8_t      count;                /* number of valid samples.                                     */
+  int64_t      jitter;               /* RMS offset difference with the minimum-delay sample, in us.  */
+};
+
+/**
+ * @brief Clock discipline state */
+typedef enum
+{
+  SNTPEX_DISCIPLINE_UNSET = 0,  /* No sample yet, the local clock is used without correction. */
+  SNTPEX_DISCIPLINE_FREQ  = 1,  /* Phase set, waiting for the first frequency measurement.    */
+  SNTPEX_DISCIPLINE_SYNC  = 2,  /* Phase and frequency are disciplined.                       */
+} sntpex_discipline_state_t;
+
+/**
+ * @brief Clock discipline, correction applied on top of the raw local clock
+ *        disciplined time = raw time + phase + freq * elapsed + slewed part of the residual */
+struct xSntpDiscipline_t
+{
+  int64_t      phase;                /* Phase correction at the last update, in us.                  */
+  int64_t      residual;             /* Offset still to be slewed since the last update, in us.      */
+  int64_t      freq;                 /* Frequency correction, in ppb.                                */
+  uint64_t     lastUpdate;           /* Raw local 64-UNIX time of the last update.                   */
+  int64_t      refOffset;            /* Offset of the frequency measurement reference, in us.        */
+  uint64_t     refEpoch;             /* Raw local 64-UNIX time of the frequency reference.           */
+  sntpex_discipline_state_t state;
+};
+
+/**
+ * @brief Poll scheduler, the next request is due @ref interval ms after @ref lastRequest */
+struct xSntpPoll_t
+{
+  uint8_t      minExponent;          /* Minimum poll exponent.                                       */
+  uint8_t      maxExponent;          /* Maximum poll exponent.                                       */
+  uint8_t      exponent;             /* Current poll exponent, sent on the request poll field.       */
+  int8_t       counter;              /* Hysteresis counter of the good and bad predictions.          */
+  uint8_t      backoff;              /* Kiss-of-Death backoff, added to the current exponent.        */
+  uint8_t      failures;             /* Number of consecutive lost requests.                         */
+  uint8_t      serverPoll;           /* Poll exponent of the last reply.                             */
+  int64_t      lastFreq;             /* Frequency correction at the last update, in ppb.             */
+  uint32_t     lastRequest;          /* os tick of the last completed request, in ms.                */
+  uint32_t     interval;             /* Interval until the next request, in ms.                      */
 };
 
 /**
  * @brief Interface index type redirect */
 typedef uint16_t InterfaceIndex_t;
 
+/**
+ * @brief Server name resolution, cached until @ref exlibSNTP_DNS_CACHE_TTL expires */
+struct xSntpDnsEntry_t
+{
+  char             hostname[ exlibSNTP_DNS_HOSTNAME_MAX ]; /* resolved server name.                  */
+  uint8_t          family;           /* address family (IPV4/IPV6).                                  */
+  uint8_t          count;            /* number of resolved addresses, 0 when the entry is free.      */
+  uint8_t          rotation;         /* first address used by the next servers list.                 */
+  InterfaceIndex_t interface;        /* interface used for the resolution.                           */
+  uint32_t         resolvedTick;     /* os tick of the resolution, in ms.                            */
+  uint32_t         address[ exlibSNTP_DNS_MAX_ADDRESSES ][ exlibSNTP_DNS_ADDRESS_WORDS ]; /* host order, V4 uses the first word. */
+};
+
 /**
  * @brief SNTP Header (as specified in RFC 4330)
  * SNTP Time Message structure.  The Client only uses the flags field and the transmit_time_stamp field
- * in time requests it sends to its time server. */
+ * in time requests it sends to its time server.
+ * @remark Kept for the applications using the legacy layout, the library itself parses and serialises the
+ *         time message with @ref sntpex_packet_decode and @ref sntpex_packet_encode . */
 __packed struct x_sntp_request
 {
 
@@ -259,6 +438,202 @@ __packed struct x_sntp_request
 	NtpTimestamp transmitTimestamp;  /* Field 40-47 */
 };
 
+/**
+ * @brief SNTP Header decoded view, all the fields are in host order.
+ * @remark Filled by @ref sntpex_packet_decode from the raw time message, independent from the
+ *         compiler bitfield layout and from the buffer alignment. */
+struct xSntpPacket_t
+{
+  uint8_t      li;                 /* Leap Indicator                  */
+  uint8_t      vn;                 /* Version Number                  */
+  uint8_t      mode;               /* Mode                            */
+  uint8_t      stratum;            /* Stratum                         */
+  uint8_t      poll;               /* Poll interval exponent          */
+  int8_t       precision;          /* Precision exponent              */
+  uint32_t     rootDelay;          /* Root delay, 16.16 fixed-point   */
+  uint32_t     rootDispersion;     /* Root dispersion, 16.16 fixed-point */
+  uint32_t     referenceId;        /* Reference identifier / kiss code */
+  NtpTimestamp referenceTimestamp;
+  NtpTimestamp originateTimestamp;
+  NtpTimestamp receiveTimestamp;
+  NtpTimestamp transmitTimestamp;
+};
+
+/**
+ * @brief Fields following the header of a time message, located by @ref sntpex_packet_trailer_parse .
+ * @remark The offsets are relative to the start of the time message. */
+struct xSntpTrailer_t
+{
+  uint8_t      extCount;           /* number of extension fields.                          */
+  uint16_t     extLength;          /* total length of the extension fields.                */
+  uint16_t     macOffset;          /* offset of the Key Identifier, 0 when there is no MAC. */
+  uint8_t      macLength;          /* MAC length, 0 for a crypto-NAK.                      */
+  uint32_t     keyId;              /* Key Identifier of the MAC.                           */
+};
+
+/**
+ * @brief Local clock quality advertised by the responder mode, derived from the upstream client
+ *        by @ref sntpex_client_responder_step . */
+struct xSntpResponderInfo_t
+{
+  uint8_t      li;                 /* Leap Indicator, @ref specNTP_LI_ALARM when not synchronized.  */
+  uint8_t      stratum;            /* upstream server stratum + 1, @ref specNTP_STRATUM_UNSYNC when not synchronized. */
+  int8_t       precision;          /* local clock precision exponent.                             */
+  uint32_t     rootDelay;          /* Root delay to the reference clock, in us.                   */
+  uint32_t     rootDispersion;     /* Root dispersion to the reference clock, in us.              */
+  uint32_t     referenceId;        /* Reference identifier of the upstream server.                */
+  uint64_t     reference64_ts;     /* 64-UNIX disciplined time of the last clock update.          */
+};
+
+/**
+ * @brief Header of the saved state record, followed by the client state sections and the CRC-32 */
+struct xSntpPersistHeader_t
+{
+  uint32_t     magic;              /* @ref exlibSNTP_PERSIST_MAGIC .                        */
+  uint16_t     version;            /* @ref exlibSNTP_PERSIST_VERSION .                      */
+  uint16_t     length;             /* length of the sections, depends on the configuration. */
+  uint64_t     savedTime;          /* raw local 64-UNIX time of the save.                   */
+  uint32_t     savedTick;          /* os tick of the save, in ms.                           */
+  uint32_t     clockEpoch;         /* run of the raw local clock, @ref get_clock_epoch .    */
+};
+
+/**
+ * @brief Symmetric key, validated once by @ref sntpex_client_auth_key_add */
+struct xSntpKey_t
+{
+  uint32_t     keyId;              /* Key Identifier, 0 is reserved for the crypto-NAK. */
+  uint8_t      type;               /* Algorithm @ref sntpex_auth_type_t.                */
+  uint8_t      length;             /* Key length in bytes.                              */
+  uint8_t      macSize;            /* MAC size of the algorithm in bytes.               */
+  uint8_t      key[ exlibSNTP_AUTH_KEY_MAX_SIZE ];
+};
+
+/**
+ * @brief Histogram of the statistics block, with log2 buckets (bucket 0 counts the null values) */
+struct xSntpHistogram_t
+{
+  uint32_t     bucket[ exlibSNTP_STATS_BUCKETS ]; /* bucket i counts the values of [ 2^(i-1), 2^i ). */
+  uint32_t     count;              /* number of values.                                    */
+  uint32_t     max;                /* greatest value.                                      */
+  uint64_t     sum;                /* sum of the values, the mean is sum / count.          */
+};
+
+/**
+ * @brief Statistics block of the client, updated by the task running the client */
+struct xSntpStats_t
+{
+  uint32_t     txEagain;           /* send attempts on a busy socket (SLNETERR_BSD_EAGAIN). */
+  uint32_t     rxEagain;           /* receive attempts without reply (SLNETERR_BSD_EAGAIN). */
+  uint32_t     status[ exlibSNTP_STATS_STATUS_COUNT ]; /* request status count, indexed by @ref sntp_ud_t. */
+  struct xSntpHistogram_t xState[ UD_SNTP_CLIENT_STATE_COMPLETE ]; /* state function duration, in ms. */
+  struct xSntpHistogram_t xRxLatency;  /* Spawn receive event to its consumption, in us. */
+  struct xSntpHistogram_t xDns;        /* server name resolution, in ms.                */
+};
+
+/**
+ * @brief Wrap-safe 64-bit extension of the 32-bit os tick, in ms
+ * @remark Must be updated at least once per wrap of the 32-bit tick (49.7 days). */
+struct xSntpTick64_t
+{
+  uint32_t     last;               /* last 32-bit tick read.                 */
+  uint32_t     high;               /* number of wraps of the 32-bit tick.    */
+};
+
+/**
+ * @brief Deadline of an in-flight request, linked on its slot of the timer wheel */
+struct xSntpTimer_t
+{
+  struct xSntpTimer_t * pxNext;    /* next timer of the slot.                              */
+  struct xSntpTimer_t * pxPrev;    /* previous timer of the slot, NULL for the first one.  */
+  uint64_t     deadline;           /* 64-bit tick of the expiry, in ms.                     */
+  void       * pvOwner;            /* client of the request.                                */
+  uint16_t     slot;               /* slot of the wheel the timer is linked on.             */
+  uint8_t      armed;              /* linked on the wheel when different from 0.            */
+};
+
+/**
+ * @brief Hashed timer wheel of the in-flight requests deadlines, shared by the clients run by one task
+ * @remark A timer is linked on the slot of its deadline, arming and disarming are O(1). The expiry only
+ *         visits the slots elapsed since the previous call. */
+struct xSntpTimerWheel_t
+{
+  struct xSntpTimer_t * apxSlot[ exlibSNTP_WHEEL_SLOTS ]; /* timers, hashed by their deadline. */
+  struct xSntpTick64_t  xTick;     /* 64-bit extension of the os tick.                  */
+  uint64_t     current;            /* first tick of the next slot to visit.             */
+  uint16_t     armedCount;         /* number of armed timers.                           */
+};
+
+/**
+ * @brief Timescale enumeration, used by the timescale conversions */
+typedef enum
+{
+  SNTPEX_TIMESCALE_UTC = 0,  /* UTC, 64-UNIX time in us, an inserted leap second repeats the last second. */
+  SNTPEX_TIMESCALE_TAI = 1,  /* TAI, us since 1970-01-01 00:00:00 TAI.                                 */
+  SNTPEX_TIMESCALE_GPS = 2,  /* GPS, us since the GPS epoch 1980-01-06 00:00:00 UTC (TAI - 19 s).        */
+} sntpex_timescale_t;
+
+/**
+ * @brief Leap second handling of the UTC time of the disciplined clock */
+typedef enum
+{
+  SNTPEX_LEAP_STEP  = 0,     /* The UTC time steps on the leap instant.                                  */
+  SNTPEX_LEAP_SMEAR = 1,     /* The leap second is smeared over @ref exlibSNTP_LEAP_SMEAR_WINDOW before the leap. */
+} sntpex_leap_mode_t;
+
+/**
+ * @brief Entry of the leap seconds table */
+struct xSntpLeapEntry_t
+{
+  uint32_t     utc;                /* UNIX seconds from which the offset applies, first second after the leap. */
+  int16_t      taiOffset;          /* TAI - UTC, in s.                                                         */
+};
+
+/**
+ * @brief Leap seconds table and scale of the disciplined clock
+ * @remark The entry in force on the clock and the next leap are cached, so the conversions of the clock
+ *         and of the recent timestamps are O(1). */
+struct xSntpTimescale_t
+{
+  struct xSntpLeapEntry_t entry[ exlibSNTP_LEAP_TABLE_SIZE ]; /* leap seconds table, in ascending order. */
+  uint8_t      count;              /* number of entries.                                                */
+  uint8_t      index;              /* entry in force on the disciplined clock.                          */
+  uint8_t      announced;          /* the last entry is announced by the Leap Indicator, not confirmed. */
+  uint8_t      mode;               /* leap second handling @ref sntpex_leap_mode_t.                     */
+  int8_t       nextDelta;          /* +1 for an inserted second, -1 for a deleted one, 0 without leap.  */
+  uint64_t     nextSwitch;         /* clock time of the next leap, 64-UNIX time in us on the clock scale. */
+};
+
+/**
+ * @brief Linear segment of the disciplined clock, time = raw + offset + ( ( raw - base ) * rate ) / 2^32
+ * @remark The rate in 2^-32 us per us avoids any division on the read, 1 ppb is about 4.3 units. */
+struct xSntpClockSegment_t
+{
+  uint64_t     base;               /* raw local 64-UNIX time of the segment start, in us.              */
+  int64_t      offset;             /* correction at the segment start, in us.                          */
+  int64_t      rate;               /* correction rate, in 2^-32 us per us.                             */
+};
+
+/**
+ * @brief Published snapshot of the clock discipline, read by @ref sntpex_now
+ * @remark The slew of the residual offset and the frequency correction make two segments, the second
+ *         one starts once the residual is slewed. Without correction its base is UINT64_MAX. */
+struct xSntpClockSnapshot_t
+{
+  struct xSntpClockSegment_t segment[ 2 ]; /* slewing segment, then the frequency only segment. */
+};
+
+/**
+ * @brief  Net address storage, large enough for every supported family (sockaddr_storage-like)
+ * @remark @ref SlNetSock_Addr_t only holds an IPV4 address, an IPV6 address copied with its size is truncated. */
+typedef union
+{
+  SlNetSock_Addr_t      sa;          /* generic view, family and SlNetSock APIs. */
+  SlNetSock_AddrIn_t    in;          /* IPV4 view.                               */
+#if ( exlibSNTP_CONFIG_IPV6 == 1 )
+  SlNetSock_AddrIn6_t   in6;         /* IPV6 view.                               */
+#endif
+} sntpex_sockaddr_t;
+
 /**
  * @brief  Virtual socket structure
  * @remark Contain the descriptor for simplelink socket used by the @ref sntp_ex_lib_ti module */
@@ -270,11 +645,25 @@ struct vsocket
     int16_t             type;        /* socket type.                */
     int16_t             protocol;    /* socket protocol.            */
     SlNetSock_Timeval_t timeout;     /* socket timeout value.       */
-    SlNetSock_Addr_t    SocketAddr;  /* socket net address context. */
+    sntpex_sockaddr_t   SocketAddr;  /* socket net address context. */
     uint16_t            InAddLength; /* socket net address length.  */
   }descriptor;
 
   int fd;  /* socket handle, (-1) is the initial value */
+
+  uint16_t         openFamily;     /* address family the opened socket is created with. */
+  InterfaceIndex_t openInterface;  /* interface the opened socket is created on.        */
+};
+
+/**
+ * @brief  Server entry
+ * @remark Used by the multi-server query engine, in order to match every reply to its server */
+struct x_sntpServer
+{
+  sntpex_sockaddr_t SocketAddr;       /* server net address context.                        */
+  uint16_t          InAddLength;      /* server net address length.                         */
+  NtpTimestamp      expected_orig_ts; /* originate nonce of the in-flight request.          */
+  uint32_t          kissCode;         /* last kiss code (KoD) returned by the server.       */
 };
 
 /**
@@ -291,31 +680,128 @@ struct ud_op_vtable
 
   /* get operating system tick in ms */
   uint32_t ( * get_os_tick )( void );
+
+  /* optional, suspend the calling task for the given ms (used as burst spacing), NULL when not available */
+  void     ( * delay_ms )( uint32_t ulDelay );
+
+  /* optional, driver level 64-UNIX receive time of the last datagram of the socket (SO_TIMESTAMP-like),
+     returns 0 when no timestamp is captured, NULL when not available */
+  uint64_t ( * get_rx_timestamp )( int sd );
+
+  /* optional, driver level 64-UNIX transmit time of the last datagram of the socket,
+     returns 0 when no timestamp is captured, NULL when not available */
+  uint64_t ( * get_tx_timestamp )( int sd );
+
+  /* optional, fill the buffer with true random bytes (e.g. CC32xx TRNG, SL_NETUTIL_TRUE_RANDOM),
+     returns 0 on success, NULL when not available (software generator used instead) */
+  int32_t  ( * get_random )( void * pvBuffer, uint16_t usLength );
+
+  /* optional, compute the MAC of the data with the crypto accelerator, digest( key || data ) for MD5/SHA1 and
+     CMAC( key, data ) for AES-CMAC. The MAC length is updated, returns 0 on success, NULL when not available */
+  int32_t  ( * compute_mac )( uint8_t ucType, const uint8_t * pucKey, uint8_t ucKeyLength,
+                              const uint8_t * pucData, uint16_t usLength, uint8_t * pucMac, uint8_t * pucMacLength );
+
+  /* optional, write and read the saved state record at the given offset of the storage (e.g. SimpleLink
+     sl_FsWrite / sl_FsRead), return 0 on success, NULL when not available */
+  int32_t  ( * nv_write )( uint32_t ulOffset, const void * pvData, uint16_t usLength );
+  int32_t  ( * nv_read  )( uint32_t ulOffset, void * pvData, uint16_t usLength );
+
+  /* optional, identifier of the current run of the raw local clock, changed whenever the clock restarts
+     (e.g. RTC domain reset counter kept in the hibernate memory), NULL when not available (the raw local
+     times are then never kept by the warm start) */
+  uint32_t ( * get_clock_epoch )( void );
 };
 
 /**
  * @brief  SNTP client handle
- * @remark User defined client will be runned with their specific handle, in order to manage multiple client */
-typedef struct
+ * @remark User defined client will be runned with their specific handle, in order to manage multiple client.
+ *         The socket and the event storage are owned by the handle, so each client is fully independent. */
+typedef struct xSntpClientHandle_t
 {
   struct vsocket    * sock;
+  struct vsocket      xSocket;      /* client socket storage, pointed by @ref sock once initialized. */
+  volatile struct ux_sntpAsynchEvent xAsynchEvent; /* client event context, filled from the Spawn task. */
   struct ud_op_vtable vtable_api;
   uint32_t            timeout;
-  InterfaceIndex_t    interface;
+  InterfaceIndex_t    interface;    /* interface of the next socket, 0 when the client is not bound. */
+  InterfaceIndex_t    xInterfaceList[ exlibSNTP_CLIENT_MAX_INTERFACES ]; /* bound interfaces, in failover order. */
+  uint8_t             ucInterfaceCount;  /* number of bound interfaces.       */
+  uint8_t             ucInterfaceActive; /* index of the interface in use.    */
   uint32_t            startTime;
   udSntpClientState   state;
   uint8_t             payload[ exlibSNTP_TIME_MESSAGE_MAX_SIZE ];
   size_t              payloadLen;
   uint32_t            kissCode;
+  uint8_t             options;          /* client option bit mask @ref exlibSNTP_CLIENT_OPT_STEP_MODE.   */
+  pf_eventCallback    pfEventNotify;    /* user callback executed from the Spawn task on RX event.  */
   struct xTimestampCtx_t * xTimestampList;
 
   /** Timestamp when the request was sent from client to server.
    *  This is used to check if the originated timestamp in the server
    *  reply matches the one in client request.
+   *  Both fields hold the 64-bit random nonce of the request, see @ref get_random vtable API.
    */
-  uint32_t             expected_orig_ts;
+  NtpTimestamp         expected_orig_ts;
+  uint64_t             ullNonceState;     /* software nonce generator state, used without @ref get_random. */
+
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+  struct x_sntpServer  xServerList[ exlibSNTP_CLIENT_MAX_SERVERS ]; /* configured servers list. */
+  uint8_t              ucServerCount;     /* number of configured servers.          */
+#endif
+
+#if ( exlibSNTP_CONFIG_FILTER == 1 )
+  struct xSntpFilter_t xFilter;           /* clock filter, fed by every successful request. */
+#else
+  struct xSntpSample_t xLastSample;       /* last sample, used as the filtered one.         */
+#endif
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 1 )
+  struct xSntpDiscipline_t xDiscipline;  /* clock discipline, fed by the clock filter.        */
+#endif
+#if ( exlibSNTP_CONFIG_POLL == 1 )
+  struct xSntpPoll_t   xPoll;             /* poll scheduler, updated by every completed request. */
+#endif
+#if ( exlibSNTP_CONFIG_DNS_CACHE == 1 )
+  struct xSntpDnsEntry_t xDnsCache[ exlibSNTP_DNS_CACHE_ENTRIES ]; /* server names cache. */
+#endif
+#if ( exlibSNTP_CONFIG_BROADCAST == 1 )
+  int64_t              llBroadcastDelay;  /* calibrated round-trip delay of the broadcast mode, in us. */
+#endif
+
+#if ( exlibSNTP_CONFIG_AUTH == 1 )
+  struct xSntpKey_t    xKeyTable[ exlibSNTP_AUTH_MAX_KEYS ]; /* symmetric keys table.            */
+  uint8_t              ucKeyCount;        /* number of keys.                                 */
+  const struct xSntpKey_t * pxActiveKey;  /* key of the requests and replies, NULL disables. */
+#endif
+
+  uint32_t             ulIrqArmSequence;  /* host IRQ capture sequence when armed or at the last datagram. */
+  uint64_t             aullRxEventTs[ exlibSNTP_EVENT_RING_SIZE ]; /* receive timestamps not consumed yet, oldest first. */
+  uint8_t              ucRxEventCount;    /* number of receive timestamps not consumed yet.  */
+  uint64_t             ullTxEventTs;      /* send timestamp of the last transmission.       */
+  sntpex_ts_source_t   xRxTimestampSource; /* source of the last receive timestamp (T4).   */
+
+#if ( exlibSNTP_CONFIG_RESPONDER == 1 )
+  struct xSntpServerInfo_t xSyncServer;   /* header fields of the server of the last sample.  */
+  uint32_t             ulSyncReferenceId; /* reference identifier of that server (RFC 5905 section 7.3). */
+  const struct xSntpClientHandle_t * pxUpstream; /* disciplined client, time source of the responder mode. */
+#endif
+
+#if ( exlibSNTP_CONFIG_STATS == 1 )
+  struct xSntpStats_t  xStats;            /* hot-path counters and latency histograms.        */
+#endif
+
+#if ( exlibSNTP_CONFIG_TIMER_WHEEL == 1 )
+  struct xSntpTimer_t  xTimer;            /* deadline of the request started on a timer wheel. */
+  struct xSntpTimerWheel_t * pxWheel;     /* timer wheel of the request, NULL when not started. */
+#endif
+
+#if ( exlibSNTP_CONFIG_TIMESCALE == 1 )
+  struct xSntpTimescale_t * pxTimescale;  /* leap seconds table of the clock, NULL when not attached. */
+#endif
 }sntpex_client_handle_t;
 
+/* request completion function pointer type definition, called by @ref sntpex_timer_wheel_poll */
+typedef void( * pf_requestCallback )( sntpex_client_handle_t * p_client, sntp_ud_t xStatus );
+
 /**
  * @brief local_state_api API structure
  */
@@ -331,6 +817,7 @@ struct local_state_api_t
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
  * @brief   Initialize the SNTP Client and set default configurations.
+ * @remark  A live client is deinitialized first, see @ref sntpex_client_deinitialization .
  * @param   p_client: Pointer to the sntp client handle
  *          This parameter can be a value of @ref sntpex_client_handle_t *.
  * @param   p_vtable_api: Pointer to the user defined virtual table APIs.
@@ -340,18 +827,77 @@ struct local_state_api_t
 sntp_ud_t sntpex_clientInitialization( sntpex_client_handle_t * p_client, struct ud_op_vtable * p_vtable_api );
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
- * @brief   Resolve NTP host name.
- * @param   p_client: Pointer to the sntp client handle
- *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @brief   Resolve NTP host name, the first returned address is used with the NTP port.
+ * @param   pxInterfaceIndex: Pointer to the interface used for the resolution.
+ *          This parameter can be a value of @ref InterfaceIndex_t *.
  * @param   pcHostname: Pointer to the NTP Host name server.
  *          This parameter can be a value of @ref const char *.
- * @param   pxhost_address: Pointer to net address structure.
+ * @param   pxhost_address: Pointer to net address structure, a @ref SlNetSock_AddrIn6_t storage is required for IPV6.
  *          This parameter can be a value of @ref SlNetSock_Addr_t *.
- * @param   pxhost_address: Address family (IPV4/IPV6).
+ * @param   Family: Address family (IPV4/IPV6).
  *          This parameter can be a value of @ref uint8_t.
  * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
  */
 sntp_ud_t sntpex_dns_host_by_name_get( InterfaceIndex_t * pxInterfaceIndex ,const char * pcHostname, SlNetSock_Addr_t * pxhost_address, uint8_t Family);
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   set the servers list from a server name, every resolved address becomes a server.
+ *          The resolution is cached, and the pool members are rotated on every call.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pcHostname: Pointer to the NTP Host name server.
+ *          This parameter can be a value of @ref const char *.
+ * @param   Family: Address family (IPV4/IPV6).
+ *          This parameter can be a value of @ref uint8_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_set_server_name( sntpex_client_handle_t *p_client, const char * pcHostname, uint8_t Family );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   resolve a server name, every returned address is saved in the entry.
+ * @param   pxEntry: Pointer to the cache entry.
+ *          This parameter can be a value of @ref struct xSntpDnsEntry_t *.
+ * @param   pcHostname: Pointer to the NTP Host name server.
+ *          This parameter can be a value of @ref const char *.
+ * @param   Family: Address family (IPV4/IPV6).
+ *          This parameter can be a value of @ref uint8_t.
+ * @param   ulNow: Current os tick in ms, used for the entry time-to-live.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_dns_resolve( struct xSntpDnsEntry_t * pxEntry, const char * pcHostname, uint8_t Family, uint32_t ulNow );
+#if ( exlibSNTP_CONFIG_DNS_CACHE == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   check whether an entry holds a valid resolution of the server name.
+ * @param   pxEntry: Pointer to the cache entry.
+ *          This parameter can be a value of @ref const struct xSntpDnsEntry_t *.
+ * @param   pcHostname: Pointer to the NTP Host name server.
+ *          This parameter can be a value of @ref const char *.
+ * @param   Family: Address family (IPV4/IPV6).
+ *          This parameter can be a value of @ref uint8_t.
+ * @param   ulNow: Current os tick in ms.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  1 when the entry matches and its time-to-live is not expired, 0 otherwise.
+ */
+uint8_t   sntpex_dns_entry_is_valid( const struct xSntpDnsEntry_t * pxEntry, const char * pcHostname, uint8_t Family, uint32_t ulNow );
+#endif
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   build the net address of one resolved address, with the NTP port.
+ * @param   pxEntry: Pointer to the cache entry.
+ *          This parameter can be a value of @ref const struct xSntpDnsEntry_t *.
+ * @param   ucIndex: Index of the resolved address.
+ *          This parameter can be a value of @ref uint8_t.
+ * @param   pxAddress: Pointer to the net address storage (@ref SlNetSock_AddrIn_t or @ref SlNetSock_AddrIn6_t).
+ *          This parameter can be a value of @ref void *.
+ * @param   usSize: Size of the net address storage.
+ *          This parameter can be a value of @ref uint16_t.
+ * @param   pusLength: Pointer to the net address length.
+ *          This parameter can be a value of @ref uint16_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_dns_address_get( const struct xSntpDnsEntry_t * pxEntry, uint8_t ucIndex, void * pxAddress, uint16_t usSize, uint16_t * pusLength );
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
  * @brief   set sntp client timeout value.
@@ -364,14 +910,33 @@ sntp_ud_t sntpex_dns_host_by_name_get( InterfaceIndex_t * pxInterfaceIndex ,cons
 sntp_ud_t sntpex_SetClientTimeout( sntpex_client_handle_t * p_client, uint32_t timeout);
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
- * @brief   bind client to interface.
+ * @brief   bind client to interface, the interfaces list is replaced by the given interface.
+ *          The socket is rebuilt on the new interface by the next request.
  * @param   p_client: Pointer to the sntp client handle
  *          This parameter can be a value of @ref sntpex_client_handle_t *.
- * @param   interface: Pointer to the interface.
+ * @param   interface: Pointer to the interface (SlNetIf identifier), NULL or 0 unbinds the client.
  *          This parameter can be a value of @ref InterfaceIndex_t *.
  * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
  */
 sntp_ud_t sntpex_client_bind_to_interface(sntpex_client_handle_t *p_client, InterfaceIndex_t *interface);
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   add a failover interface, used after the already bound ones.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   xInterface: Interface (SlNetIf identifier).
+ *          This parameter can be a value of @ref InterfaceIndex_t.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERR_FAULT_INIT when the interfaces list is full.
+ */
+sntp_ud_t sntpex_client_add_interface( sntpex_client_handle_t *p_client, InterfaceIndex_t xInterface );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the interface used by the next request.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  Interface (SlNetIf identifier), 0 when the client is not bound.
+ */
+InterfaceIndex_t sntpex_client_active_interface_get( sntpex_client_handle_t *p_client );
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
  * @brief   set server address and port.
@@ -382,6 +947,34 @@ sntp_ud_t sntpex_client_bind_to_interface(sntpex_client_handle_t *p_client, Inte
  * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
  */
 sntp_ud_t sntpex_client_set_server_address(sntpex_client_handle_t *p_client, const SlNetSock_Addr_t * serverIpAddr );
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   append a server to the servers list used by @ref sntpex_client_multi_timestamp_get.
+ *          All servers must share the address family of the first configured server.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   serverIpAddr: Pointer to the net address.
+ *          This parameter can be a value of @ref const SlNetSock_Addr_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_add_server_address(sntpex_client_handle_t *p_client, const SlNetSock_Addr_t * serverIpAddr );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get timestamp list of every configured server, in one round trip.
+ *          The requests are sent back-to-back on the client socket, then the replies are collected
+ *          with a single select-driven receive loop and matched to their server by the originate nonce.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pxTimestampCtx: Array of timestamp list, one entry per configured server.
+ *          This parameter can be a value of @ref struct xTimestampCtx_t *.
+ * @param   pxServerStatus: Array of status, one entry per configured server.
+ *          This parameter can be a value of @ref sntp_ud_t *.
+ * @retval  SNTPEX_SUCCESS if at least one server replied and a majority of the replies agrees,
+ *          SNTPEX_ERROR when no majority agrees (the round is discarded), A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_multi_timestamp_get( sntpex_client_handle_t *p_client, struct xTimestampCtx_t * pxTimestampCtx, sntp_ud_t * pxServerStatus );
+#endif
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
  * @brief   get timestamp list (format unix64/ format stime).
@@ -395,27 +988,894 @@ sntp_ud_t sntpex_client_set_server_address(sntpex_client_handle_t *p_client, con
 sntp_ud_t sntpex_client_timestamp_get( sntpex_client_handle_t *p_client, struct xTimestampCtx_t * xTimestampCtx );
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
- * @brief   get kiss of death code (KoD).
+ * @brief   get the lowest-delay timestamp list of a burst of requests (iburst-like).
+ *          The requests are sent over the opened client socket, every sample feeds the clock filter.
  * @param   p_client: Pointer to the sntp client handle
  *          This parameter can be a value of @ref sntpex_client_handle_t *.
- * @retval  KoD value, this parameter can be a value ofe @ref uint32_t.
+ * @param   xTimestampCtx: Pointer to timestamp list, filled with the lowest-delay sample.
+ *          This parameter can be a value of @ref struct xTimestampCtx_t *.
+ * @param   ucBurstCount: Number of requests of the burst.
+ *          This parameter can be a value of @ref uint8_t.
+ * @param   ulSpacing: Spacing between two requests in ms, applied with the @ref delay_ms vtable API.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  SNTPEX_SUCCESS if at least one request succeeded, A specific error type @ref sntp_ud_t otherwise.
  */
-uint32_t  sntpex_client_Kiss_code_get(sntpex_client_handle_t *p_client);
+sntp_ud_t sntpex_client_burst_timestamp_get( sntpex_client_handle_t *p_client, struct xTimestampCtx_t * xTimestampCtx, uint8_t ucBurstCount, uint32_t ulSpacing );
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
- * @brief   sntp client deinitialization.
+ * @brief   run one transition of the client state machine, without any busy-wait.
+ *          The first call starts a new request, T1,T2,T3 and T4 will be inserted to the passed list.
  * @param   p_client: Pointer to the sntp client handle
  *          This parameter can be a value of @ref sntpex_client_handle_t *.
- * @retval  None.
+ * @param   xTimestampCtx: Pointer to timestamp list.
+ *          This parameter can be a value of @ref struct xTimestampCtx_t *.
+ * @retval  SNTPEX_SUCCESS when the timestamp list is ready, SNTPEX_PENDING when the request is still
+ *          in progress, A specific error type @ref sntp_ud_t otherwise.
  */
-void      sntpex_client_deinitialization(sntpex_client_handle_t *p_client);
+sntp_ud_t sntpex_client_step( sntpex_client_handle_t *p_client, struct xTimestampCtx_t * xTimestampCtx );
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
- * @brief   Handle sntp events from ISR.
- * @param   None.
- * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ * @brief   run the client state machine until it would block on the socket.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   xTimestampCtx: Pointer to timestamp list.
+ *          This parameter can be a value of @ref struct xTimestampCtx_t *.
+ * @retval  SNTPEX_SUCCESS when the timestamp list is ready, SNTPEX_PENDING when the request is still
+ *          in progress, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_poll( sntpex_client_handle_t *p_client, struct xTimestampCtx_t * xTimestampCtx );
+#if ( exlibSNTP_CONFIG_IPV6 == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   race the requests of two clients, typically configured with the IPV6 and the IPV4 addresses of
+ *          the same pool (happy-eyeballs). The first reply wins, the request of the other client is cancelled.
+ * @param   p_client: Pointer to the sntp client handle, preferred family and owner of the clock.
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   p_alternate: Pointer to the sntp client handle of the other family.
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   xTimestampCtx: Pointer to timestamp list, filled with the winning reply.
+ *          This parameter can be a value of @ref struct xTimestampCtx_t *.
+ * @param   pucWinner: Pointer to the winning client, 0 for @ref p_client and 1 for @ref p_alternate, can be NULL.
+ *          This parameter can be a value of @ref uint8_t *.
+ * @retval  SNTPEX_SUCCESS if one client succeeded, the error status of @ref p_client otherwise.
+ */
+sntp_ud_t sntpex_client_dual_stack_timestamp_get( sntpex_client_handle_t *p_client, sntpex_client_handle_t *p_alternate,
+                                                  struct xTimestampCtx_t * xTimestampCtx, uint8_t * pucWinner );
+#endif
+#if ( exlibSNTP_CONFIG_TIMER_WHEEL == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   start a step mode request run by a timer wheel, its deadline is armed on the wheel.
+ *          The request is then stepped and expired by @ref sntpex_timer_wheel_poll , not by the application.
+ * @param   p_client: Pointer to the sntp client handle, registered by @ref sntpex_clientInitialization.
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pxWheel: Pointer to the timer wheel, initialized by @ref sntpex_timer_wheel_init.
+ *          This parameter can be a value of @ref struct xSntpTimerWheel_t *.
+ * @param   xTimestampCtx: Pointer to timestamp list, must stay valid until the request is completed.
+ *          This parameter can be a value of @ref struct xTimestampCtx_t *.
+ * @retval  SNTPEX_PENDING when the request is in flight, otherwise the status of the request completed
+ *          on the start (no completion callback is called), A specific error type @ref sntp_ud_t.
+ */
+sntp_ud_t sntpex_client_wheel_start( sntpex_client_handle_t *p_client, struct xSntpTimerWheel_t * pxWheel,
+                                     struct xTimestampCtx_t * xTimestampCtx );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   run the requests of a timer wheel : the clients with a pending Spawn event or a busy socket are
+ *          stepped, then the elapsed deadlines are expired. Every completed request is reported to the callback.
+ * @param   pxWheel: Pointer to the timer wheel.
+ *          This parameter can be a value of @ref struct xSntpTimerWheel_t *.
+ * @param   ulTick: Operating system tick in ms.
+ *          This parameter can be a value of @ref uint32_t.
+ * @param   cb: completion callback, can be NULL.
+ *          This parameter can be a value of @ref pf_requestCallback.
+ * @retval  number of requests completed by the call.
+ */
+uint8_t   sntpex_timer_wheel_poll( struct xSntpTimerWheel_t * pxWheel, uint32_t ulTick, pf_requestCallback cb );
+#endif
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   set the user callback executed from the Spawn task on RX event.
+ *          It can be used to wake up the task stepping the client @ref sntpex_client_step.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   cb: user callback, NULL to remove it.
+ *          This parameter can be a value of @ref pf_eventCallback.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_set_event_callback( sntpex_client_handle_t *p_client, pf_eventCallback cb );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   keep the client socket opened and configured across sync cycles.
+ *          The socket is only rebuilt on interface or address family change, or on socket error.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   enable: 1 to keep the socket opened, 0 to close it on every failed request.
+ *          This parameter can be a value of @ref uint8_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_set_persistent_socket( sntpex_client_handle_t *p_client, uint8_t enable );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get kiss of death code (KoD).
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  KoD value, this parameter can be a value ofe @ref uint32_t.
+ */
+uint32_t  sntpex_client_Kiss_code_get(sntpex_client_handle_t *p_client);
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   sntp client deinitialization.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  None.
+ */
+void      sntpex_client_deinitialization(sntpex_client_handle_t *p_client);
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   Handle sntp events from ISR, the event is given to the client which owns the socket.
+ * @param   sd: Socket descriptor of the event.
+ *          This parameter can be a value of @ref int16_t.
+ * @param   ucEvent: @ref exlibSNTP_SOFTSR_RECV_BIT on a datagram arrival, @ref exlibSNTP_SOFTSR_SEND_BIT on a transmission.
+ *          This parameter can be a value of @ref uint8_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_eventTriggingFromISR( int16_t sd, uint8_t ucEvent );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   capture the receive timestamp from the host IRQ (e.g. timer capture of the host interrupt line).
+ * @remark  The capture is preferred to the Spawn task timestamp, it does not include the Spawn queue latency.
+ *          It is only used when it is the single capture taken for the received datagram.
+ * @param   ullTimestamp: 64-UNIX time of the host interrupt.
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  None.
+ */
+void      sntpex_rx_timestamp_capture_from_irq( uint64_t ullTimestamp );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the source of the last receive timestamp (T4).
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  Timestamp source, this parameter can be a value of @ref sntpex_ts_source_t.
+ */
+sntpex_ts_source_t sntpex_client_rx_timestamp_source_get( sntpex_client_handle_t *p_client );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the filtered clock sample of the client (minimum-delay sample of the clock filter).
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pxSample: Pointer to the filtered sample.
+ *          This parameter can be a value of @ref struct xSntpSample_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_clock_offset_get( sntpex_client_handle_t *p_client, struct xSntpSample_t * pxSample );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   compute the clock offset and round-trip delay from the timestamp list.
+ * @param   xTimestampCtx: Pointer to timestamp list (T1,T2,T3 and T4).
+ *          This parameter can be a value of @ref const struct xTimestampCtx_t *.
+ * @param   pxSample: Pointer to the computed sample.
+ *          This parameter can be a value of @ref struct xSntpSample_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_sample_compute( const struct xTimestampCtx_t * xTimestampCtx, struct xSntpSample_t * pxSample );
+#if ( exlibSNTP_CONFIG_FILTER == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   clear the clock filter.
+ * @param   pxFilter: Pointer to the clock filter.
+ *          This parameter can be a value of @ref struct xSntpFilter_t *.
+ * @retval  None.
+ */
+void      sntpex_filter_reset( struct xSntpFilter_t * pxFilter );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   add a sample to the clock filter, the oldest sample is replaced when the ring is full.
+ * @param   pxFilter: Pointer to the clock filter.
+ *          This parameter can be a value of @ref struct xSntpFilter_t *.
+ * @param   pxSample: Pointer to the new sample.
+ *          This parameter can be a value of @ref const struct xSntpSample_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_filter_push( struct xSntpFilter_t * pxFilter, const struct xSntpSample_t * pxSample );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the minimum-delay sample of the clock filter.
+ * @param   pxFilter: Pointer to the clock filter.
+ *          This parameter can be a value of @ref const struct xSntpFilter_t *.
+ * @param   pxSample: Pointer to the filtered sample.
+ *          This parameter can be a value of @ref struct xSntpSample_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERROR when the filter is empty.
+ */
+sntp_ud_t sntpex_filter_best_get( const struct xSntpFilter_t * pxFilter, struct xSntpSample_t * pxSample );
+#endif
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   decode an NTP/SNTP time message into the host order view.
+ * @param   pucBuffer: Pointer to the received time message, no alignment is required.
+ *          This parameter can be a value of @ref const uint8_t *.
+ * @param   usLength: Length of the received time message.
+ *          This parameter can be a value of @ref uint16_t.
+ * @param   pxPacket: Pointer to the decoded view.
+ *          This parameter can be a value of @ref struct xSntpPacket_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_packet_decode( const uint8_t * pucBuffer, uint16_t usLength, struct xSntpPacket_t * pxPacket );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   encode the host order view into an NTP/SNTP time message.
+ * @param   pxPacket: Pointer to the host order view.
+ *          This parameter can be a value of @ref const struct xSntpPacket_t *.
+ * @param   pucBuffer: Pointer to the output buffer, no alignment is required.
+ *          This parameter can be a value of @ref uint8_t *.
+ * @param   usSize: Size of the output buffer.
+ *          This parameter can be a value of @ref uint16_t.
+ * @param   pusLength: Pointer to the encoded length.
+ *          This parameter can be a value of @ref uint16_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_packet_encode( const struct xSntpPacket_t * pxPacket, uint8_t * pucBuffer, uint16_t usSize, uint16_t * pusLength );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   locate the extension fields and the MAC following the header of a time message.
+ * @param   pucBuffer: Pointer to the received time message, no alignment is required.
+ *          This parameter can be a value of @ref const uint8_t *.
+ * @param   usLength: Length of the received time message.
+ *          This parameter can be a value of @ref uint16_t.
+ * @param   pxTrailer: Pointer to the located fields.
+ *          This parameter can be a value of @ref struct xSntpTrailer_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERR_INVALID_MESSAGE when the fields are malformed.
+ */
+sntp_ud_t sntpex_packet_trailer_parse( const uint8_t * pucBuffer, uint16_t usLength, struct xSntpTrailer_t * pxTrailer );
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the disciplined time of the client.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pullTime: Pointer to the disciplined 64-UNIX time in us.
+ *          This parameter can be a value of @ref uint64_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERROR when the clock is not disciplined yet (raw time is returned).
+ */
+sntp_ud_t sntpex_client_time_get( sntpex_client_handle_t *p_client, uint64_t * pullTime );
+#endif
+#if ( exlibSNTP_CONFIG_TIMESCALE == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   attach a leap seconds table to the disciplined clock. The Leap Indicator of the replies updates
+ *          the table, and the passed leaps are folded into the clock.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pxTimescale: Pointer to the timescale initialized by @ref sntpex_timescale_init , NULL to detach it.
+ *          This parameter can be a value of @ref struct xSntpTimescale_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_timescale_attach( sntpex_client_handle_t *p_client, struct xSntpTimescale_t * pxTimescale );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the disciplined time on a timescale, O(1). The UTC time is stepped or smeared on the leaps,
+ *          see @ref sntpex_leap_mode_t , the TAI and GPS times are continuous.
+ * @param   p_client: Pointer to the sntp client handle, with an attached timescale.
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   xScale: Timescale of the result.
+ *          This parameter can be a value of @ref sntpex_timescale_t.
+ * @param   pullTime: Pointer to the time in us, see @ref sntpex_timescale_t.
+ *          This parameter can be a value of @ref uint64_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERROR when the clock is not disciplined yet.
+ */
+sntp_ud_t sntpex_client_timescale_time_get( sntpex_client_handle_t *p_client, sntpex_timescale_t xScale, uint64_t * pullTime );
+#endif
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the estimated frequency error of the local clock.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  Frequency correction in ppb, 0 when it is not estimated yet.
+ */
+int32_t   sntpex_client_frequency_get( sntpex_client_handle_t *p_client );
+#endif
+#if ( exlibSNTP_CONFIG_POLL == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   set the poll exponents range of the client scheduler, the next request is due immediately.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   ucMinExponent: Minimum poll exponent (interval of 2^exponent seconds).
+ *          This parameter can be a value of @ref uint8_t.
+ * @param   ucMaxExponent: Maximum poll exponent, lower or equal to @ref exlibSNTP_POLL_KOD_MAX_EXPONENT .
+ *          This parameter can be a value of @ref uint8_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_set_poll_range( sntpex_client_handle_t *p_client, uint8_t ucMinExponent, uint8_t ucMaxExponent );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the time until the next request of the client is due, the MCU can sleep meanwhile.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  Time in ms, 0 when the request is due.
+ */
+uint32_t  sntpex_client_time_until_next_sync( sntpex_client_handle_t *p_client );
+#endif
+#if ( exlibSNTP_CONFIG_BROADCAST == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   calibrate the broadcast mode delay with one unicast exchange with the configured server.
+ *          Must be called before @ref sntpex_client_broadcast_listen .
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   xTimestampCtx: Pointer to timestamp list, filled by the unicast exchange.
+ *          This parameter can be a value of @ref struct xTimestampCtx_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_broadcast_calibrate( sntpex_client_handle_t *p_client, struct xTimestampCtx_t * xTimestampCtx );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   start the broadcast listen mode, the client socket is bound to the NTP port.
+ *          The request APIs are not available until @ref sntpex_client_broadcast_stop .
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pxGroup: Pointer to the IPV4 or IPV6 multicast group to join, NULL to only receive the IPV4 broadcasts.
+ *          This parameter can be a value of @ref const SlNetSock_Addr_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_broadcast_listen( sntpex_client_handle_t *p_client, const SlNetSock_Addr_t *pxGroup );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   handle the next received broadcast packet (mode 5), the socket is polled without waiting.
+ *          It can be called from the task woken up by @ref p_client->pfEventNotify .
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   xTimestampCtx: Pointer to timestamp list, T1 and T2 are synthesized from the calibrated delay.
+ *          This parameter can be a value of @ref struct xTimestampCtx_t *.
+ * @retval  SNTPEX_SUCCESS when the timestamp list is ready, SNTPEX_PENDING when no packet is received,
+ *          A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_broadcast_step( sntpex_client_handle_t *p_client, struct xTimestampCtx_t * xTimestampCtx );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   stop the broadcast listen mode, the listening socket is closed.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_broadcast_stop( sntpex_client_handle_t *p_client );
+#endif
+#if ( exlibSNTP_CONFIG_RESPONDER == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   start the responder mode, the socket of the responder client is bound to the NTP port and the
+ *          mode 3 requests are answered with the time of the upstream client.
+ *          The request APIs of the responder client are not available until @ref sntpex_client_responder_stop .
+ * @param   p_responder: Pointer to the sntp client handle answering the requests, initialized by @ref sntpex_clientInitialization .
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   p_upstream: Pointer to the sntp client handle disciplined by the upstream servers.
+ *          This parameter can be a value of @ref const sntpex_client_handle_t *.
+ * @param   Family: Address family (IPV4/IPV6) of the answered requests, one responder per family.
+ *          This parameter can be a value of @ref uint8_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_responder_start( sntpex_client_handle_t *p_responder, const sntpex_client_handle_t *p_upstream, uint8_t Family );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   answer the next received request, the socket is polled without waiting.
+ *          It can be called from the task woken up by @ref p_responder->pfEventNotify , until it returns SNTPEX_PENDING.
+ * @param   p_responder: Pointer to the sntp client handle answering the requests
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS when a reply is sent, SNTPEX_PENDING when no request is received,
+ *          A specific error type @ref sntp_ud_t otherwise (the request is dropped).
+ */
+sntp_ud_t sntpex_client_responder_step( sntpex_client_handle_t *p_responder );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   stop the responder mode, the listening socket is closed.
+ * @param   p_responder: Pointer to the sntp client handle answering the requests
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_responder_stop( sntpex_client_handle_t *p_responder );
+#endif
+#if ( exlibSNTP_CONFIG_AUTH == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   add (or replace) a symmetric key of the client key table.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   ulKeyId: Key Identifier, shared with the server (not 0).
+ *          This parameter can be a value of @ref uint32_t.
+ * @param   ucType: Authentication algorithm.
+ *          This parameter can be a value of @ref sntpex_auth_type_t.
+ * @param   pucKey: Pointer to the key material, copied into the table.
+ *          This parameter can be a value of @ref const uint8_t *.
+ * @param   ucKeyLength: Key length, up to @ref exlibSNTP_AUTH_KEY_MAX_SIZE (16 for AES-CMAC).
+ *          This parameter can be a value of @ref uint8_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_auth_key_add( sntpex_client_handle_t *p_client, uint32_t ulKeyId, uint8_t ucType,
+                                      const uint8_t * pucKey, uint8_t ucKeyLength );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   select the key authenticating the requests and the replies.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   ulKeyId: Key Identifier of a key of the table, 0 disables the authentication.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_auth_key_select( sntpex_client_handle_t *p_client, uint32_t ulKeyId );
+#endif
+#if ( exlibSNTP_CONFIG_PERSIST == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   save the clock state of the client, typically before entering the hibernate mode.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_state_save( sntpex_client_handle_t *p_client );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   restore the clock state saved by @ref sntpex_client_state_save , the next sync is due immediately.
+ *          Must be called after @ref sntpex_clientInitialization , before any request.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERR_PERSIST when no valid record is stored (cold start).
+ */
+sntp_ud_t sntpex_client_state_restore( sntpex_client_handle_t *p_client );
+#endif
+#if ( exlibSNTP_CONFIG_STATS == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get a copy of the statistics block of the client, optionally cleared once copied.
+ *          Must be called from the task running the client.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pxStats: Pointer to the statistics copy.
+ *          This parameter can be a value of @ref struct xSntpStats_t *.
+ * @param   ucReset: Clear the statistics block once copied, when different from 0.
+ *          This parameter can be a value of @ref uint8_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_stats_get( sntpex_client_handle_t *p_client, struct xSntpStats_t * pxStats, uint8_t ucReset );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   clear the statistics block of the client.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_client_stats_reset( sntpex_client_handle_t *p_client );
+#endif
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   discard the falsetickers of a multi-server request and combine the survivors.
+ * @param   pxTimestampCtx: Array of timestamp lists, one entry per server.
+ *          This parameter can be a value of @ref const struct xTimestampCtx_t *.
+ * @param   pxServerStatus: Array of request status, one entry per server.
+ *          This parameter can be a value of @ref const sntp_ud_t *.
+ * @param   ucCount: Number of servers, lower or equal to @ref exlibSNTP_CLIENT_MAX_SERVERS .
+ *          This parameter can be a value of @ref uint8_t.
+ * @param   pxResult: Pointer to the combined sample, the delay is the one of the closest survivor.
+ *          This parameter can be a value of @ref struct xSntpSample_t *.
+ * @param   pucSurvivors: Pointer to the survivors bit mask (bit i for server i), can be NULL.
+ *          This parameter can be a value of @ref uint8_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERROR when no majority of the servers agrees.
+ */
+sntp_ud_t sntpex_select_combine( const struct xTimestampCtx_t * pxTimestampCtx, const sntp_ud_t * pxServerStatus, uint8_t ucCount,
+                                 struct xSntpSample_t * pxResult, uint8_t * pucSurvivors );
+#endif
+#if ( exlibSNTP_CONFIG_AUTH == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the MAC size of an authentication algorithm.
+ * @param   ucType: Authentication algorithm.
+ *          This parameter can be a value of @ref sntpex_auth_type_t.
+ * @retval  MAC size in bytes, 0 when the algorithm is not supported.
+ */
+uint8_t   sntpex_auth_mac_size( uint8_t ucType );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   append the Key Identifier and the MAC to a serialized packet.
+ * @param   pxVtable: Pointer to the virtual table APIs, providing @ref compute_mac .
+ *          This parameter can be a value of @ref const struct ud_op_vtable *.
+ * @param   pxKey: Pointer to the key.
+ *          This parameter can be a value of @ref const struct xSntpKey_t *.
+ * @param   pucPacket: Pointer to the serialized packet.
+ *          This parameter can be a value of @ref uint8_t *.
+ * @param   usSize: Size of the packet buffer.
+ *          This parameter can be a value of @ref uint16_t.
+ * @param   pusLength: Pointer to the packet length, the authenticated length is returned.
+ *          This parameter can be a value of @ref uint16_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_auth_sign( const struct ud_op_vtable * pxVtable, const struct xSntpKey_t * pxKey,
+                            uint8_t * pucPacket, uint16_t usSize, uint16_t * pusLength );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   verify the Key Identifier and the MAC of a received packet, the MAC is compared in constant time.
+ * @param   pxVtable: Pointer to the virtual table APIs, providing @ref compute_mac .
+ *          This parameter can be a value of @ref const struct ud_op_vtable *.
+ * @param   pxKey: Pointer to the expected key.
+ *          This parameter can be a value of @ref const struct xSntpKey_t *.
+ * @param   pucPacket: Pointer to the received packet.
+ *          This parameter can be a value of @ref const uint8_t *.
+ * @param   usLength: Length of the received packet.
+ *          This parameter can be a value of @ref uint16_t.
+ * @retval  SNTPEX_SUCCESS if the packet is authentic, SNTPEX_ERR_AUTH otherwise (including crypto-NAK).
+ */
+sntp_ud_t sntpex_auth_verify( const struct ud_op_vtable * pxVtable, const struct xSntpKey_t * pxKey,
+                              const uint8_t * pucPacket, uint16_t usLength );
+#endif
+#if ( exlibSNTP_CONFIG_RESPONDER == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   compute the reference identifier of a server address (RFC 5905 section 7.3).
+ * @param   pxVtable: Pointer to the virtual table APIs, providing @ref compute_mac for the IPV6 hash.
+ *          This parameter can be a value of @ref const struct ud_op_vtable *.
+ * @param   pxAddress: Pointer to the server net address.
+ *          This parameter can be a value of @ref const SlNetSock_Addr_t *.
+ * @retval  IPV4 address or first 32 bits of the MD5 hash of the IPV6 address (host order), 0 when unknown.
+ */
+uint32_t  sntpex_responder_reference_id( const struct ud_op_vtable * pxVtable, const SlNetSock_Addr_t * pxAddress );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   derive the local clock quality advertised to the peers from the upstream client.
+ * @param   p_upstream: Pointer to the sntp client handle disciplined by the upstream servers.
+ *          This parameter can be a value of @ref const sntpex_client_handle_t *.
+ * @param   ullRawTime: Raw local 64-UNIX time in us.
+ *          This parameter can be a value of @ref uint64_t.
+ * @param   pxInfo: Pointer to the local clock quality.
+ *          This parameter can be a value of @ref struct xSntpResponderInfo_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_responder_info_get( const sntpex_client_handle_t * p_upstream, uint64_t ullRawTime, struct xSntpResponderInfo_t * pxInfo );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   build the reply (mode 4) of a decoded client request (mode 3).
+ * @param   pxRequest: Pointer to the decoded request.
+ *          This parameter can be a value of @ref const struct xSntpPacket_t *.
+ * @param   pxInfo: Pointer to the local clock quality.
+ *          This parameter can be a value of @ref const struct xSntpResponderInfo_t *.
+ * @param   ullReceiveTime: Disciplined 64-UNIX time in us at which the request is received (T2).
+ *          This parameter can be a value of @ref uint64_t.
+ * @param   ullTransmitTime: Disciplined 64-UNIX time in us at which the reply is sent (T3).
+ *          This parameter can be a value of @ref uint64_t.
+ * @param   pxReply: Pointer to the decoded reply.
+ *          This parameter can be a value of @ref struct xSntpPacket_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERR_INVALID_MESSAGE when the request is not a client request.
+ */
+sntp_ud_t sntpex_responder_reply_build( const struct xSntpPacket_t * pxRequest, const struct xSntpResponderInfo_t * pxInfo,
+                                        uint64_t ullReceiveTime, uint64_t ullTransmitTime, struct xSntpPacket_t * pxReply );
+#endif
+#if ( exlibSNTP_CONFIG_STATS == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   clear a statistics block.
+ * @param   pxStats: Pointer to the statistics block.
+ *          This parameter can be a value of @ref struct xSntpStats_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_stats_reset( struct xSntpStats_t * pxStats );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   add a value to a histogram, the bucket is given by the number of significant bits of the value.
+ * @param   pxHistogram: Pointer to the histogram.
+ *          This parameter can be a value of @ref struct xSntpHistogram_t *.
+ * @param   ulValue: Value to add.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  None.
+ */
+void      sntpex_stats_histogram_add( struct xSntpHistogram_t * pxHistogram, uint32_t ulValue );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   count the status of a completed request, an unknown code is counted as SNTPEX_ERROR.
+ * @param   pxStats: Pointer to the statistics block.
+ *          This parameter can be a value of @ref struct xSntpStats_t *.
+ * @param   xStatus: Status of the request.
+ *          This parameter can be a value of @ref sntp_ud_t.
+ * @retval  None.
+ */
+void      sntpex_stats_status_add( struct xSntpStats_t * pxStats, sntp_ud_t xStatus );
+#endif
+#if ( exlibSNTP_CONFIG_TIMER_WHEEL == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   extend a 32-bit os tick to 64 bits, a lower tick than the previous one is a wrap.
+ *          Must be called at least once per wrap of the 32-bit tick.
+ * @param   pxTick: Pointer to the tick extension.
+ *          This parameter can be a value of @ref struct xSntpTick64_t *.
+ * @param   ulTick: Operating system tick in ms.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  64-bit tick in ms, 0 when the tick extension is not valid.
+ */
+uint64_t  sntpex_tick64_update( struct xSntpTick64_t * pxTick, uint32_t ulTick );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   clear the timer wheel, no timer is armed.
+ * @param   pxWheel: Pointer to the timer wheel.
+ *          This parameter can be a value of @ref struct xSntpTimerWheel_t *.
+ * @param   ulTick: Operating system tick in ms, origin of the tick extension.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_timer_wheel_init( struct xSntpTimerWheel_t * pxWheel, uint32_t ulTick );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   arm a timer, an armed timer is moved to its new deadline.
+ * @param   pxWheel: Pointer to the timer wheel.
+ *          This parameter can be a value of @ref struct xSntpTimerWheel_t *.
+ * @param   pxTimer: Pointer to the timer, its owner is kept.
+ *          This parameter can be a value of @ref struct xSntpTimer_t *.
+ * @param   ullDeadline: 64-bit tick of the expiry in ms, see @ref sntpex_tick64_update.
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_timer_arm( struct xSntpTimerWheel_t * pxWheel, struct xSntpTimer_t * pxTimer, uint64_t ullDeadline );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   disarm a timer, nothing is done when the timer is not armed.
+ * @param   pxWheel: Pointer to the timer wheel.
+ *          This parameter can be a value of @ref struct xSntpTimerWheel_t *.
+ * @param   pxTimer: Pointer to the timer.
+ *          This parameter can be a value of @ref struct xSntpTimer_t *.
+ * @retval  None.
+ */
+void      sntpex_timer_disarm( struct xSntpTimerWheel_t * pxWheel, struct xSntpTimer_t * pxTimer );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   take one expired timer, the timer is disarmed. Call again until NULL is returned.
+ * @param   pxWheel: Pointer to the timer wheel.
+ *          This parameter can be a value of @ref struct xSntpTimerWheel_t *.
+ * @param   ullNow: Current 64-bit tick in ms, see @ref sntpex_tick64_update.
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  Pointer to the expired timer, NULL when no deadline is elapsed.
+ */
+struct xSntpTimer_t * sntpex_timer_expire( struct xSntpTimerWheel_t * pxWheel, uint64_t ullNow );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the time until the nearest deadline, used as the wait of the task running the wheel.
+ * @param   pxWheel: Pointer to the timer wheel.
+ *          This parameter can be a value of @ref const struct xSntpTimerWheel_t *.
+ * @param   ullNow: Current 64-bit tick in ms, see @ref sntpex_tick64_update.
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  time in ms until the nearest deadline, 0 when it is elapsed, 0xFFFFFFFF when no timer is armed.
+ */
+uint32_t  sntpex_timer_wait_get( const struct xSntpTimerWheel_t * pxWheel, uint64_t ullNow );
+#endif
+#if ( exlibSNTP_CONFIG_TIMESCALE == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   load the built-in leap seconds table, the clock is on the scale of its last entry.
+ * @param   pxTimescale: Pointer to the timescale.
+ *          This parameter can be a value of @ref struct xSntpTimescale_t *.
+ * @param   ucMode: Leap second handling of the UTC time.
+ *          This parameter can be a value of @ref sntpex_leap_mode_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_timescale_init( struct xSntpTimescale_t * pxTimescale, uint8_t ucMode );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   add or confirm an entry of the leap seconds table (e.g. from the IERS leap-seconds.list).
+ *          TAI - UTC must change by one second from the previous entry, and to the next one.
+ * @param   pxTimescale: Pointer to the timescale.
+ *          This parameter can be a value of @ref struct xSntpTimescale_t *.
+ * @param   ulUtc: UNIX seconds from which the offset applies, first second after the leap.
+ *          This parameter can be a value of @ref uint32_t.
+ * @param   sTaiOffset: TAI - UTC from that second, in s.
+ *          This parameter can be a value of @ref int16_t.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERROR when the entry is not consistent or the table is full.
+ */
+sntp_ud_t sntpex_timescale_leap_add( struct xSntpTimescale_t * pxTimescale, uint32_t ulUtc, int16_t sTaiOffset );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   update the timescale from the Leap Indicator of a reply and the disciplined clock.
+ *          An announced leap (LI 1 or 2) takes place at the end of the current UTC month, a reply without
+ *          warning (LI 0) withdraws an announcement which is not passed yet.
+ * @param   pxTimescale: Pointer to the timescale.
+ *          This parameter can be a value of @ref struct xSntpTimescale_t *.
+ * @param   ucLi: Leap Indicator of the reply, @ref specNTP_LI_ALARM is ignored.
+ *          This parameter can be a value of @ref uint8_t.
+ * @param   ullClock: Disciplined clock, 64-UNIX time in us, a passed leap is folded first (@ref sntpex_timescale_leap_fold).
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_timescale_update( struct xSntpTimescale_t * pxTimescale, uint8_t ucLi, uint64_t ullClock );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   move the clock to the scale of the passed leaps, the returned shift must be added to the clock.
+ * @param   pxTimescale: Pointer to the timescale.
+ *          This parameter can be a value of @ref struct xSntpTimescale_t *.
+ * @param   ullClock: Disciplined clock, 64-UNIX time in us on the current scale.
+ *          This parameter can be a value of @ref uint64_t.
+ * @param   pllShift: Pointer to the clock shift in us, -10^6 per inserted second, 0 when no leap is passed.
+ *          This parameter can be a value of @ref int64_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_timescale_leap_fold( struct xSntpTimescale_t * pxTimescale, uint64_t ullClock, int64_t * pllShift );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   convert the disciplined clock to a timescale, O(1). The UTC time of a passed leap which is not
+ *          folded yet is stepped or smeared, the TAI and GPS times are continuous.
+ * @param   pxTimescale: Pointer to the timescale.
+ *          This parameter can be a value of @ref const struct xSntpTimescale_t *.
+ * @param   ullClock: Disciplined clock, 64-UNIX time in us on the current scale.
+ *          This parameter can be a value of @ref uint64_t.
+ * @param   xScale: Timescale of the result.
+ *          This parameter can be a value of @ref sntpex_timescale_t.
+ * @retval  time in us on the timescale, see @ref sntpex_timescale_t , 0 when it is not valid.
+ */
+uint64_t sntpex_timescale_from_clock( const struct xSntpTimescale_t * pxTimescale, uint64_t ullClock, sntpex_timescale_t xScale );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   convert a timestamp between two timescales, O(1) for the timestamps of the entry in force.
+ * @param   pxTimescale: Pointer to the timescale.
+ *          This parameter can be a value of @ref const struct xSntpTimescale_t *.
+ * @param   xFrom: Timescale of the timestamp.
+ *          This parameter can be a value of @ref sntpex_timescale_t.
+ * @param   xTo: Timescale of the result.
+ *          This parameter can be a value of @ref sntpex_timescale_t.
+ * @param   ullTime: Timestamp in us, see @ref sntpex_timescale_t.
+ *          This parameter can be a value of @ref uint64_t.
+ * @param   pullTime: Pointer to the converted timestamp in us.
+ *          This parameter can be a value of @ref uint64_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERROR when the timestamp is before the GPS epoch.
+ */
+sntp_ud_t sntpex_timescale_convert( const struct xSntpTimescale_t * pxTimescale, sntpex_timescale_t xFrom, sntpex_timescale_t xTo,
+                                    uint64_t ullTime, uint64_t * pullTime );
+#endif
+#if ( exlibSNTP_CONFIG_FAST_NOW == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   select the client disciplining @ref sntpex_now , its discipline is published at once and on every update.
+ *          Must be called from the task running the client.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pfRawTime: Raw local 64-UNIX time in us, safe to call from the interrupts (e.g. high resolution
+ *          timer), on the time base of the @ref get_unix_timestamp vtable API. NULL uses the vtable API.
+ *          This parameter can be a value of @ref uint64_t ( * )( void ).
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_now_attach( sntpex_client_handle_t *p_client, uint64_t ( * pfRawTime )( void ) );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   release @ref sntpex_now from the client, it returns 0 until a client is attached again.
+ * @param   p_client: Pointer to the attached sntp client handle
+ *          This parameter can be a value of @ref const sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERROR when the client is not attached.
+ */
+sntp_ud_t sntpex_now_detach( const sntpex_client_handle_t *p_client );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   publish the clock discipline of the client to @ref sntpex_now , called by the library after every
+ *          discipline update. Must be called from the task running the client.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref const sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERROR when the client is not attached.
+ */
+sntp_ud_t sntpex_now_publish( const sntpex_client_handle_t *p_client );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the disciplined time of the attached client, wait-free and safe to call from the interrupts.
+ *          Within 3 us of @ref sntpex_client_time_get in the hours following an update, the raw time is returned
+ *          while the clock is not disciplined.
+ * @retval  Disciplined 64-UNIX time in us, 0 when no client is attached.
+ */
+uint64_t sntpex_now( void );
+#endif
+#if ( exlibSNTP_CONFIG_POLL == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   clear the poll scheduler, the next request is due immediately.
+ * @param   pxPoll: Pointer to the poll scheduler.
+ *          This parameter can be a value of @ref struct xSntpPoll_t *.
+ * @param   ucMinExponent: Minimum poll exponent (interval of 2^exponent seconds).
+ *          This parameter can be a value of @ref uint8_t.
+ * @param   ucMaxExponent: Maximum poll exponent, lower or equal to @ref exlibSNTP_POLL_KOD_MAX_EXPONENT .
+ *          This parameter can be a value of @ref uint8_t.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERROR when the range is not valid.
+ */
+sntp_ud_t sntpex_poll_reset( struct xSntpPoll_t * pxPoll, uint8_t ucMinExponent, uint8_t ucMaxExponent );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   schedule the next request from the result of the completed one.
+ * @param   pxPoll: Pointer to the poll scheduler.
+ *          This parameter can be a value of @ref struct xSntpPoll_t *.
+ * @param   xStatus: Status of the completed request.
+ *          This parameter can be a value of @ref sntp_ud_t.
+ * @param   ulKissCode: Kiss code of the reply, used when the status is @ref SNTPEX_ERR_REQUEST_REJECTED .
+ *          This parameter can be a value of @ref uint32_t.
+ * @param   llJitter: Jitter of the samples in us, @ref jitter of the clock filter (0 without the clock filter).
+ *          This parameter can be a value of @ref int64_t.
+ * @param   pxDiscipline: Pointer to the clock discipline (residual offset and frequency).
+ *          This parameter can be a value of @ref const struct xSntpDiscipline_t *.
+ * @param   ulNow: Current os tick in ms.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_poll_update( struct xSntpPoll_t * pxPoll, sntp_ud_t xStatus, uint32_t ulKissCode,
+                              int64_t llJitter, const struct xSntpDiscipline_t * pxDiscipline, uint32_t ulNow );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the time until the next request is due.
+ * @param   pxPoll: Pointer to the poll scheduler.
+ *          This parameter can be a value of @ref const struct xSntpPoll_t *.
+ * @param   ulNow: Current os tick in ms.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  Time in ms, 0 when the request is due.
+ */
+uint32_t  sntpex_poll_time_until_next( const struct xSntpPoll_t * pxPoll, uint32_t ulNow );
+#endif
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   clear the clock discipline, the local clock is used without correction.
+ * @param   pxDiscipline: Pointer to the clock discipline.
+ *          This parameter can be a value of @ref struct xSntpDiscipline_t *.
+ * @retval  None.
+ */
+void      sntpex_discipline_reset( struct xSntpDiscipline_t * pxDiscipline );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   update the clock discipline with a new clock sample.
+ *          An offset greater than @ref exlibSNTP_DISCIPLINE_STEP_THRESHOLD steps the time, a lower one is slewed.
+ * @param   pxDiscipline: Pointer to the clock discipline.
+ *          This parameter can be a value of @ref struct xSntpDiscipline_t *.
+ * @param   pxSample: Pointer to the clock sample, measured against the raw local clock.
+ *          This parameter can be a value of @ref const struct xSntpSample_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+sntp_ud_t sntpex_discipline_update( struct xSntpDiscipline_t * pxDiscipline, const struct xSntpSample_t * pxSample );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the disciplined time from the raw local time, the discipline is not modified.
+ * @param   pxDiscipline: Pointer to the clock discipline.
+ *          This parameter can be a value of @ref const struct xSntpDiscipline_t *.
+ * @param   ullRawTime: Raw local 64-UNIX time in us (@ref get_unix_timestamp vtable API).
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  Disciplined 64-UNIX time in us, the raw time when the discipline is not set.
+ */
+uint64_t  sntpex_discipline_time_get( const struct xSntpDiscipline_t * pxDiscipline, uint64_t ullRawTime );
+#endif
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   convert NTP timestamp (host order seconds, fraction) to 64-UNIX time in microseconds.
+ * @param   ulSeconds: NTP seconds.
+ *          This parameter can be a value of @ref uint32_t.
+ * @param   ulFraction: NTP fraction.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  unix-64 timestamp in microseconds, this parameter can be a value of @ref uint64_t.
+ */
+uint64_t  sntpex_ntp_to_unix64_us( uint32_t ulSeconds, uint32_t ulFraction );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   convert NTP timestamp (host order seconds, fraction) to 64-UNIX time in nanoseconds.
+ * @param   ulSeconds: NTP seconds.
+ *          This parameter can be a value of @ref uint32_t.
+ * @param   ulFraction: NTP fraction.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  unix-64 timestamp in nanoseconds, this parameter can be a value of @ref uint64_t.
+ */
+uint64_t  sntpex_ntp_to_unix64_ns( uint32_t ulSeconds, uint32_t ulFraction );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   convert NTP timestamp (host order seconds, fraction) to native NTP-64 format (32.32 fixed-point).
+ * @param   ulSeconds: NTP seconds.
+ *          This parameter can be a value of @ref uint32_t.
+ * @param   ulFraction: NTP fraction.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  NTP-64 value, this parameter can be a value of @ref uint64_t.
+ */
+uint64_t  sntpex_ntp_to_ntp64( uint32_t ulSeconds, uint32_t ulFraction );
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   convert 64-UNIX time in microseconds to NTP timestamp (host order seconds, fraction).
+ * @param   ullTime: unix-64 timestamp in microseconds.
+ *          This parameter can be a value of @ref uint64_t.
+ * @param   pxTimestamp: Pointer to the NTP timestamp, the era 1 (2036-2104) wraps the seconds.
+ *          This parameter can be a value of @ref NtpTimestamp *.
+ * @retval  None.
  */
-sntp_ud_t sntpex_eventTriggingFromISR( void );
+void      sntpex_unix64_us_to_ntp( uint64_t ullTime, NtpTimestamp * pxTimestamp );
 /**
  * @}
  */
@@ -0,0 +1,334 @@
+/**
+ * @file    sntpex_ti/sntpex_config.h
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Build configuration of the Extended SNTP library, features selection and sizing.
+ *
+ * @note    Every option keeps its default value unless it is defined by the build, e.g. the CMake options
+ *          of the sntpex_ti target or a -D compiler flag of the application project.
+ *
+ * @details A disabled feature is compiled out : its module, its APIs and its fields of the client handle,
+ *          so the smallest images do not carry the unused engines nor their static state.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Jan 22, 2026
+ * @author  Ridha MASTOURI
+ */
+
+#ifndef SNTPEX_LIBRARY_EXTENDED_TI_SIMPLELINK_SNTP_CONFIG_H_
+#define SNTPEX_LIBRARY_EXTENDED_TI_SIMPLELINK_SNTP_CONFIG_H_
+
+/* Features selection ------------------------------------------------------------*/
+
+/**
+ * @brief  Non blocking Timeout option, so timeout mecanism is handled on the @ref sntp_ex_ti_lib file
+ *  Keep pooling until the return status is different from @ref SLNETERR_BSD_EAGAIN and timeout is not occured.
+ * @remark Set to 0, to use the internal socket timeout which is configured on @ref p_client->sock->descriptor.timeout */
+#ifndef exlibSNTP_CONFIG_NONBLOCKING_TIMEOUT
+#define exlibSNTP_CONFIG_NONBLOCKING_TIMEOUT     1
+#endif
+/**
+ * @brief  Multi-server query engine and servers selection (@ref sntpex_client_multi_timestamp_get APIs).
+ * @remark Set to 0, the servers list only holds the server of @ref sntpex_client_set_server_address APIs. */
+#ifndef exlibSNTP_CONFIG_MULTI_SERVER
+#define exlibSNTP_CONFIG_MULTI_SERVER            1
+#endif
+/**
+ * @brief  Symmetric-key authentication of the requests and replies (@ref sntpex_client_auth_key_add APIs). */
+#ifndef exlibSNTP_CONFIG_AUTH
+#define exlibSNTP_CONFIG_AUTH                    1
+#endif
+/**
+ * @brief  Clock filter of the recent samples.
+ * @remark Set to 0, the client only keeps the last sample, which feeds the clock discipline directly. */
+#ifndef exlibSNTP_CONFIG_FILTER
+#define exlibSNTP_CONFIG_FILTER                  1
+#endif
+/**
+ * @brief  Clock discipline of the raw local clock (@ref sntpex_client_time_get APIs).
+ * @remark Set to 0, the application reads the samples with @ref sntpex_client_clock_offset_get APIs. */
+#ifndef exlibSNTP_CONFIG_DISCIPLINE
+#define exlibSNTP_CONFIG_DISCIPLINE              1
+#endif
+/**
+ * @brief  Adaptive poll scheduler (@ref sntpex_client_time_until_next_sync APIs), needs the clock discipline.
+ * @remark Set to 0, the application schedules the requests, sent with the minimum poll exponent. */
+#ifndef exlibSNTP_CONFIG_POLL
+#define exlibSNTP_CONFIG_POLL                    exlibSNTP_CONFIG_DISCIPLINE
+#endif
+/**
+ * @brief  Server names cache and pool rotation of @ref sntpex_client_set_server_name APIs.
+ * @remark Set to 0, every call resolves the name again. */
+#ifndef exlibSNTP_CONFIG_DNS_CACHE
+#define exlibSNTP_CONFIG_DNS_CACHE               1
+#endif
+/**
+ * @brief  Warm-start persistence of the clock state (@ref sntpex_client_state_save APIs). */
+#ifndef exlibSNTP_CONFIG_PERSIST
+#define exlibSNTP_CONFIG_PERSIST                 1
+#endif
+/**
+ * @brief  Broadcast and multicast listen mode (@ref sntpex_client_broadcast_listen APIs). */
+#ifndef exlibSNTP_CONFIG_BROADCAST
+#define exlibSNTP_CONFIG_BROADCAST               1
+#endif
+/**
+ * @brief  Responder mode answering the LAN client requests (@ref sntpex_client_responder_start APIs), needs the clock discipline. */
+#ifndef exlibSNTP_CONFIG_RESPONDER
+#define exlibSNTP_CONFIG_RESPONDER               exlibSNTP_CONFIG_DISCIPLINE
+#endif
+/**
+ * @brief  IPV6 servers and resolutions.
+ * @remark Set to 0, the cached resolutions only keep one word per address. */
+#ifndef exlibSNTP_CONFIG_IPV6
+#define exlibSNTP_CONFIG_IPV6                    1
+#endif
+/**
+ * @brief  Statistics block of the client, hot-path counters and latency histograms (@ref sntpex_client_stats_get APIs).
+ * @remark Disabled by default, the block costs about 600 bytes of RAM per client. */
+#ifndef exlibSNTP_CONFIG_STATS
+#define exlibSNTP_CONFIG_STATS                   0
+#endif
+/**
+ * @brief  Timer wheel of the in-flight requests, many step mode clients run by one task (@ref sntpex_timer_wheel_poll APIs).
+ * @remark Set to 0, every step mode client is stepped by the application and checks its own timeout. */
+#ifndef exlibSNTP_CONFIG_TIMER_WHEEL
+#define exlibSNTP_CONFIG_TIMER_WHEEL             1
+#endif
+/**
+ * @brief  Leap seconds table and UTC/TAI/GPS conversions of the disciplined clock (@ref sntpex_client_timescale_time_get APIs),
+ *         needs the clock discipline. */
+#ifndef exlibSNTP_CONFIG_TIMESCALE
+#define exlibSNTP_CONFIG_TIMESCALE               exlibSNTP_CONFIG_DISCIPLINE
+#endif
+/**
+ * @brief  Wait-free disciplined time of one client, callable from the interrupts (@ref sntpex_now APIs), needs the clock discipline. */
+#ifndef exlibSNTP_CONFIG_FAST_NOW
+#define exlibSNTP_CONFIG_FAST_NOW                exlibSNTP_CONFIG_DISCIPLINE
+#endif
+
+/* Lib configurations ------------------------------------------------------------*/
+
+/**
+ * @brief  Default client timeout.
+ * @remark This timeout will be used when application ignore the call of @ref sntpex_SetClientTimeout APIs. */
+#ifndef exlibSNTP_CLIENT_DEFAULT_TIMEOUT
+#define exlibSNTP_CLIENT_DEFAULT_TIMEOUT 3000
+#endif
+/**
+ * @brief  Define the maximum size of the packet NTP/SNTP time message
+ * @remark The replies are received into the whole buffer, it includes 24 bytes for optional authentication
+ *         data (key identifier and SHA1 MAC) and room for extension fields. A longer reply is truncated. */
+#ifndef exlibSNTP_TIME_MESSAGE_MAX_SIZE
+#define exlibSNTP_TIME_MESSAGE_MAX_SIZE  128
+#endif
+/**
+ * @brief  Define the number of symmetric keys kept by one client.
+ * @remark The keys are added by @ref sntpex_client_auth_key_add APIs. */
+#ifndef exlibSNTP_AUTH_MAX_KEYS
+#define exlibSNTP_AUTH_MAX_KEYS          2
+#endif
+/**
+ * @brief  Define the maximum number of clients which can be registered at the same time.
+ * @remark Every registered client owns its socket and event context, @ref sntpex_eventTriggingFromISR
+ *         gives every Spawn event to the client which owns the socket of the event. */
+#ifndef exlibSNTP_CLIENT_MAX_NUMBER
+#define exlibSNTP_CLIENT_MAX_NUMBER      4
+#endif
+/**
+ * @brief  Define the number of Spawn events buffered by one client, must be a power of 2 in the 2-128 range.
+ * @remark Every receive event keeps its own timestamp, so the replies of a burst or of a multi-server
+ *         request received back-to-back get their own T4. */
+#ifndef exlibSNTP_EVENT_RING_SIZE
+#define exlibSNTP_EVENT_RING_SIZE        8
+#endif
+/**
+ * @brief  Define the maximum number of servers which can be queried by one client.
+ * @remark The servers list is used by @ref sntpex_client_multi_timestamp_get APIs, 8 servers at most. */
+#ifndef exlibSNTP_CLIENT_MAX_SERVERS
+#define exlibSNTP_CLIENT_MAX_SERVERS     4
+#endif
+/**
+ * @brief  Define the maximum number of interfaces which can be bound to one client.
+ * @remark The interfaces are used in the bind order, a socket error fails over to the next one. */
+#ifndef exlibSNTP_CLIENT_MAX_INTERFACES
+#define exlibSNTP_CLIENT_MAX_INTERFACES  2
+#endif
+/**
+ * @brief  Define the root distance added per stratum level when the selected servers are combined, in us.
+ * @remark A lower stratum server gets a higher weight, see @ref sntpex_select_combine APIs. */
+#ifndef exlibSNTP_SELECT_STRATUM_DISTANCE
+#define exlibSNTP_SELECT_STRATUM_DISTANCE 1000
+#endif
+/**
+ * @brief  Define the number of recent samples kept by the clock filter.
+ * @remark The filtered offset is the offset of the minimum-delay sample (NTP clock-filter). */
+#ifndef exlibSNTP_FILTER_SIZE
+#define exlibSNTP_FILTER_SIZE            8
+#endif
+/**
+ * @brief  Define the default poll exponents range, the poll interval is 2^exponent seconds.
+ * @remark The range can be changed at run time with @ref sntpex_client_set_poll_range APIs. */
+#ifndef exlibSNTP_POLL_MIN_EXPONENT
+#define exlibSNTP_POLL_MIN_EXPONENT              6
+#endif
+#ifndef exlibSNTP_POLL_MAX_EXPONENT
+#define exlibSNTP_POLL_MAX_EXPONENT              17
+#endif
+/**
+ * @brief  Define the highest poll exponent reached by the Kiss-of-Death backoff, at most 21 (2^21 s in ms fits the os tick). */
+#ifndef exlibSNTP_POLL_KOD_MAX_EXPONENT
+#define exlibSNTP_POLL_KOD_MAX_EXPONENT          21
+#endif
+/**
+ * @brief  Define the number of consecutive good (or bad) predictions needed to change the poll exponent. */
+#ifndef exlibSNTP_POLL_HYSTERESIS
+#define exlibSNTP_POLL_HYSTERESIS                4
+#endif
+/**
+ * @brief  Define the prediction test of the poll adaptation : the residual offset accepted in number of jitters,
+ *         the minimum jitter in us (resolution of the os time) and the frequency change accepted between two updates in ppb. */
+#ifndef exlibSNTP_POLL_GATE
+#define exlibSNTP_POLL_GATE                      4
+#endif
+#ifndef exlibSNTP_POLL_JITTER_FLOOR
+#define exlibSNTP_POLL_JITTER_FLOOR              1000
+#endif
+#ifndef exlibSNTP_POLL_FREQ_STABILITY_PPB
+#define exlibSNTP_POLL_FREQ_STABILITY_PPB        1000
+#endif
+/**
+ * @brief  Define the number of server names cached by one client, and the number of addresses kept per name.
+ * @remark The addresses of a pool name are rotated by @ref sntpex_client_set_server_name APIs. */
+#ifndef exlibSNTP_DNS_CACHE_ENTRIES
+#define exlibSNTP_DNS_CACHE_ENTRIES              2
+#endif
+#ifndef exlibSNTP_DNS_MAX_ADDRESSES
+#define exlibSNTP_DNS_MAX_ADDRESSES              4
+#endif
+/**
+ * @brief  Define the time-to-live of a cached resolution, in ms.
+ * @remark @ref SlNetUtil_getHostByName does not report the record TTL, keep it lower than the pool TTL. */
+#ifndef exlibSNTP_DNS_CACHE_TTL
+#define exlibSNTP_DNS_CACHE_TTL                  3600000
+#endif
+/**
+ * @brief  Define the offset above which the disciplined time is stepped instead of slewed, in us.
+ * @remark Same threshold as the NTP reference implementation (128 ms). */
+#ifndef exlibSNTP_DISCIPLINE_STEP_THRESHOLD
+#define exlibSNTP_DISCIPLINE_STEP_THRESHOLD      128000
+#endif
+/**
+ * @brief  Define the maximum slew rate of the disciplined time, in ppm.
+ * @remark The disciplined time stays monotonic as long as the sum of the slew rate and the frequency correction is lower than 10^6 ppm. */
+#ifndef exlibSNTP_DISCIPLINE_MAX_SLEW_PPM
+#define exlibSNTP_DISCIPLINE_MAX_SLEW_PPM        500
+#endif
+/**
+ * @brief  Define the maximum frequency correction, in ppb (crystal tolerance). */
+#ifndef exlibSNTP_DISCIPLINE_MAX_FREQ_PPB
+#define exlibSNTP_DISCIPLINE_MAX_FREQ_PPB        500000
+#endif
+/**
+ * @brief  Define the minimum interval between two frequency measurements, in us. */
+#ifndef exlibSNTP_DISCIPLINE_FREQ_MIN_INTERVAL
+#define exlibSNTP_DISCIPLINE_FREQ_MIN_INTERVAL   16000000
+#endif
+/**
+ * @brief  Define the frequency averaging time constant, as a power of 2 of updates. */
+#ifndef exlibSNTP_DISCIPLINE_FREQ_AVG_SHIFT
+#define exlibSNTP_DISCIPLINE_FREQ_AVG_SHIFT      2
+#endif
+/**
+ * @brief  Define the clock precision advertised by the responder mode, as a power of 2 seconds.
+ * @remark -10 is about 1 ms, the resolution of the os time. Use a lower exponent with a driver RX timestamp. */
+#ifndef exlibSNTP_RESPONDER_PRECISION
+#define exlibSNTP_RESPONDER_PRECISION            -10
+#endif
+
+/**
+ * @brief  Define the number of buckets of the statistics histograms.
+ * @remark The bucket i counts the values of [ 2^(i-1), 2^i ), the last bucket counts the greater values. */
+#ifndef exlibSNTP_STATS_BUCKETS
+#define exlibSNTP_STATS_BUCKETS                  16
+#endif
+
+/**
+ * @brief  Define the number of slots of the timer wheel, must be a power of 2, and the slot width as a power of 2 ms.
+ * @remark One revolution (64 slots of 64 ms, 4096 ms) is longer than the default timeout, so a deadline is
+ *         visited once on its expiry. A longer timeout only stays on its slot for the next revolutions. */
+#ifndef exlibSNTP_WHEEL_SLOTS
+#define exlibSNTP_WHEEL_SLOTS                    64
+#endif
+#ifndef exlibSNTP_WHEEL_SLOT_SHIFT
+#define exlibSNTP_WHEEL_SLOT_SHIFT               6
+#endif
+
+/**
+ * @brief  Define the number of entries of the leap seconds table, the built-in table holds 28 entries (1972 to 2017).
+ * @remark The next leaps are added by @ref sntpex_timescale_leap_add APIs, or announced by the Leap Indicator of the replies. */
+#ifndef exlibSNTP_LEAP_TABLE_SIZE
+#define exlibSNTP_LEAP_TABLE_SIZE                32
+#endif
+/**
+ * @brief  Define the duration of the leap smear, in s. The smear ends on the leap instant.
+ * @remark 86400 s smears one second at 11.6 ppm, lower than the crystal tolerance of the peers. */
+#ifndef exlibSNTP_LEAP_SMEAR_WINDOW
+#define exlibSNTP_LEAP_SMEAR_WINDOW              86400
+#endif
+
+/**
+ * @brief  Data memory barrier, used to publish the fields shared with the host IRQ and the Spawn task.
+ * @remark Can be redefined by the application (e.g. compiler barrier on a single core without cache). */
+#ifndef exlibSNTP_MEMORY_BARRIER
+  #define exlibSNTP_MEMORY_BARRIER()       __DMB()
+#endif
+
+/* Features dependencies ---------------------------------------------------------*/
+
+#if ( exlibSNTP_CONFIG_NONBLOCKING_TIMEOUT == 1 )
+  #define exlibSNTP_CLIENT_USE_NONBLOCKING_TIMEOUT_OPTION
+#endif
+
+/* Without the multi-server engine, the servers list holds one server */
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 0 )
+  #undef  exlibSNTP_CLIENT_MAX_SERVERS
+  #define exlibSNTP_CLIENT_MAX_SERVERS           1
+#endif
+
+/* The adaptive poll, the timescales, the fast time and the responder mode use the disciplined clock */
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 0 ) && ( ( exlibSNTP_CONFIG_POLL == 1 ) || ( exlibSNTP_CONFIG_TIMESCALE == 1 ) || \
+                                              ( exlibSNTP_CONFIG_FAST_NOW == 1 ) || ( exlibSNTP_CONFIG_RESPONDER == 1 ) )
+  #error "exlibSNTP_CONFIG_POLL, _TIMESCALE, _FAST_NOW and _RESPONDER need exlibSNTP_CONFIG_DISCIPLINE"
+#endif
+
+/* The survivors of the selection are returned as an 8-bit mask, one bit per server */
+#if ( exlibSNTP_CLIENT_MAX_SERVERS < 1 ) || ( exlibSNTP_CLIENT_MAX_SERVERS > 8 )
+  #error "exlibSNTP_CLIENT_MAX_SERVERS must be in the 1-8 range"
+#endif
+
+/* The poll interval is counted in ms on the 32-bit os tick */
+#if ( exlibSNTP_POLL_MIN_EXPONENT > exlibSNTP_POLL_MAX_EXPONENT ) || \
+    ( exlibSNTP_POLL_MAX_EXPONENT > exlibSNTP_POLL_KOD_MAX_EXPONENT ) || ( exlibSNTP_POLL_KOD_MAX_EXPONENT > 21 )
+  #error "exlibSNTP_POLL_MIN_EXPONENT <= exlibSNTP_POLL_MAX_EXPONENT <= exlibSNTP_POLL_KOD_MAX_EXPONENT <= 21 is required"
+#endif
+
+/* The events ring is indexed by a mask, its count of pending events is an 8-bit counter */
+#if ( exlibSNTP_EVENT_RING_SIZE < 2 ) || ( exlibSNTP_EVENT_RING_SIZE > 128 ) || \
+    ( ( exlibSNTP_EVENT_RING_SIZE & ( exlibSNTP_EVENT_RING_SIZE - 1 ) ) != 0 )
+  #error "exlibSNTP_EVENT_RING_SIZE must be a power of 2 in the 2-128 range"
+#endif
+
+/* The timer wheel hashes the deadlines on its slots with a mask */
+#if ( exlibSNTP_CONFIG_TIMER_WHEEL == 1 ) && \
+    ( ( exlibSNTP_WHEEL_SLOTS < 2 ) || ( ( exlibSNTP_WHEEL_SLOTS & ( exlibSNTP_WHEEL_SLOTS - 1 ) ) != 0 ) )
+  #error "exlibSNTP_WHEEL_SLOTS must be a power of 2, 2 at least"
+#endif
+
+#endif /* SNTPEX_LIBRARY_EXTENDED_TI_SIMPLELINK_SNTP_CONFIG_H_ */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
@@ -0,0 +1,182 @@
+/**
+ * @file    sntpex_ti/sntp_ex_auth.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Symmetric-key authentication of the Extended SNTP library (RFC 5905 section 7.3, RFC 8573).
+ *
+ * @note    The Key Identifier and the Message Authentication Code follow the 48 bytes header. The MAC is
+ *          computed by the @ref compute_mac vtable API, so the SimpleLink crypto accelerator is used :
+ *          digest( key || header ) for MD5 and SHA1, CMAC( key, header ) for AES-CMAC.
+ *
+ * @details The keys are validated and stored once in the client key table, with their MAC size, so an
+ *          authenticated request only costs the hardware hashing of the request and of the reply.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Jan 18, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntp_ex_lib_ti.h"
+
+#if ( exlibSNTP_CONFIG_AUTH == 1 )
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+  * @{
+  */
+/* Exported function   ------------------------------------------------------------*/
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the MAC size of an authentication algorithm.
+ * @param   ucType: Authentication algorithm.
+ *          This parameter can be a value of @ref sntpex_auth_type_t.
+ * @retval  MAC size in bytes, 0 when the algorithm is not supported.
+ */
+#pragma optimize=speed
+uint8_t sntpex_auth_mac_size( uint8_t ucType )
+{
+  switch( ucType )
+  {
+    case SNTPEX_AUTH_MD5:
+    case SNTPEX_AUTH_AES_CMAC:
+      return 16;
+
+    case SNTPEX_AUTH_SHA1:
+      return 20;
+
+    default:
+      return 0;
+  }
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   append the Key Identifier and the MAC to a serialized packet.
+ * @param   pxVtable: Pointer to the virtual table APIs, providing @ref compute_mac .
+ *          This parameter can be a value of @ref const struct ud_op_vtable *.
+ * @param   pxKey: Pointer to the key.
+ *          This parameter can be a value of @ref const struct xSntpKey_t *.
+ * @param   pucPacket: Pointer to the serialized packet.
+ *          This parameter can be a value of @ref uint8_t *.
+ * @param   usSize: Size of the packet buffer.
+ *          This parameter can be a value of @ref uint16_t.
+ * @param   pusLength: Pointer to the packet length, the authenticated length is returned.
+ *          This parameter can be a value of @ref uint16_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_auth_sign( const struct ud_op_vtable * pxVtable, const struct xSntpKey_t * pxKey,
+                            uint8_t * pucPacket, uint16_t usSize, uint16_t * pusLength )
+{
+  uint8_t ucMacLength;
+
+  /* Make sure that the virtual table, the key, the packet and its length are valid */
+  if( ( NULL == pxVtable ) || ( NULL == pxKey ) || ( NULL == pucPacket ) || ( NULL == pusLength ) ||
+      ( NULL == pxVtable->compute_mac ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* The authentication data must fit the packet buffer */
+  if( ( *pusLength + exlibSNTP_AUTH_KEY_ID_SIZE + pxKey->macSize ) > usSize )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_INVALID_MESSAGE;
+  }
+
+  uint8_t * p_auth = &pucPacket[ *pusLength ];
+
+  /* Key Identifier, network order */
+  p_auth[ 0 ] = ( uint8_t )( pxKey->keyId >> 24 );
+  p_auth[ 1 ] = ( uint8_t )( pxKey->keyId >> 16 );
+  p_auth[ 2 ] = ( uint8_t )( pxKey->keyId >> 8  );
+  p_auth[ 3 ] = ( uint8_t )( pxKey->keyId       );
+
+  ucMacLength = pxKey->macSize;
+
+  if( ( 0 != pxVtable->compute_mac( pxKey->type, pxKey->key, pxKey->length, pucPacket, *pusLength,
+                                    &p_auth[ exlibSNTP_AUTH_KEY_ID_SIZE ], &ucMacLength ) ) ||
+      ( ucMacLength != pxKey->macSize ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_AUTH;
+  }
+
+  *pusLength = ( uint16_t )( *pusLength + exlibSNTP_AUTH_KEY_ID_SIZE + ucMacLength );
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   verify the Key Identifier and the MAC of a received packet, the MAC is compared in constant time.
+ * @param   pxVtable: Pointer to the virtual table APIs, providing @ref compute_mac .
+ *          This parameter can be a value of @ref const struct ud_op_vtable *.
+ * @param   pxKey: Pointer to the expected key.
+ *          This parameter can be a value of @ref const struct xSntpKey_t *.
+ * @param   pucPacket: Pointer to the received packet.
+ *          This parameter can be a value of @ref const uint8_t *.
+ * @param   usLength: Length of the received packet.
+ *          This parameter can be a value of @ref uint16_t.
+ * @retval  SNTPEX_SUCCESS if the packet is authentic, SNTPEX_ERR_AUTH otherwise (including crypto-NAK).
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_auth_verify( const struct ud_op_vtable * pxVtable, const struct xSntpKey_t * pxKey,
+                              const uint8_t * pucPacket, uint16_t usLength )
+{
+  struct xSntpTrailer_t xTrailer;
+  uint8_t               aucMac[ exlibSNTP_AUTH_MAC_MAX_SIZE ];
+  uint8_t               ucMacLength;
+  uint8_t               ucDiff = 0;
+  uint8_t               ucIndex;
+
+  /* Make sure that the virtual table, the key and the packet are valid */
+  if( ( NULL == pxVtable ) || ( NULL == pxKey ) || ( NULL == pucPacket ) || ( NULL == pxVtable->compute_mac ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /** @remark The reply must carry a MAC of the key algorithm after its extension fields, a crypto-NAK only
+   *  holds a Key Identifier and is rejected by its MAC length */
+  if( ( sntpex_packet_trailer_parse( pucPacket, usLength, &xTrailer ) != SNTPEX_SUCCESS ) ||
+      ( xTrailer.macOffset == 0 ) || ( xTrailer.macLength != pxKey->macSize ) || ( xTrailer.keyId != pxKey->keyId ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_AUTH;
+  }
+
+  const uint8_t * p_auth = &pucPacket[ xTrailer.macOffset ];
+
+  ucMacLength = pxKey->macSize;
+
+  /* The MAC covers the header and the extension fields */
+  if( ( 0 != pxVtable->compute_mac( pxKey->type, pxKey->key, pxKey->length, pucPacket, xTrailer.macOffset,
+                                    aucMac, &ucMacLength ) ) ||
+      ( ucMacLength != pxKey->macSize ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_AUTH;
+  }
+
+  /* Constant time compare, the duration does not depend on the first mismatching byte */
+  for( ucIndex = 0; ucIndex < ucMacLength; ucIndex++ )
+  {
+    ucDiff |= ( uint8_t )( aucMac[ ucIndex ] ^ p_auth[ exlibSNTP_AUTH_KEY_ID_SIZE + ucIndex ] );
+  }
+
+  /* Return the error status. */
+  return ( ucDiff == 0 ) ? SNTPEX_SUCCESS : SNTPEX_ERR_AUTH;
+}
+/** @} */
+
+#endif /* exlibSNTP_CONFIG_AUTH */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
@@ -0,0 +1,279 @@
+/**
+ * @file    sntpex_ti/sntp_ex_discipline.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Local software clock discipline of the Extended SNTP library.
+ *
+ * @note    The local clock (@ref get_unix_timestamp vtable API) is never written. A correction is applied on
+ *          top of it : the phase error is slewed at a bounded rate, so the disciplined time stays monotonic,
+ *          and the crystal frequency error is estimated from the successive offsets.
+ *
+ * @details The offsets are measured against the raw local clock, therefore the frequency error is directly
+ *          the drift of the offset between two updates, whatever the correction applied meanwhile.
+ *          The first measurement sets the frequency, the next ones are averaged with a time constant of
+ *          2^@ref exlibSNTP_DISCIPLINE_FREQ_AVG_SHIFT updates.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Jan 10, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntp_ex_lib_ti.h"
+
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 1 )
+
+/* Private define ----------------------------------------------------------------*/
+/* Largest offset difference in us which can be scaled to ppb on 64 bits */
+#define exlibSNTP_DISCIPLINE_DRIFT_CLAMP   ( INT64_MAX / 1000000000 )
+
+/* Private function   ------------------------------------------------------------*/
+/**
+ * @defgroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief Discipline utility APIs
+ *        Private functions used by @ref sntp_ex_discipline.c .
+ *       + @ref prv_discipline_slew
+ *       + @ref prv_discipline_elapsed
+ *       + @ref prv_discipline_drift
+ * @{
+ */
+/**
+ * @brief Part of the residual offset slewed after the given elapsed time */
+__STATIC_INLINE int64_t  prv_discipline_slew   ( int64_t llResidual, uint64_t ullElapsed );
+/**
+ * @brief Elapsed raw time since the last update, 0 when the raw time is older */
+__STATIC_INLINE uint64_t prv_discipline_elapsed( const struct xSntpDiscipline_t * pxDiscipline, uint64_t ullRawTime );
+/**
+ * @brief Correction of the frequency error over the elapsed time, without overflow */
+__STATIC_INLINE int64_t  prv_discipline_drift  ( int64_t llFreq, uint64_t ullElapsed );
+/**
+ * @}
+ */
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+  * @{
+  */
+/* Exported function   ------------------------------------------------------------*/
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   clear the clock discipline, the local clock is used without correction.
+ * @param   pxDiscipline: Pointer to the clock discipline.
+ *          This parameter can be a value of @ref struct xSntpDiscipline_t *.
+ * @retval  None.
+ */
+#pragma optimize=speed
+void sntpex_discipline_reset( struct xSntpDiscipline_t * pxDiscipline )
+{
+  if( NULL != pxDiscipline )
+  {
+    ( void )memset( pxDiscipline, 0, sizeof( struct xSntpDiscipline_t ) );
+  }
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   update the clock discipline with a new clock sample.
+ *          An offset greater than @ref exlibSNTP_DISCIPLINE_STEP_THRESHOLD steps the time, a lower one is slewed.
+ * @param   pxDiscipline: Pointer to the clock discipline.
+ *          This parameter can be a value of @ref struct xSntpDiscipline_t *.
+ * @param   pxSample: Pointer to the clock sample, measured against the raw local clock.
+ *          This parameter can be a value of @ref const struct xSntpSample_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_discipline_update( struct xSntpDiscipline_t * pxDiscipline, const struct xSntpSample_t * pxSample )
+{
+  /* Make sure that the clock discipline and the sample are valid */
+  if( ( NULL == pxDiscipline ) || ( NULL == pxSample ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /** @remark First sample, the time is stepped and the frequency reference is taken. A frequency restored
+   *  by @ref sntpex_client_state_restore is used at once, the first measurement is not awaited */
+  if( pxDiscipline->state == SNTPEX_DISCIPLINE_UNSET )
+  {
+    pxDiscipline->phase      = pxSample->offset;
+    pxDiscipline->residual   = 0;
+    pxDiscipline->lastUpdate = pxSample->epoch;
+    pxDiscipline->refOffset  = pxSample->offset;
+    pxDiscipline->refEpoch   = pxSample->epoch;
+    pxDiscipline->state      = ( pxDiscipline->freq != 0 ) ? SNTPEX_DISCIPLINE_SYNC : SNTPEX_DISCIPLINE_FREQ;
+
+    /* Return the error status. */
+    return SNTPEX_SUCCESS;
+  }
+
+  /* Fold the correction applied since the last update into the phase */
+  uint64_t ullElapsed = prv_discipline_elapsed( pxDiscipline, pxSample->epoch );
+  int64_t  llSlewed   = prv_discipline_slew( pxDiscipline->residual, ullElapsed );
+
+  pxDiscipline->phase     += prv_discipline_drift( pxDiscipline->freq, ullElapsed ) + llSlewed;
+  pxDiscipline->residual   = pxSample->offset - pxDiscipline->phase;
+  pxDiscipline->lastUpdate = ( pxSample->epoch > pxDiscipline->lastUpdate ) ? pxSample->epoch : pxDiscipline->lastUpdate;
+
+  /** @remark A large error is not slewed, it would take too long at the maximum slew rate */
+  if( ( pxDiscipline->residual > exlibSNTP_DISCIPLINE_STEP_THRESHOLD ) || ( pxDiscipline->residual < -exlibSNTP_DISCIPLINE_STEP_THRESHOLD ) )
+  {
+    pxDiscipline->phase    = pxSample->offset;
+    pxDiscipline->residual = 0;
+  }
+
+  /* Estimate the frequency error, once the interval is long enough compared with the offset noise */
+  if( ( pxSample->epoch > pxDiscipline->refEpoch ) &&
+      ( ( pxSample->epoch - pxDiscipline->refEpoch ) >= exlibSNTP_DISCIPLINE_FREQ_MIN_INTERVAL ) )
+  {
+    int64_t llDrift = pxSample->offset - pxDiscipline->refOffset;
+
+    /** @remark The difference is saturated before the scaling to ppb (2.5 h of drift), it does not overflow
+     *  after a step or a bad sample. A saturated measurement is then bounded by the crystal tolerance */
+    if( llDrift > exlibSNTP_DISCIPLINE_DRIFT_CLAMP )
+    {
+      llDrift = exlibSNTP_DISCIPLINE_DRIFT_CLAMP;
+    }
+    else if( llDrift < -exlibSNTP_DISCIPLINE_DRIFT_CLAMP )
+    {
+      llDrift = -exlibSNTP_DISCIPLINE_DRIFT_CLAMP;
+    }
+    else
+    {
+      /* Do Nothing : MISRA 15.7 */
+    }
+
+    /* drift in ppb = ( offset difference in us * 10^9 ) / interval in us */
+    int64_t llMeasured = ( llDrift * 1000000000 ) / ( int64_t )( pxSample->epoch - pxDiscipline->refEpoch );
+
+    if( pxDiscipline->state == SNTPEX_DISCIPLINE_FREQ )
+    {
+      /* First measurement, the frequency is directly set */
+      pxDiscipline->freq  = llMeasured;
+      pxDiscipline->state = SNTPEX_DISCIPLINE_SYNC;
+    }
+    else
+    {
+      /* Next measurements are averaged, a single noisy sample has a limited impact */
+      pxDiscipline->freq += ( llMeasured - pxDiscipline->freq ) / ( 1 << exlibSNTP_DISCIPLINE_FREQ_AVG_SHIFT );
+    }
+
+    /* The crystal tolerance bounds the frequency correction */
+    if( pxDiscipline->freq > exlibSNTP_DISCIPLINE_MAX_FREQ_PPB )
+    {
+      pxDiscipline->freq = exlibSNTP_DISCIPLINE_MAX_FREQ_PPB;
+    }
+    else if( pxDiscipline->freq < -exlibSNTP_DISCIPLINE_MAX_FREQ_PPB )
+    {
+      pxDiscipline->freq = -exlibSNTP_DISCIPLINE_MAX_FREQ_PPB;
+    }
+    else
+    {
+      /* Do Nothing : MISRA 15.7 */
+    }
+
+    pxDiscipline->refOffset = pxSample->offset;
+    pxDiscipline->refEpoch  = pxSample->epoch;
+  }
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the disciplined time from the raw local time, the discipline is not modified.
+ * @param   pxDiscipline: Pointer to the clock discipline.
+ *          This parameter can be a value of @ref const struct xSntpDiscipline_t *.
+ * @param   ullRawTime: Raw local 64-UNIX time in us (@ref get_unix_timestamp vtable API).
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  Disciplined 64-UNIX time in us, the raw time when the discipline is not set.
+ */
+#pragma optimize=speed
+uint64_t sntpex_discipline_time_get( const struct xSntpDiscipline_t * pxDiscipline, uint64_t ullRawTime )
+{
+  if( ( NULL == pxDiscipline ) || ( pxDiscipline->state == SNTPEX_DISCIPLINE_UNSET ) )
+  {
+    return ullRawTime;
+  }
+
+  uint64_t ullElapsed    = prv_discipline_elapsed( pxDiscipline, ullRawTime );
+  int64_t  llCorrection  = pxDiscipline->phase +
+                           prv_discipline_drift( pxDiscipline->freq, ullElapsed ) +
+                           prv_discipline_slew( pxDiscipline->residual, ullElapsed );
+
+  return ( uint64_t )( ( int64_t )ullRawTime + llCorrection );
+}
+/** @} */
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+  * @{
+  */
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Part of the residual offset slewed after the given elapsed time, at @ref exlibSNTP_DISCIPLINE_MAX_SLEW_PPM .
+ * @param   llResidual: Residual offset to slew in us
+ *          This parameter can be a value of @ref int64_t.
+ * @param   ullElapsed: Elapsed raw time in us
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  Slewed offset in us, this parameter can be a value of @ref int64_t.
+ */
+#pragma optimize=speed
+__STATIC_INLINE int64_t prv_discipline_slew( int64_t llResidual, uint64_t ullElapsed )
+{
+  int64_t llMaxSlew = ( int64_t )( ( ullElapsed * exlibSNTP_DISCIPLINE_MAX_SLEW_PPM ) / 1000000u );
+
+  if( llResidual > llMaxSlew )
+  {
+    return llMaxSlew;
+  }
+  else if( llResidual < -llMaxSlew )
+  {
+    return -llMaxSlew;
+  }
+  else
+  {
+    /* The residual is fully slewed */
+    return llResidual;
+  }
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Elapsed raw time since the last update.
+ * @param   pxDiscipline: Pointer to the clock discipline.
+ *          This parameter can be a value of @ref const struct xSntpDiscipline_t *.
+ * @param   ullRawTime: Raw local 64-UNIX time in us
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  Elapsed time in us, 0 when the raw time is older than the last update.
+ */
+#pragma optimize=speed
+__STATIC_INLINE uint64_t prv_discipline_elapsed( const struct xSntpDiscipline_t * pxDiscipline, uint64_t ullRawTime )
+{
+  return ( ullRawTime > pxDiscipline->lastUpdate ) ? ( ullRawTime - pxDiscipline->lastUpdate ) : ( uint64_t )0;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Correction of the frequency error over the elapsed time. The elapsed time is split in blocks of
+ *          10^9 us, so the product does not overflow after a long time without update.
+ * @param   llFreq: Frequency correction in ppb, bounded by @ref exlibSNTP_DISCIPLINE_MAX_FREQ_PPB .
+ *          This parameter can be a value of @ref int64_t.
+ * @param   ullElapsed: Elapsed raw time in us
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  Correction in us, this parameter can be a value of @ref int64_t.
+ */
+#pragma optimize=speed
+__STATIC_INLINE int64_t prv_discipline_drift( int64_t llFreq, uint64_t ullElapsed )
+{
+  return ( llFreq * ( int64_t )( ullElapsed / 1000000000u ) ) +
+         ( ( llFreq * ( int64_t )( ullElapsed % 1000000000u ) ) / 1000000000 );
+}
+/** @} */
+
+#endif /* exlibSNTP_CONFIG_DISCIPLINE */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
@@ -0,0 +1,212 @@
+/**
+ * @file    sntpex_ti/sntp_ex_dns.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Server name resolution and address cache of the Extended SNTP library.
+ *
+ * @note    Every A/AAAA record returned by @ref SlNetUtil_getHostByName is kept, so the members of a pool
+ *          name can be rotated. An entry is reused until its time-to-live expires, the periodic syncs then
+ *          skip the DNS round trip.
+ *
+ * @details @ref SlNetUtil_getHostByName does not report the record TTL, the entries expire after the
+ *          configured @ref exlibSNTP_DNS_CACHE_TTL . The cache lookup never blocks, the resolution is only
+ *          done on a cache miss. Without @ref exlibSNTP_CONFIG_DNS_CACHE every sync resolves the name.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Jan 14, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntp_ex_lib_ti.h"
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+  * @{
+  */
+/* Exported function   ------------------------------------------------------------*/
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   resolve a server name, every returned address is saved in the entry.
+ * @param   pxEntry: Pointer to the cache entry.
+ *          This parameter can be a value of @ref struct xSntpDnsEntry_t *.
+ * @param   pcHostname: Pointer to the NTP Host name server.
+ *          This parameter can be a value of @ref const char *.
+ * @param   Family: Address family (IPV4/IPV6).
+ *          This parameter can be a value of @ref uint8_t.
+ * @param   ulNow: Current os tick in ms, used for the entry time-to-live.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_dns_resolve( struct xSntpDnsEntry_t * pxEntry, const char * pcHostname, uint8_t Family, uint32_t ulNow )
+{
+  uint32_t aulAddress[ exlibSNTP_DNS_MAX_ADDRESSES * exlibSNTP_DNS_ADDRESS_WORDS ] = { 0, };
+  uint16_t usAddressCount = exlibSNTP_DNS_MAX_ADDRESSES;
+  size_t   xNameLength;
+  int32_t  SLReturnCode;
+  uint8_t  ucIndex;
+
+  /* Make sure that the entry and the host-name are valid */
+  if( ( NULL == pxEntry ) || ( NULL == pcHostname ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Make sure that the host-name fits the entry and the family is supported */
+  xNameLength = strlen( pcHostname );
+
+#if ( exlibSNTP_CONFIG_IPV6 == 1 )
+  if( ( xNameLength == 0 ) || ( xNameLength >= exlibSNTP_DNS_HOSTNAME_MAX ) ||
+      ( ( Family != SLNETSOCK_AF_INET ) && ( Family != SLNETSOCK_AF_INET6 ) ) )
+#else
+  if( ( xNameLength == 0 ) || ( xNameLength >= exlibSNTP_DNS_HOSTNAME_MAX ) || ( Family != SLNETSOCK_AF_INET ) )
+#endif
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_DNS_RESOLVE;
+  }
+
+  /* Obtain every IP Address of machine on network, by machine name. The interface is returned on success */
+  SLReturnCode = SlNetUtil_getHostByName( 0, ( char * )pcHostname, ( uint16_t )xNameLength, aulAddress, &usAddressCount, Family );
+
+  if( ( SLReturnCode < 0 ) || ( usAddressCount == 0 ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_DNS_RESOLVE;
+  }
+
+  ( void )memset( pxEntry, 0, sizeof( struct xSntpDnsEntry_t ) );
+  ( void )memcpy( pxEntry->hostname, pcHostname, xNameLength );
+
+  pxEntry->family       = Family;
+  pxEntry->interface    = ( InterfaceIndex_t )SLReturnCode;
+  pxEntry->count        = ( uint8_t )( ( usAddressCount > exlibSNTP_DNS_MAX_ADDRESSES ) ? exlibSNTP_DNS_MAX_ADDRESSES : usAddressCount );
+  pxEntry->resolvedTick = ulNow;
+
+  /* The addresses are returned in host order, one word per V4 address and four words per V6 address */
+  for( ucIndex = 0; ucIndex < pxEntry->count; ucIndex++ )
+  {
+#if ( exlibSNTP_CONFIG_IPV6 == 1 )
+    if( Family == SLNETSOCK_AF_INET6 )
+    {
+      ( void )memcpy( pxEntry->address[ ucIndex ], &aulAddress[ ucIndex * 4 ], 4 * sizeof( uint32_t ) );
+    }
+    else
+#endif
+    {
+      pxEntry->address[ ucIndex ][ 0 ] = aulAddress[ ucIndex ];
+    }
+  }
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+#if ( exlibSNTP_CONFIG_DNS_CACHE == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   check whether an entry holds a valid resolution of the server name.
+ * @param   pxEntry: Pointer to the cache entry.
+ *          This parameter can be a value of @ref const struct xSntpDnsEntry_t *.
+ * @param   pcHostname: Pointer to the NTP Host name server.
+ *          This parameter can be a value of @ref const char *.
+ * @param   Family: Address family (IPV4/IPV6).
+ *          This parameter can be a value of @ref uint8_t.
+ * @param   ulNow: Current os tick in ms.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  1 when the entry matches and its time-to-live is not expired, 0 otherwise.
+ */
+#pragma optimize=speed
+uint8_t sntpex_dns_entry_is_valid( const struct xSntpDnsEntry_t * pxEntry, const char * pcHostname, uint8_t Family, uint32_t ulNow )
+{
+  if( ( NULL == pxEntry ) || ( NULL == pcHostname ) || ( pxEntry->count == 0 ) )
+  {
+    return 0;
+  }
+
+  /* The unsigned difference handles the os tick wrap-around */
+  if( ( pxEntry->family != Family ) || ( ( ulNow - pxEntry->resolvedTick ) >= exlibSNTP_DNS_CACHE_TTL ) )
+  {
+    return 0;
+  }
+
+  return ( strncmp( pxEntry->hostname, pcHostname, exlibSNTP_DNS_HOSTNAME_MAX ) == 0 ) ? 1 : 0;
+}
+#endif /* exlibSNTP_CONFIG_DNS_CACHE */
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   build the net address of one resolved address, with the NTP port.
+ * @param   pxEntry: Pointer to the cache entry.
+ *          This parameter can be a value of @ref const struct xSntpDnsEntry_t *.
+ * @param   ucIndex: Index of the resolved address.
+ *          This parameter can be a value of @ref uint8_t.
+ * @param   pxAddress: Pointer to the net address storage (@ref SlNetSock_AddrIn_t or @ref SlNetSock_AddrIn6_t).
+ *          This parameter can be a value of @ref void *.
+ * @param   usSize: Size of the net address storage.
+ *          This parameter can be a value of @ref uint16_t.
+ * @param   pusLength: Pointer to the net address length.
+ *          This parameter can be a value of @ref uint16_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_dns_address_get( const struct xSntpDnsEntry_t * pxEntry, uint8_t ucIndex, void * pxAddress, uint16_t usSize, uint16_t * pusLength )
+{
+  /* Make sure that the entry, the net address and its length are valid */
+  if( ( NULL == pxEntry ) || ( NULL == pxAddress ) || ( NULL == pusLength ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  if( ucIndex >= pxEntry->count )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_DNS_RESOLVE;
+  }
+
+  if( ( pxEntry->family == SLNETSOCK_AF_INET ) && ( usSize >= sizeof( SlNetSock_AddrIn_t ) ) )
+  {
+    SlNetSock_AddrIn_t * pxhost_address_v4 = ( SlNetSock_AddrIn_t * )pxAddress;
+
+    ( void )memset( pxhost_address_v4, 0, sizeof( SlNetSock_AddrIn_t ) );
+    pxhost_address_v4->sin_family      = SLNETSOCK_AF_INET;
+    pxhost_address_v4->sin_port        = exlibSLNETUTIL_HTONS( exlibSNTP_SERVER_PORT );
+    pxhost_address_v4->sin_addr.s_addr = exlibSLNETUTIL_HTONL( pxEntry->address[ ucIndex ][ 0 ] );
+
+    *pusLength = sizeof( SlNetSock_AddrIn_t );
+  }
+#if ( exlibSNTP_CONFIG_IPV6 == 1 )
+  else if( ( pxEntry->family == SLNETSOCK_AF_INET6 ) && ( usSize >= sizeof( SlNetSock_AddrIn6_t ) ) )
+  {
+    SlNetSock_AddrIn6_t * pxhost_address_v6 = ( SlNetSock_AddrIn6_t * )pxAddress;
+
+    ( void )memset( pxhost_address_v6, 0, sizeof( SlNetSock_AddrIn6_t ) );
+    pxhost_address_v6->sin6_family                 = SLNETSOCK_AF_INET6;
+    pxhost_address_v6->sin6_port                   = exlibSLNETUTIL_HTONS( exlibSNTP_SERVER_PORT );
+    pxhost_address_v6->sin6_addr._S6_un._S6_u32[0] = exlibSLNETUTIL_HTONL( pxEntry->address[ ucIndex ][ 0 ] );
+    pxhost_address_v6->sin6_addr._S6_un._S6_u32[1] = exlibSLNETUTIL_HTONL( pxEntry->address[ ucIndex ][ 1 ] );
+    pxhost_address_v6->sin6_addr._S6_un._S6_u32[2] = exlibSLNETUTIL_HTONL( pxEntry->address[ ucIndex ][ 2 ] );
+    pxhost_address_v6->sin6_addr._S6_un._S6_u32[3] = exlibSLNETUTIL_HTONL( pxEntry->address[ ucIndex ][ 3 ] );
+
+    *pusLength = sizeof( SlNetSock_AddrIn6_t );
+  }
+#endif
+  else
+  {
+    /* The storage is too small for the address family, return the error status. */
+    return SNTPEX_ERROR;
+  }
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+/** @} */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
@@ -0,0 +1,220 @@
+/**
+ * @file    sntpex_ti/sntp_ex_filter.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Clock filter of the Extended SNTP library.
+ *
+ * @note    The clock filter keeps a ring of the recent samples computed by @ref sntpex_sample_compute and
+ *          selects the minimum-delay one (RFC 5905 clock-filter).
+ *
+ * @details The filter is compiled out without @ref exlibSNTP_CONFIG_FILTER , the last sample then feeds the
+ *          clock discipline directly.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Jan 6, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntp_ex_lib_ti.h"
+
+#if ( exlibSNTP_CONFIG_FILTER == 1 )
+
+/* Private define ----------------------------------------------------------------*/
+/* Bound of the offset differences of the jitter, 2^28 us (268 s) : the sum of the squares of a full ring
+   fits 64 bits, a stepped clock or a falseticker only saturates the jitter */
+#define exlibSNTP_FILTER_JITTER_CLAMP      ( ( int64_t )1 << 28 )
+
+/* Private function   ------------------------------------------------------------*/
+/**
+ * @defgroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief Filter utility APIs
+ *        Private functions used by @ref sntp_ex_filter.c .
+ *       + @ref prv_filter_isqrt
+ * @{
+ */
+/**
+ * @brief Integer square root, used for the RMS jitter */
+__STATIC_INLINE uint64_t prv_filter_isqrt( uint64_t ullValue );
+/**
+ * @}
+ */
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+  * @{
+  */
+/* Exported function   ------------------------------------------------------------*/
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   clear the clock filter.
+ * @param   pxFilter: Pointer to the clock filter.
+ *          This parameter can be a value of @ref struct xSntpFilter_t *.
+ * @retval  None.
+ */
+#pragma optimize=speed
+void sntpex_filter_reset( struct xSntpFilter_t * pxFilter )
+{
+  if( NULL != pxFilter )
+  {
+    ( void )memset( pxFilter, 0, sizeof( struct xSntpFilter_t ) );
+  }
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   add a sample to the clock filter, the oldest sample is replaced when the ring is full.
+ * @param   pxFilter: Pointer to the clock filter.
+ *          This parameter can be a value of @ref struct xSntpFilter_t *.
+ * @param   pxSample: Pointer to the new sample.
+ *          This parameter can be a value of @ref const struct xSntpSample_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_filter_push( struct xSntpFilter_t * pxFilter, const struct xSntpSample_t * pxSample )
+{
+  struct xSntpSample_t xBest;
+  uint64_t             ullSquareSum = 0;
+  uint8_t              ucIndex;
+
+  /* Make sure that the clock filter and the sample are valid */
+  if( ( NULL == pxFilter ) || ( NULL == pxSample ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Write the sample on the ring, the oldest one is replaced */
+  pxFilter->samples[ pxFilter->head ] = *pxSample;
+  pxFilter->head = ( uint8_t )( ( pxFilter->head + 1 ) % exlibSNTP_FILTER_SIZE );
+
+  if( pxFilter->count < exlibSNTP_FILTER_SIZE )
+  {
+    pxFilter->count++;
+  }
+
+  /* Update the jitter, RMS of the offset differences with the minimum-delay sample */
+  ( void )sntpex_filter_best_get( pxFilter, &xBest );
+
+  for( ucIndex = 0; ucIndex < pxFilter->count; ucIndex++ )
+  {
+    int64_t llDiff = pxFilter->samples[ ucIndex ].offset - xBest.offset;
+
+    /* Saturated before the square, the products and their sum never overflow */
+    if( llDiff > exlibSNTP_FILTER_JITTER_CLAMP )
+    {
+      llDiff = exlibSNTP_FILTER_JITTER_CLAMP;
+    }
+    else if( llDiff < -exlibSNTP_FILTER_JITTER_CLAMP )
+    {
+      llDiff = -exlibSNTP_FILTER_JITTER_CLAMP;
+    }
+    else
+    {
+      /* Do Nothing : MISRA 15.7 */
+    }
+
+    ullSquareSum += ( uint64_t )llDiff * ( uint64_t )llDiff;
+  }
+
+  pxFilter->jitter = ( pxFilter->count > 1 ) ? ( int64_t )prv_filter_isqrt( ullSquareSum / ( pxFilter->count - 1 ) ) : 0;
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the minimum-delay sample of the clock filter.
+ * @param   pxFilter: Pointer to the clock filter.
+ *          This parameter can be a value of @ref const struct xSntpFilter_t *.
+ * @param   pxSample: Pointer to the filtered sample.
+ *          This parameter can be a value of @ref struct xSntpSample_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERROR when the filter is empty.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_filter_best_get( const struct xSntpFilter_t * pxFilter, struct xSntpSample_t * pxSample )
+{
+  uint8_t ucBest = 0;
+  uint8_t ucIndex;
+
+  /* Make sure that the clock filter and the sample are valid */
+  if( ( NULL == pxFilter ) || ( NULL == pxSample ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  if( pxFilter->count == 0 )
+  {
+    /* No sample yet, return the error status. */
+    return SNTPEX_ERROR;
+  }
+
+  /** @remark The samples with the lowest delay carry the lowest queuing error, on equal delay the
+   *  most recent sample is preferred */
+  for( ucIndex = 1; ucIndex < pxFilter->count; ucIndex++ )
+  {
+    const struct xSntpSample_t * p_sample = &pxFilter->samples[ ucIndex ];
+
+    if( ( p_sample->delay < pxFilter->samples[ ucBest ].delay ) ||
+        ( ( p_sample->delay == pxFilter->samples[ ucBest ].delay ) && ( p_sample->epoch > pxFilter->samples[ ucBest ].epoch ) ) )
+    {
+      ucBest = ucIndex;
+    }
+  }
+
+  *pxSample = pxFilter->samples[ ucBest ];
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+/** @} */
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+  * @{
+  */
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Integer square root (bit-by-bit method).
+ * @param   ullValue: Input value
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  Floor of the square root, this parameter can be a value of @ref uint64_t.
+ */
+#pragma optimize=speed
+__STATIC_INLINE uint64_t prv_filter_isqrt( uint64_t ullValue )
+{
+  uint64_t ullResult = 0;
+  uint64_t ullBit    = ( uint64_t )1 << 62;
+
+  while( ullBit > ullValue )
+  {
+    ullBit >>= 2;
+  }
+
+  while( ullBit != 0 )
+  {
+    if( ullValue >= ullResult + ullBit )
+    {
+      ullValue  -= ullResult + ullBit;
+      ullResult  = ( ullResult >> 1 ) + ullBit;
+    }
+    else
+    {
+      ullResult >>= 1;
+    }
+
+    ullBit >>= 2;
+  }
+
+  return ullResult;
+}
+/** @} */
+
+#endif /* exlibSNTP_CONFIG_FILTER */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
@@ -29,6 +29,15 @@
 /* Includes ----------------------------------------------------------------------*/
 #include "sntp_ex_lib_ti.h"
 
+/* Private macros ----------------------------------------------------------------*/
+/**
+ * @brief Statistics counter hook, compiled out without @ref exlibSNTP_CONFIG_STATS */
+#if ( exlibSNTP_CONFIG_STATS == 1 )
+  #define exlibSNTP_STATS_ADD( p_client, field, value )  ( ( p_client )->xStats.field += ( uint32_t )( value ) )
+#else
+  #define exlibSNTP_STATS_ADD( p_client, field, value )  ( ( void )0 )
+#endif
+
 /* Private function   ------------------------------------------------------------*/
 /**
  * @defgroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
@@ -65,17 +74,17 @@ static sntp_ud_t sFct_sntp_CloseConnection ( sntpex_client_handle_t * p_client )
 #pragma pack(1)
 
 /**
- * @brief   virtual socket.
- * @details It contain the handle/descriptor of the udp socket such as: type, event, df ... */ 
-static struct vsocket uvirtual_sock;
+ * @brief   Registered clients list.
+ * @details It contain the pointers of the initialized clients, the Spawn task dispatches
+ *          the asynchronous events to the client of the event socket @ref sntpex_eventTriggingFromISR */
+static sntpex_client_handle_t * volatile pg_client_registry[ exlibSNTP_CLIENT_MAX_NUMBER ];
 
 /**
- * @brief   Asynchrone Event stucture .
- * @details It contain event flag, SR Soft register and callback for user notification */ 
-volatile struct ux_sntpAsynchEvent xsntpAsynchEvent;
-
-/* pointer to the virtual table API */
-struct ud_op_vtable * pg_vtable_api;
+ * @brief   Host IRQ receive timestamp capture.
+ * @details Written from the host IRQ by @ref sntpex_rx_timestamp_capture_from_irq, the sequence is odd while
+ *          the timestamp is updated so the readers never use a torn 64-bit value. */
+static volatile uint32_t ulg_irq_capture_sequence;
+static volatile uint64_t ullg_irq_capture_timestamp;
 
 /**
  * @brief   local state api table.
@@ -114,25 +123,129 @@ static const struct local_state_api_t sntp_sapi[ UD_SNTP_CLIENT_STATE_COMPLETE ]
  *        Private functions used by @ref sntp_ex_lib_ti.c .
  * @note  All these functions is declared as __STATIC_INLINE to force compiler inligning.
  *       + @ref prv_utility_ntp_to_epoch
+ *       + @ref prv_utility_ntp_to_epoch_ns
+ *       + @ref prv_utility_ntp_to_unix_seconds
  *       + @ref prv_utility_build_request
  *       + @ref prv_utility_frac_to_usecs
+ *       + @ref prv_utility_frac_to_nsecs
  * @{
  */
 /**
- * @brief Convert Fraction part from NTP fraction to EPOCH subsecond-fraction */
+ * @brief Convert NTP timestamp (seconds, fraction) to 64-UNIX time in microseconds */
 __STATIC_INLINE uint64_t  prv_utility_ntp_to_epoch ( uint32_t ulSeconds, uint32_t ulFraction );
+/**
+ * @brief Convert NTP timestamp (seconds, fraction) to 64-UNIX time in nanoseconds */
+__STATIC_INLINE uint64_t  prv_utility_ntp_to_epoch_ns( uint32_t ulSeconds, uint32_t ulFraction );
+/**
+ * @brief Convert NTP seconds to UNIX seconds, including the NTP era 1 (2036-2104) */
+__STATIC_INLINE uint64_t  prv_utility_ntp_to_unix_seconds( uint32_t ulSeconds );
 /**
  * @brief Build the sntp request. */
 __STATIC_INLINE sntp_ud_t prv_utility_build_request( sntpex_client_handle_t *p_client, void * p_payload );
 /**
- * @brief Convert fraction to microseconds (Formula is inspired from NETX duo stack). */
+ * @brief Convert fraction to microseconds (single 32x32 fixed-point multiply). */
 __STATIC_INLINE uint32_t  prv_utility_frac_to_usecs( uint32_t fraction );
+/**
+ * @brief Convert fraction to nanoseconds (single 32x32 fixed-point multiply). */
+__STATIC_INLINE uint32_t  prv_utility_frac_to_nsecs( uint32_t fraction );
 /**
  * @brief Register event and callback using @ref exlibSNTP_SOFTSR_RECV_BIT and @ref exlibSNTP_SOFTSR_SEND_BIT */
-__STATIC_INLINE void      prv_utility_register_event  ( uint8_t eventbitField, pf_eventCallback  cb );
+__STATIC_INLINE void      prv_utility_register_event  ( sntpex_client_handle_t * p_client, uint8_t eventbitField, pf_eventCallback  cb );
 /**
  * @brief Unregister event and callback using @ref exlibSNTP_SOFTSR_RECV_BIT and @ref exlibSNTP_SOFTSR_SEND_BIT */
-__STATIC_INLINE void      prv_utility_unregister_event( uint8_t eventbitField );
+__STATIC_INLINE void      prv_utility_unregister_event( sntpex_client_handle_t * p_client, uint8_t eventbitField );
+/**
+ * @brief Store the Spawn event of the client socket on its ring */
+__STATIC_INLINE void      prv_utility_dispatch_event  ( sntpex_client_handle_t * p_client, uint8_t ucType );
+/**
+ * @brief Move the Spawn events of the ring to the client task, and take the oldest receive or the last send timestamp */
+__STATIC_INLINE void      prv_utility_event_collect   ( sntpex_client_handle_t * p_client );
+__STATIC_INLINE uint64_t  prv_utility_rx_event_take   ( sntpex_client_handle_t * p_client );
+__STATIC_INLINE uint64_t  prv_utility_tx_event_take   ( sntpex_client_handle_t * p_client );
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+/**
+ * @brief Find the in-flight server whose originate nonce matches the received reply */
+__STATIC_INLINE int8_t    prv_utility_match_server  ( sntpex_client_handle_t * p_client, const void * p_payload, const uint8_t * pucPending );
+#endif
+/**
+ * @brief Generate the originate nonce of a request, and compare it in constant time */
+__STATIC_INLINE void      prv_utility_nonce_generate( sntpex_client_handle_t * p_client, NtpTimestamp * pxNonce );
+__STATIC_INLINE uint8_t   prv_utility_nonce_equal   ( const NtpTimestamp * pxNonceA, const NtpTimestamp * pxNonceB );
+/**
+ * @brief Release the connection after a failed request, the persistent socket is only closed on socket error */
+__STATIC_INLINE void      prv_utility_release_connection( sntpex_client_handle_t * p_client, sntp_ud_t xLibReturnCode );
+#if ( exlibSNTP_CONFIG_IPV6 == 1 ) || ( exlibSNTP_CONFIG_TIMER_WHEEL == 1 )
+/**
+ * @brief Cancel the request started by @ref sntpex_client_step , the reply is not expected anymore */
+__STATIC_INLINE void      prv_utility_request_cancel    ( sntpex_client_handle_t * p_client );
+#endif
+#if ( exlibSNTP_CONFIG_TIMER_WHEEL == 1 )
+/**
+ * @brief Remove the completed request from its timer wheel and report its status */
+__STATIC_INLINE void      prv_utility_wheel_complete    ( sntpex_client_handle_t * p_client, sntp_ud_t xStatus, pf_requestCallback cb );
+#endif
+/**
+ * @brief Switch to the next bound interface when the request failed on the socket itself */
+__STATIC_INLINE void      prv_utility_interface_failover( sntpex_client_handle_t * p_client, sntp_ud_t xLibReturnCode );
+/**
+ * @brief Feed the clock filter and the clock discipline with the sample of the completed request */
+__STATIC_INLINE void      prv_utility_filter_update    ( sntpex_client_handle_t * p_client, const SlNetSock_Addr_t * pxSource );
+__STATIC_INLINE void      prv_utility_sample_update    ( sntpex_client_handle_t * p_client, const struct xSntpSample_t * pxSample, uint8_t ucLi );
+/**
+ * @brief Schedule the next request of the client, compiled out without @ref exlibSNTP_CONFIG_POLL */
+__STATIC_INLINE void      prv_utility_poll_update      ( sntpex_client_handle_t * p_client, sntp_ud_t xStatus, uint32_t ulKissCode, uint32_t ulTick );
+#if ( exlibSNTP_CONFIG_TIMESCALE == 1 )
+/**
+ * @brief Fold the passed leaps into the clock, before the sample of the new scale is used */
+__STATIC_INLINE void      prv_utility_leap_fold        ( sntpex_client_handle_t * p_client, uint64_t ullRawTime );
+#endif
+#if ( exlibSNTP_CONFIG_RESPONDER == 1 )
+/**
+ * @brief Record the server of the last sample, advertised by the responder mode */
+__STATIC_INLINE void      prv_utility_sync_source_set  ( sntpex_client_handle_t * p_client, const struct xSntpServerInfo_t * pxServer,
+                                                         const SlNetSock_Addr_t * pxSource );
+#endif
+#if ( exlibSNTP_CONFIG_BROADCAST == 1 ) || ( exlibSNTP_CONFIG_RESPONDER == 1 )
+/**
+ * @brief Create the socket bound to the NTP port, used by the broadcast and the responder modes */
+__STATIC_INLINE sntp_ud_t prv_utility_listen_open      ( sntpex_client_handle_t * p_client, uint16_t usFamily );
+/**
+ * @brief Take the receive event of the datagram read on the listening socket, then re-arm the socket */
+__STATIC_INLINE uint64_t  prv_utility_listen_event_take( sntpex_client_handle_t * p_client );
+#endif
+/**
+ * @brief Export the server header fields of a decoded reply */
+__STATIC_INLINE void      prv_utility_server_info_get  ( const struct xSntpPacket_t * pxPacket, struct xSntpServerInfo_t * pxInfo );
+/**
+ * @brief Discard the stale replies queued on a reused socket */
+__STATIC_INLINE void      prv_utility_flush_socket     ( sntpex_client_handle_t * p_client );
+/**
+ * @brief Select the most accurate receive timestamp (T4) of the received reply */
+__STATIC_INLINE uint64_t  prv_utility_rx_timestamp_get ( sntpex_client_handle_t * p_client, uint64_t ullSpawnTs );
+/**
+ * @brief Send the request and capture its transmit timestamp (T1) on the actual transmission */
+__STATIC_INLINE int32_t   prv_utility_send_to          ( sntpex_client_handle_t * p_client, SlNetSock_Addr_t * p_addr, uint16_t usAddrLength, uint64_t * pullOriginateTs );
+/**
+ * @brief Read the host IRQ capture, consistent with its sequence */
+__STATIC_INLINE uint32_t  prv_utility_irq_capture_read ( uint64_t * pullTimestamp );
+/**
+ * @brief Add/Remove client to/from the registered clients list */
+__STATIC_INLINE sntp_ud_t prv_utility_client_register  ( sntpex_client_handle_t * p_client );
+__STATIC_INLINE void      prv_utility_client_unregister( sntpex_client_handle_t * p_client );
+/**
+ * @brief Check if the client is on the registered clients list, i.e. initialized and not deinitialized */
+__STATIC_INLINE uint8_t   prv_utility_client_registered( const sntpex_client_handle_t * p_client );
+/**
+ * @brief Execute the function of the current state, its duration feeds the statistics block */
+__STATIC_INLINE sntp_ud_t prv_utility_state_exec       ( sntpex_client_handle_t * p_client );
+/**
+ * @brief Get the length of a net address from its family, 0 when the family is not supported */
+__STATIC_INLINE uint16_t  prv_utility_address_length   ( const SlNetSock_Addr_t * pxAddress );
+#if ( exlibSNTP_CONFIG_BROADCAST == 1 )
+/**
+ * @brief Compare the family and the host address of two net addresses, the ports are ignored */
+__STATIC_INLINE uint8_t   prv_utility_address_equal    ( const sntpex_sockaddr_t * pxFirst, const sntpex_sockaddr_t * pxSecond );
+#endif
 /**
  * @}
  */
@@ -147,18 +260,61 @@ __STATIC_INLINE void      prv_utility_unregister_event( uint8_t eventbitField );
  *       + @ref sntpex_clientInitialization
  *       + @ref sntpex_client_deinitialization
  *       + @ref sntpex_dns_host_by_name_get
+ *       + @ref sntpex_client_set_server_name
  *       + @ref sntpex_SetClientTimeout
  *       + @ref sntpex_client_bind_to_interface
+ *       + @ref sntpex_client_add_interface
+ *       + @ref sntpex_client_active_interface_get
  *       + @ref sntpex_client_set_server_address
+ *       + @ref sntpex_client_add_server_address
  *       + @ref sntpex_client_timestamp_get
+ *       + @ref sntpex_client_multi_timestamp_get
+ *       + @ref sntpex_client_burst_timestamp_get
+ *       + @ref sntpex_client_step
+ *       + @ref sntpex_client_poll
+ *       + @ref sntpex_client_dual_stack_timestamp_get
+ *       + @ref sntpex_client_wheel_start
+ *       + @ref sntpex_timer_wheel_poll
+ *       + @ref sntpex_client_set_event_callback
+ *       + @ref sntpex_client_broadcast_calibrate
+ *       + @ref sntpex_client_broadcast_listen
+ *       + @ref sntpex_client_broadcast_step
+ *       + @ref sntpex_client_broadcast_stop
+ *       + @ref sntpex_client_responder_start
+ *       + @ref sntpex_client_responder_step
+ *       + @ref sntpex_client_responder_stop
+ *       + @ref sntpex_client_set_persistent_socket
+ *       + @ref sntpex_client_auth_key_add
+ *       + @ref sntpex_client_auth_key_select
+ *       + @ref sntpex_client_state_save
+ *       + @ref sntpex_client_state_restore
+ *       + @ref sntpex_client_stats_get
+ *       + @ref sntpex_client_stats_reset
+ *       + @ref sntpex_client_clock_offset_get
+ *       + @ref sntpex_client_time_get
+ *       + @ref sntpex_client_timescale_attach
+ *       + @ref sntpex_client_timescale_time_get
+ *       + @ref sntpex_now_attach
+ *       + @ref sntpex_now_detach
+ *       + @ref sntpex_now
+ *       + @ref sntpex_client_frequency_get
+ *       + @ref sntpex_client_set_poll_range
+ *       + @ref sntpex_client_time_until_next_sync
+ *       + @ref sntpex_ntp_to_unix64_us
+ *       + @ref sntpex_ntp_to_unix64_ns
+ *       + @ref sntpex_ntp_to_ntp64
+ *       + @ref sntpex_unix64_us_to_ntp
  *       + @ref sntpex_client_Kiss_code_get
  *       + @ref sntpex_eventTriggingFromISR
+ *       + @ref sntpex_rx_timestamp_capture_from_irq
+ *       + @ref sntpex_client_rx_timestamp_source_get
  * @{
  */
 
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
  * @brief   Initialize the SNTP Client and set default configurations.
+ * @remark  A live client is deinitialized first, see @ref sntpex_client_deinitialization .
  * @param   p_client: Pointer to the sntp client handle
  *          This parameter can be a value of @ref sntpex_client_handle_t *.
  * @param   p_vtable_api: Pointer to the user defined virtual table APIs.
@@ -175,26 +331,36 @@ sntp_ud_t sntpex_clientInitialization( sntpex_client_handle_t * p_client, struct
     return SNTPEX_ERR_NULL_PTR;
   }
 
-  /* Clear SNTP client context and virtual socket handle */
+  /** @remark A live client is released before its context is cleared : its timer is unlinked from the
+   *  wheel, its persistent socket is closed and the fast time is detached from it */
+  if( 0u != prv_utility_client_registered( p_client ) )
+  {
+    sntpex_client_deinitialization( p_client );
+  }
+  else
+  {
+    /* The context is not initialized yet, Do Nothing : MISRA 15.7 */
+  }
+
+  /* Clear SNTP client context, including the client virtual socket and event storage */
   ( void )memset( p_client, 0, sizeof( sntpex_client_handle_t ) );
-  ( void )memset( &uvirtual_sock, 0, sizeof( struct vsocket ) );
 
   /* Initialize simplelink virtual socket */
-  uvirtual_sock.descriptor.event          = exlibPOLLIN_EVENT;
-  uvirtual_sock.descriptor.type           = SLNETSOCK_SOCK_DGRAM;
-  uvirtual_sock.descriptor.protocol       = SLNETSOCK_PROTO_UDP;
-  uvirtual_sock.descriptor.InAddLength    =  0;
-  uvirtual_sock.fd                        = -1;
+  p_client->xSocket.descriptor.event          = exlibPOLLIN_EVENT;
+  p_client->xSocket.descriptor.type           = SLNETSOCK_SOCK_DGRAM;
+  p_client->xSocket.descriptor.protocol       = SLNETSOCK_PROTO_UDP;
+  p_client->xSocket.descriptor.InAddLength    =  0;
+  p_client->xSocket.fd                        = -1;
 
   /* configure virtual socket Default timeout */
-  uvirtual_sock.descriptor.timeout.tv_sec  = ( exlibSNTP_CLIENT_DEFAULT_TIMEOUT/1000 );
-  uvirtual_sock.descriptor.timeout.tv_usec = ( exlibSNTP_CLIENT_DEFAULT_TIMEOUT%1000 )*1000;
+  p_client->xSocket.descriptor.timeout.tv_sec  = ( exlibSNTP_CLIENT_DEFAULT_TIMEOUT/1000 );
+  p_client->xSocket.descriptor.timeout.tv_usec = ( exlibSNTP_CLIENT_DEFAULT_TIMEOUT%1000 )*1000;
 
   /* Normalize time stamp value */
-  if(uvirtual_sock.descriptor.timeout.tv_usec >= 1000000)
+  if(p_client->xSocket.descriptor.timeout.tv_usec >= 1000000)
   {
-    uvirtual_sock.descriptor.timeout.tv_sec += 1;
-    uvirtual_sock.descriptor.timeout.tv_usec -= 1000000;
+    p_client->xSocket.descriptor.timeout.tv_sec += 1;
+    p_client->xSocket.descriptor.timeout.tv_usec -= 1000000;
   }
   else
   {
@@ -203,16 +369,32 @@ sntp_ud_t sntpex_clientInitialization( sntpex_client_handle_t * p_client, struct
   
   p_client->timeout    = exlibSNTP_CLIENT_DEFAULT_TIMEOUT;
 
+#if ( exlibSNTP_CONFIG_POLL == 1 )
+  /* Default poll range, the first request is due immediately */
+  ( void )sntpex_poll_reset( &p_client->xPoll, exlibSNTP_POLL_MIN_EXPONENT, exlibSNTP_POLL_MAX_EXPONENT );
+#endif
+
   /* Initialize pointers */
-  p_client->sock       = &uvirtual_sock;
+  p_client->sock       = &p_client->xSocket;
   p_client->vtable_api = *p_vtable_api;
-  pg_vtable_api        = p_vtable_api;
+
+  /* Seed the software nonce generator, only used when no random source is provided */
+  p_client->ullNonceState = p_client->vtable_api.get_unix_timestamp() ^
+                            ( ( uint64_t )p_client->vtable_api.get_os_tick() << 32 ) ^ ( uint64_t )( uintptr_t )p_client;
 
   /* unregister receive event from ISR */
-  prv_utility_unregister_event( exlibSNTP_SOFTSR_RECV_BIT );
+  prv_utility_unregister_event( p_client, exlibSNTP_SOFTSR_RECV_BIT );
   
   /* unregister receive event from ISR */
-  prv_utility_unregister_event( exlibSNTP_SOFTSR_SEND_BIT );
+  prv_utility_unregister_event( p_client, exlibSNTP_SOFTSR_SEND_BIT );
+
+  /* Publish the client to the Spawn dispatching, once its context is fully initialized */
+  if( SNTPEX_SUCCESS != prv_utility_client_register( p_client ) )
+  {
+    /* No free slot on the registered clients list, Return the error status. */
+    p_client->sock = NULL;
+    return SNTPEX_ERR_FAULT_INIT;
+  }
 
   /* Change library state to opened */
   p_client->state = UD_SNTP_CLIENT_STATE_OPEN;
@@ -224,123 +406,224 @@ sntp_ud_t sntpex_clientInitialization( sntpex_client_handle_t * p_client, struct
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
  * @brief   Handle sntp events from ISR.
- * @param   None.
+ * @remark  The event is only given to the client which owns the socket, so the clients in flight at the
+ *          same time (dual-stack race, timer wheel, responder) never take the timestamps of each other.
+ * @param   sd: Socket descriptor of the event.
+ *          This parameter can be a value of @ref int16_t.
+ * @param   ucEvent: @ref exlibSNTP_SOFTSR_RECV_BIT on a datagram arrival, @ref exlibSNTP_SOFTSR_SEND_BIT on a transmission.
+ *          This parameter can be a value of @ref uint8_t.
  * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
  */
 #pragma optimize=speed
-sntp_ud_t sntpex_eventTriggingFromISR( void )
+sntp_ud_t sntpex_eventTriggingFromISR( int16_t sd, uint8_t ucEvent )
 {
-  /* Make sure the virtual table APIs and event register from ISR are valid */
-  if( ( NULL == pg_vtable_api ) ||( xsntpAsynchEvent.event.SR == 0 ) )
+  sntp_ud_t xLibReturnCode = SNTPEX_ERR_FAULT_INIT;
+  uint8_t   ucIndex;
+
+  /* Make sure the event type is a single known event */
+  if( ( ucEvent != exlibSNTP_SOFTSR_RECV_BIT ) && ( ucEvent != exlibSNTP_SOFTSR_SEND_BIT ) )
   {
-    /* Exit. event is not registred or lib is not initialized yet */
-    return SNTPEX_ERR_FAULT_INIT;
+    /* Return the error status. */
+    return SNTPEX_ERROR;
   }
 
-  if( xsntpAsynchEvent.event.SR && exlibSNTP_SOFTSR_RECV_BIT )
+  /* Dispatch the event to the registered client of the socket */
+  for( ucIndex = 0; ucIndex < exlibSNTP_CLIENT_MAX_NUMBER; ucIndex++ )
   {
-    /* Clear event from SR Soft register */
-    xsntpAsynchEvent.event.SR  &= ~(exlibSNTP_SOFTSR_RECV_BIT); 
+    sntpex_client_handle_t * p_client = pg_client_registry[ ucIndex ];
 
-    /* save unix 64 timestamp, method is a pointer to the user get_timestamp APIs @ref get_unix_timestamp */  
-    xsntpAsynchEvent.timestamp = pg_vtable_api->get_unix_timestamp();
-
-    if( xsntpAsynchEvent.event_cb != NULL )
+    /* Make sure the client is registered, owns the socket and waits for this event */
+    if( ( NULL != p_client ) && ( NULL != p_client->sock ) && ( p_client->sock->fd == ( int )sd ) &&
+        ( ( p_client->xAsynchEvent.event.SR & ucEvent ) != 0 ) )
     {
-      /* execute registred library callback */
-      xsntpAsynchEvent.event_cb( exlibSNTP_SOFTSR_RECV_BIT ); 
+      prv_utility_dispatch_event( p_client, ucEvent );
+
+      /* The event is handled, a socket is owned by a single client */
+      xLibReturnCode = SNTPEX_SUCCESS;
+      break;
     }
   }
-  else if( xsntpAsynchEvent.event.SR && exlibSNTP_SOFTSR_SEND_BIT )
-  {
-    /* Clear event from SR Soft register */
-    xsntpAsynchEvent.event.SR  &= ~(exlibSNTP_SOFTSR_SEND_BIT); 
 
-    /* save unix 64 timestamp, method is a pointer to the user get_timestamp APIs @ref get_unix_timestamp */  
-    xsntpAsynchEvent.timestamp = pg_vtable_api->get_unix_timestamp();
+  /* return status code, SNTPEX_ERR_FAULT_INIT when no client waits for the event */
+  return xLibReturnCode;
+}
 
-    if( xsntpAsynchEvent.event_cb != NULL )
-    {
-      /* execute registred library callback */
-      xsntpAsynchEvent.event_cb( exlibSNTP_SOFTSR_SEND_BIT );
-    }
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   capture the receive timestamp from the host IRQ (e.g. timer capture of the host interrupt line).
+ * @remark  The capture is preferred to the Spawn task timestamp, it does not include the Spawn queue latency.
+ *          It is only used when it is the single capture taken for the received datagram.
+ * @param   ullTimestamp: 64-UNIX time of the host interrupt.
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  None.
+ */
+#pragma optimize=speed
+void sntpex_rx_timestamp_capture_from_irq( uint64_t ullTimestamp )
+{
+  /* odd sequence, the timestamp is being updated */
+  ulg_irq_capture_sequence++;
+  exlibSNTP_MEMORY_BARRIER();
+
+  ullg_irq_capture_timestamp = ullTimestamp;
+
+  /* even sequence, the timestamp is published */
+  exlibSNTP_MEMORY_BARRIER();
+  ulg_irq_capture_sequence++;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   Resolve NTP host name, the first returned address is used with the NTP port.
+ * @param   pxInterfaceIndex: Pointer to the interface used for the resolution.
+ *          This parameter can be a value of @ref InterfaceIndex_t *.
+ * @param   pcHostname: Pointer to the NTP Host name server.
+ *          This parameter can be a value of @ref const char *.
+ * @param   pxhost_address: Pointer to net address structure, a @ref SlNetSock_AddrIn6_t storage is required for IPV6.
+ *          This parameter can be a value of @ref SlNetSock_Addr_t *.
+ * @param   Family: Address family (IPV4/IPV6).
+ *          This parameter can be a value of @ref uint8_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_dns_host_by_name_get( InterfaceIndex_t * pxInterfaceIndex ,const char *pcHostname, SlNetSock_Addr_t * pxhost_address, uint8_t Family)
+{
+  /* Make sure that the interface, the host-name and address structure are valid */
+  if( ( NULL == pxInterfaceIndex ) || ( NULL == pcHostname ) || ( NULL == pxhost_address ))
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
   }
-  else
+
+  struct xSntpDnsEntry_t xEntry;
+  uint16_t               usAddressLen = 0;
+
+  /* Obtain the IP Address of machine on network, by machine name */
+  sntp_ud_t xLibReturnCode = sntpex_dns_resolve( &xEntry, pcHostname, Family, 0 );
+
+  if( xLibReturnCode == SNTPEX_SUCCESS )
   {
-    /* Do Nothing : MISRA 15.7 */
+    *pxInterfaceIndex = xEntry.interface;
+
+    /* The storage size is given by the family, as documented for IPV6 */
+    xLibReturnCode = sntpex_dns_address_get( &xEntry, 0, pxhost_address,
+                                             ( Family == SLNETSOCK_AF_INET6 ) ? sizeof( SlNetSock_AddrIn6_t ) : sizeof( SlNetSock_AddrIn_t ),
+                                             &usAddressLen );
   }
 
-  /* return status code*/
-  return SNTPEX_SUCCESS;
+  /* Return the error status. */
+  return xLibReturnCode;
 }
 
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
- * @brief   Resolve NTP host name.
+ * @brief   set the servers list from a server name, every resolved address becomes a server.
+ *          The resolution is cached, and the pool members are rotated on every call.
  * @param   p_client: Pointer to the sntp client handle
  *          This parameter can be a value of @ref sntpex_client_handle_t *.
  * @param   pcHostname: Pointer to the NTP Host name server.
- *          This parameter can be a value of @ref const char *.   
- * @param   pxhost_address: Pointer to net address structure.
- *          This parameter can be a value of @ref SlNetSock_Addr_t *.  
- * @param   pxhost_address: Address family (IPV4/IPV6).
- *          This parameter can be a value of @ref uint8_t. 
+ *          This parameter can be a value of @ref const char *.
+ * @param   Family: Address family (IPV4/IPV6).
+ *          This parameter can be a value of @ref uint8_t.
  * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
  */
 #pragma optimize=speed
-sntp_ud_t sntpex_dns_host_by_name_get( InterfaceIndex_t * pxInterfaceIndex ,const char *pcHostname, SlNetSock_Addr_t * pxhost_address, uint8_t Family)
+sntp_ud_t sntpex_client_set_server_name( sntpex_client_handle_t *p_client, const char * pcHostname, uint8_t Family )
 {
-  /* Make sure that the host-name and address structure are valid */
-  if( ( NULL == pcHostname ) || ( NULL == pxhost_address ))
+  /* Make sure that the SNTP client context and the host-name are valid */
+  if( ( NULL == p_client ) || ( NULL == pcHostname ) )
   {
     /* Return the error status. */
     return SNTPEX_ERR_NULL_PTR;
   }
 
-  sntp_ud_t xLibReturnCode = SNTPEX_SUCCESS;
-  uint32_t aHostAddress[4] = { 0, };
-  uint16_t usAddressLen    = 1;
-
-  /* Obtain the IP Address of machine on network, by machine name */
-  *pxInterfaceIndex = SlNetUtil_getHostByName( 0, ( char * )pcHostname, strlen( pcHostname ), aHostAddress, &usAddressLen, ( uint8_t )Family );
+  struct xSntpDnsEntry_t * p_entry        = NULL;
+  sntp_ud_t                xLibReturnCode = SNTPEX_SUCCESS;
+  uint32_t                 ulNow          = p_client->vtable_api.get_os_tick();
+  uint8_t                  ucIndex;
 
-  if( *pxInterfaceIndex > 0 )
+#if ( exlibSNTP_CONFIG_DNS_CACHE == 1 )
+  /* Look for a valid resolution, otherwise the free or the oldest entry is resolved again */
+  for( ucIndex = 0; ( ucIndex < exlibSNTP_DNS_CACHE_ENTRIES ) && ( NULL == p_entry ); ucIndex++ )
   {
-    switch ( Family )
-    {
-    case SLNETSOCK_AF_INET: /* V4 host address */
+    if( sntpex_dns_entry_is_valid( &p_client->xDnsCache[ ucIndex ], pcHostname, Family, ulNow ) )
     {
-      SlNetSock_AddrIn_t * pxhost_address_v4  = ( SlNetSock_AddrIn_t * )pxhost_address;
-
-      pxhost_address_v4->sin_family      = SLNETSOCK_AF_INET;
-      pxhost_address_v4->sin_addr.s_addr = exlibSLNETUTIL_HTONL(aHostAddress[0]);
+      p_entry = &p_client->xDnsCache[ ucIndex ];
     }
-    break;
+  }
 
-    case SLNETSOCK_AF_INET6: /* V4 host address */
+  if( NULL == p_entry )
+  {
+    p_entry = &p_client->xDnsCache[ 0 ];
+
+    for( ucIndex = 1; ucIndex < exlibSNTP_DNS_CACHE_ENTRIES; ucIndex++ )
     {
-      SlNetSock_AddrIn6_t * pxhost_address_v6  = ( SlNetSock_AddrIn6_t * )&pxhost_address;
+      struct xSntpDnsEntry_t * p_candidate = &p_client->xDnsCache[ ucIndex ];
 
-      pxhost_address_v6->sin6_family                 = SLNETSOCK_AF_INET6;
-      pxhost_address_v6->sin6_addr._S6_un._S6_u32[0] = exlibSLNETUTIL_HTONL(aHostAddress[0]);
-      pxhost_address_v6->sin6_addr._S6_un._S6_u32[1] = exlibSLNETUTIL_HTONL(aHostAddress[1]);
-      pxhost_address_v6->sin6_addr._S6_un._S6_u32[2] = exlibSLNETUTIL_HTONL(aHostAddress[2]);
-      pxhost_address_v6->sin6_addr._S6_un._S6_u32[3] = exlibSLNETUTIL_HTONL(aHostAddress[3]);
+      if( ( p_entry->count != 0 ) &&
+          ( ( p_candidate->count == 0 ) || ( ( ulNow - p_candidate->resolvedTick ) > ( ulNow - p_entry->resolvedTick ) ) ) )
+      {
+        p_entry = p_candidate;
+      }
     }
-    break;
 
-    default:
+    xLibReturnCode = sntpex_dns_resolve( p_entry, pcHostname, Family, ulNow );
+
+#if ( exlibSNTP_CONFIG_STATS == 1 )
+    /* SlNetUtil_getHostByName is blocking, the resolution time is part of the sync time */
+    sntpex_stats_histogram_add( &p_client->xStats.xDns, p_client->vtable_api.get_os_tick() - ulNow );
+#endif
+
+    if( xLibReturnCode != SNTPEX_SUCCESS )
+    {
       /* Return the error status. */
-      xLibReturnCode = SNTPEX_ERR_DNS_RESOLVE;
-      break;
+      return xLibReturnCode;
     }
   }
-  else
+#else
+  /* Without the names cache, the name is resolved on every call and its first address is used first */
+  struct xSntpDnsEntry_t xEntry;
+
+  p_entry        = &xEntry;
+  xLibReturnCode = sntpex_dns_resolve( p_entry, pcHostname, Family, ulNow );
+
+#if ( exlibSNTP_CONFIG_STATS == 1 )
+  /* SlNetUtil_getHostByName is blocking, the resolution time is part of the sync time */
+  sntpex_stats_histogram_add( &p_client->xStats.xDns, p_client->vtable_api.get_os_tick() - ulNow );
+#endif
+
+  if( xLibReturnCode != SNTPEX_SUCCESS )
   {
     /* Return the error status. */
-    xLibReturnCode = SNTPEX_ERR_DNS_RESOLVE;
+    return xLibReturnCode;
+  }
+#endif
+
+  /* Every resolved address becomes a server, starting from the rotated one */
+  for( ucIndex = 0; ( ucIndex < p_entry->count ) && ( ucIndex < exlibSNTP_CLIENT_MAX_SERVERS ) && ( xLibReturnCode == SNTPEX_SUCCESS ); ucIndex++ )
+  {
+    sntpex_sockaddr_t xAddress;
+    uint16_t          usAddressLen = 0;
+
+    xLibReturnCode = sntpex_dns_address_get( p_entry, ( uint8_t )( ( p_entry->rotation + ucIndex ) % p_entry->count ),
+                                             &xAddress, sizeof( xAddress ), &usAddressLen );
+
+    if( xLibReturnCode == SNTPEX_SUCCESS )
+    {
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+      xLibReturnCode = ( ucIndex == 0 ) ? sntpex_client_set_server_address( p_client, &xAddress.sa ) :
+                                          sntpex_client_add_server_address( p_client, &xAddress.sa );
+#else
+      /* The servers list holds one server, the rotated pool member */
+      xLibReturnCode = sntpex_client_set_server_address( p_client, &xAddress.sa );
+#endif
+    }
   }
 
+#if ( exlibSNTP_CONFIG_DNS_CACHE == 1 )
+  /* The next call starts from the next pool member */
+  p_entry->rotation = ( uint8_t )( ( p_entry->rotation + 1 ) % p_entry->count );
+#endif
+
   /* Return the error status. */
   return xLibReturnCode;
 }
@@ -374,10 +657,10 @@ sntp_ud_t sntpex_SetClientTimeout( sntpex_client_handle_t * p_client, uint32_t t
     p_client->sock->descriptor.timeout.tv_usec = ( timeout%1000 )*1000;
     
     /* Normalize time stamp value */
-    if(uvirtual_sock.descriptor.timeout.tv_usec >= 1000000)
+    if(p_client->sock->descriptor.timeout.tv_usec >= 1000000)
     {
-      uvirtual_sock.descriptor.timeout.tv_sec += 1;
-      uvirtual_sock.descriptor.timeout.tv_usec -= 1000000;
+      p_client->sock->descriptor.timeout.tv_sec += 1;
+      p_client->sock->descriptor.timeout.tv_usec -= 1000000;
     }
     else
     {
@@ -392,10 +675,11 @@ sntp_ud_t sntpex_SetClientTimeout( sntpex_client_handle_t * p_client, uint32_t t
 
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
- * @brief   bind client to interface.
+ * @brief   bind client to interface, the interfaces list is replaced by the given interface.
+ *          The socket is rebuilt on the new interface by the next request.
  * @param   p_client: Pointer to the sntp client handle
  *          This parameter can be a value of @ref sntpex_client_handle_t *.
- * @param   interface: Pointer to the interface.
+ * @param   interface: Pointer to the interface (SlNetIf identifier), NULL or 0 unbinds the client.
  *          This parameter can be a value of @ref InterfaceIndex_t *. 
  * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
  */
@@ -409,17 +693,81 @@ sntp_ud_t sntpex_client_bind_to_interface( sntpex_client_handle_t *p_client, Int
     return SNTPEX_ERR_NULL_PTR;
   }
 
-  /** @remark FUTURE IMPLEMENTATION
-   *  Bind the SNTP client to a particular network interface, to make sure the socket is in an unbound state.*/
+  /** @remark The socket is created on @ref p_client->interface , the persistent socket is rebuilt by
+   *  @ref sFct_sntp_OpenConnection as soon as the interface does not match its creation interface */
+  p_client->ucInterfaceActive = 0;
+
+  if( ( NULL == pxInterfaceIndex ) || ( *pxInterfaceIndex == 0 ) )
+  {
+    /* Unbound client, the stack selects the interface */
+    p_client->ucInterfaceCount = 0;
+    p_client->interface        = 0;
+  }
+  else
+  {
+    p_client->xInterfaceList[ 0 ] = *pxInterfaceIndex;
+    p_client->ucInterfaceCount    = 1;
+    p_client->interface           = *pxInterfaceIndex;
+  }
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   add a failover interface, used after the already bound ones.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   xInterface: Interface (SlNetIf identifier).
+ *          This parameter can be a value of @ref InterfaceIndex_t.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERR_FAULT_INIT when the interfaces list is full.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_add_interface( sntpex_client_handle_t *p_client, InterfaceIndex_t xInterface )
+{
+  /* Make sure the SNTP client context is valid */
+  if( NULL == p_client )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Make sure the interface is valid and the interfaces list is not full */
+  if( ( xInterface == 0 ) || ( p_client->ucInterfaceCount >= exlibSNTP_CLIENT_MAX_INTERFACES ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_FAULT_INIT;
+  }
+
+  p_client->xInterfaceList[ p_client->ucInterfaceCount ] = xInterface;
+
+  /* The first interface of an unbound client is used immediately */
+  if( p_client->ucInterfaceCount == 0 )
+  {
+    p_client->ucInterfaceActive = 0;
+    p_client->interface         = xInterface;
+  }
 
-  /* Avoid compilation warnings with restricted compiler */
-  ( void )( p_client );
-  ( void )( pxInterfaceIndex );
+  p_client->ucInterfaceCount++;
 
   /* Return the error status. */
   return SNTPEX_SUCCESS;
 }
 
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the interface used by the next request.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  Interface (SlNetIf identifier), 0 when the client is not bound.
+ */
+#pragma optimize=speed
+InterfaceIndex_t sntpex_client_active_interface_get( sntpex_client_handle_t *p_client )
+{
+  return ( NULL == p_client ) ? 0 : p_client->interface;
+}
+
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
  * @brief   set server address and port.
@@ -439,30 +787,89 @@ sntp_ud_t sntpex_client_set_server_address(sntpex_client_handle_t *p_client, con
     return SNTPEX_ERR_NULL_PTR;
   }
 
-  ( void )memcpy( &p_client->sock->descriptor.SocketAddr , serverIpAddr, sizeof( SlNetSock_Addr_t ) );
+  /* Make sure the SNTP client is initialized */
+  if( NULL == p_client->sock )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_FAULT_INIT;
+  }
+
+  /** @remark The address is copied with the length of its family, a @ref SlNetSock_AddrIn6_t is larger
+   *  than @ref SlNetSock_Addr_t */
+  uint16_t usAddressLength = prv_utility_address_length( serverIpAddr );
 
-  if ( serverIpAddr->sa_family == SLNETSOCK_AF_INET)
+  if( usAddressLength == 0 )
   {
-    /* setting v4 address length */
-    p_client->sock->descriptor.InAddLength = sizeof( SlNetSock_AddrIn_t );
+    /* Return the error status. */
+    return SNTPEX_ERROR;
   }
-  else if ( serverIpAddr->sa_family  == SLNETSOCK_AF_INET6 )
+
+  ( void )memset( &p_client->sock->descriptor.SocketAddr, 0, sizeof( sntpex_sockaddr_t ) );
+  ( void )memcpy( &p_client->sock->descriptor.SocketAddr, serverIpAddr, usAddressLength );
+  p_client->sock->descriptor.InAddLength = usAddressLength;
+
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+  /* The configured server becomes the first and only entry of the servers list */
+  ( void )memset( p_client->xServerList, 0, sizeof( p_client->xServerList ) );
+  ( void )memcpy( &p_client->xServerList[ 0 ].SocketAddr, serverIpAddr, usAddressLength );
+  p_client->xServerList[ 0 ].InAddLength = p_client->sock->descriptor.InAddLength;
+  p_client->ucServerCount                = 1;
+#endif
+
+  /* Change library state to opened */
+  p_client->state = UD_SNTP_CLIENT_STATE_OPEN;
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   append a server to the servers list used by @ref sntpex_client_multi_timestamp_get.
+ *          All servers must share the address family of the first configured server.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   serverIpAddr: Pointer to the net address.
+ *          This parameter can be a value of @ref const SlNetSock_Addr_t *. 
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_add_server_address( sntpex_client_handle_t *p_client, const SlNetSock_Addr_t *serverIpAddr )
+{
+  /* Make sure that the SNTP client context and server IP Address are valid */
+  if( ( NULL == p_client ) || ( NULL == serverIpAddr ))
   {
-    /* setting v6 address length */
-    p_client->sock->descriptor.InAddLength = sizeof( SlNetSock_AddrIn6_t );
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
   }
-  else
+
+  /* The first server configures the client socket */
+  if( p_client->ucServerCount == 0 )
+  {
+    return sntpex_client_set_server_address( p_client, serverIpAddr );
+  }
+
+  /* The servers list is full, or the server family differs from the client socket family */
+  if( ( p_client->ucServerCount >= exlibSNTP_CLIENT_MAX_SERVERS ) ||
+      ( serverIpAddr->sa_family != p_client->xServerList[ 0 ].SocketAddr.sa.sa_family ) )
   {
     /* Return the error status. */
     return SNTPEX_ERROR;
   }
 
-  /* Change library state to opened */
-  p_client->state = UD_SNTP_CLIENT_STATE_OPEN;
+  struct x_sntpServer * p_server = &p_client->xServerList[ p_client->ucServerCount ];
+
+  ( void )memset( p_server, 0, sizeof( struct x_sntpServer ) );
+  ( void )memcpy( &p_server->SocketAddr, serverIpAddr, p_client->xServerList[ 0 ].InAddLength );
+  p_server->InAddLength = p_client->xServerList[ 0 ].InAddLength;
+
+  p_client->ucServerCount++;
 
   /* Return the error status. */
   return SNTPEX_SUCCESS;
 }
+#endif /* exlibSNTP_CONFIG_MULTI_SERVER */
 
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
@@ -478,6 +885,20 @@ uint32_t sntpex_client_Kiss_code_get( sntpex_client_handle_t *p_client )
   return ( (p_client != NULL) ? p_client->kissCode : 0 ) ;
 }
 
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the source of the last receive timestamp (T4).
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  Timestamp source, this parameter can be a value of @ref sntpex_ts_source_t.
+ */
+#pragma optimize=speed
+sntpex_ts_source_t sntpex_client_rx_timestamp_source_get( sntpex_client_handle_t *p_client )
+{
+  /* Return the source, SNTPEX_TS_SOURCE_NONE is returned when SNTP client context is not valid */
+  return ( (p_client != NULL) ? p_client->xRxTimestampSource : SNTPEX_TS_SOURCE_NONE ) ;
+}
+
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
  * @brief   sntp client deinitialization.
@@ -505,6 +926,19 @@ void sntpex_client_deinitialization(sntpex_client_handle_t *p_client)
       /* Socket is not initialized yet, Do Nothing : MISRA 15.7 */
     }
 
+    /* Remove the client from the Spawn dispatching */
+    prv_utility_client_unregister( p_client );
+
+#if ( exlibSNTP_CONFIG_TIMER_WHEEL == 1 )
+    /* The request deadline is not linked on its timer wheel anymore */
+    sntpex_timer_disarm( p_client->pxWheel, &p_client->xTimer );
+#endif
+
+#if ( exlibSNTP_CONFIG_FAST_NOW == 1 )
+    /* The fast time is not disciplined by the cleared client anymore */
+    ( void )sntpex_now_detach( p_client );
+#endif
+
     /* Clear SNTP client context */
     memset(p_client, 0, sizeof(sntpex_client_handle_t));
 
@@ -533,6 +967,13 @@ sntp_ud_t sntpex_client_timestamp_get( sntpex_client_handle_t *p_client, struct
     return SNTPEX_ERR_NULL_PTR;
   }
 
+  /* The client socket is bound to the NTP port while the broadcast listen or the responder mode is started */
+  if( 0u != ( p_client->options & ( exlibSNTP_CLIENT_OPT_BROADCAST | exlibSNTP_CLIENT_OPT_RESPONDER ) ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_FAULT_INIT;
+  }
+
   sntp_ud_t xLibReturnCode = SNTPEX_SUCCESS;
 
   /* set entry tick for global timeout generation */
@@ -541,563 +982,3550 @@ sntp_ud_t sntpex_client_timestamp_get( sntpex_client_handle_t *p_client, struct
   /* Initialize timestamp list pointer */
   p_client->xTimestampList = xTimestampCtx;
 
+  /* The blocking request replaces any request started by @ref sntpex_client_step */
+  p_client->options &= ( uint8_t )~exlibSNTP_CLIENT_OPT_STEP_MODE;
+
   /* run finite state machine */
   while( ( xLibReturnCode == SNTPEX_SUCCESS ) && ( p_client->state != UD_SNTP_CLIENT_STATE_COMPLETE ) )
   {
     /* execute state function */
-    xLibReturnCode = sntp_sapi[ p_client->state ].execFuntion( p_client );
+    xLibReturnCode = prv_utility_state_exec( p_client );
   }
 
   if ( xLibReturnCode == SNTPEX_SUCCESS )
   {
     /* Change library state to sending */
     p_client->state = UD_SNTP_CLIENT_STATE_SENDING;
+
+    /* Feed the clock filter with the new sample */
+    prv_utility_filter_update( p_client, &p_client->sock->descriptor.SocketAddr.sa );
   }
   else
   {
-    /* unregister receive event from ISR */
-    prv_utility_unregister_event( exlibSNTP_SOFTSR_RECV_BIT );
-    
-    /* close previous connection and change library state to opened */
-    sntp_sapi[ UD_SNTP_CLIENT_STATE_CLOSE ].execFuntion( p_client );
+    /* unregister receive event from ISR, close previous connection when it is not reusable */
+    prv_utility_release_connection( p_client, xLibReturnCode );
   }
 
+  /* Schedule the next request */
+  prv_utility_poll_update( p_client, xLibReturnCode, p_client->kissCode, p_client->vtable_api.get_os_tick() );
+
+#if ( exlibSNTP_CONFIG_STATS == 1 )
+  sntpex_stats_status_add( &p_client->xStats, xLibReturnCode );
+#endif
+
   /* Return the error status. */
   return xLibReturnCode;
 }
-/** @} */
-/** @} */
-
-/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
-  * @{
-  */
-/* Private function   ------------------------------------------------------------*/
-/**
- * @defgroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
- * @brief Private functions used by @ref sntp_ex_lib_ti.c .
- * @note  All these functions is declared as static to avoid application call.
- *       + @ref sFct_sntp_OpenConnection
- *       + @ref sFct_sntp_ReceiveResponse
- *       + @ref sFct_sntp_SendRequest
- *       + @ref sFct_sntp_HandlingResponse
- *       + @ref sFct_sntp_CloseConnection
- *       + @ref prv_utility_build_request
- *       + @ref prv_utility_ntp_to_epoch
- *       + @ref prv_utility_register_event 
- *       + @ref prv_utility_unregister_event 
- * @{
- */
 
 /**
- * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
- * @brief   Build the sntp request.
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the lowest-delay timestamp list of a burst of requests (iburst-like).
+ *          The requests are sent over the opened client socket, every sample feeds the clock filter.
  * @param   p_client: Pointer to the sntp client handle
  *          This parameter can be a value of @ref sntpex_client_handle_t *.
- * @param   p_payload: Pointer to the payload.
- *          This parameter can be a value of @ref void *.
- * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ * @param   xTimestampCtx: Pointer to timestamp list, filled with the lowest-delay sample.
+ *          This parameter can be a value of @ref struct xTimestampCtx_t *. 
+ * @param   ucBurstCount: Number of requests of the burst.
+ *          This parameter can be a value of @ref uint8_t.
+ * @param   ulSpacing: Spacing between two requests in ms, applied with the @ref delay_ms vtable API.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  SNTPEX_SUCCESS if at least one request succeeded, A specific error type @ref sntp_ud_t otherwise.
  */
 #pragma optimize=speed
-__STATIC_INLINE sntp_ud_t prv_utility_build_request( sntpex_client_handle_t * p_client, void * p_payload )
+sntp_ud_t sntpex_client_burst_timestamp_get( sntpex_client_handle_t *p_client, struct xTimestampCtx_t * xTimestampCtx, uint8_t ucBurstCount, uint32_t ulSpacing )
 {
-  /* Point to the buffer where to format the NTP payload */
-  struct x_sntp_request * request = ( struct x_sntp_request * ) p_payload;
-
+  /* Make sure that the SNTP client context and timestamp context are valid */
+  if( ( NULL == p_client ) || ( NULL == xTimestampCtx ))
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  sntp_ud_t              xLibReturnCode = SNTPEX_ERROR;
+  sntp_ud_t              xBurstCode     = SNTPEX_ERROR;
+  struct xTimestampCtx_t xCurrentCtx;
+  struct xSntpSample_t   xSample;
+  int64_t                llBestDelay    = -1;
+  uint8_t                ucSavedOptions = p_client->options;
+  uint8_t                ucIndex;
+
+  /* The socket is kept opened during the whole burst, only a socket error closes it */
+  p_client->options |= exlibSNTP_CLIENT_OPT_PERSISTENT_SOCKET;
+
+  for( ucIndex = 0; ucIndex < ucBurstCount; ucIndex++ )
+  {
+    if( ( ucIndex > 0 ) && ( ulSpacing > 0 ) && ( NULL != p_client->vtable_api.delay_ms ) )
+    {
+      /* Spacing between two requests */
+      p_client->vtable_api.delay_ms( ulSpacing );
+    }
+
+    /* Run one request, the sample feeds the clock filter */
+    xLibReturnCode = sntpex_client_timestamp_get( p_client, &xCurrentCtx );
+
+    if( xLibReturnCode == SNTPEX_SUCCESS )
+    {
+      /* Keep the lowest-delay sample of the burst */
+      if( ( SNTPEX_SUCCESS == sntpex_sample_compute( &xCurrentCtx, &xSample ) ) &&
+          ( ( llBestDelay < 0 ) || ( xSample.delay < llBestDelay ) ) )
+      {
+        llBestDelay    = xSample.delay;
+        *xTimestampCtx = xCurrentCtx;
+        xBurstCode     = SNTPEX_SUCCESS;
+      }
+    }
+    else if( xLibReturnCode == SNTPEX_ERR_REQUEST_REJECTED )
+    {
+      /* An SNTP client should stop sending to a server which returns a Kiss-of-Death */
+      break;
+    }
+    else
+    {
+      /* Sample lost, Do Nothing : MISRA 15.7 */
+    }
+  }
+
+  /* Restore the user persistent socket option */
+  p_client->options = ( uint8_t )( ( p_client->options & ~exlibSNTP_CLIENT_OPT_PERSISTENT_SOCKET ) |
+                                   ( ucSavedOptions & exlibSNTP_CLIENT_OPT_PERSISTENT_SOCKET ) );
+
+  /* Return the lowest-delay sample status, or the last error when every request failed */
+  return ( xBurstCode == SNTPEX_SUCCESS ) ? SNTPEX_SUCCESS : xLibReturnCode;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   run one transition of the client state machine, without any busy-wait.
+ *          The first call starts a new request, T1,T2,T3 and T4 will be inserted to the passed list.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   xTimestampCtx: Pointer to timestamp list.
+ *          This parameter can be a value of @ref struct xTimestampCtx_t *. 
+ * @retval  SNTPEX_SUCCESS when the timestamp list is ready, SNTPEX_PENDING when the request is still
+ *          in progress, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_step( sntpex_client_handle_t *p_client, struct xTimestampCtx_t * xTimestampCtx )
+{
+  /* Make sure that the SNTP client context and timestamp context are valid */
+  if( ( NULL == p_client ) || ( NULL == xTimestampCtx ))
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* The client socket is bound to the NTP port while the broadcast listen or the responder mode is started */
+  if( 0u != ( p_client->options & ( exlibSNTP_CLIENT_OPT_BROADCAST | exlibSNTP_CLIENT_OPT_RESPONDER ) ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_FAULT_INIT;
+  }
+
+  sntp_ud_t xLibReturnCode = SNTPEX_SUCCESS;
+
+  if( 0u == ( p_client->options & exlibSNTP_CLIENT_OPT_STEP_MODE ) )
+  {
+    /* Start a new request, set entry tick for global timeout generation */
+    p_client->startTime      = p_client->vtable_api.get_os_tick();
+    p_client->xTimestampList = xTimestampCtx;
+    p_client->options       |= exlibSNTP_CLIENT_OPT_STEP_MODE;
+  }
+
+  /* execute state function, socket operations return SNTPEX_PENDING instead of waiting */
+  xLibReturnCode = prv_utility_state_exec( p_client );
+
+  if( xLibReturnCode == SNTPEX_SUCCESS )
+  {
+    if( p_client->state != UD_SNTP_CLIENT_STATE_COMPLETE )
+    {
+      /* Transition done, the request is still in progress */
+      return SNTPEX_PENDING;
+    }
+
+    /* Request completed, change library state to sending */
+    p_client->state    = UD_SNTP_CLIENT_STATE_SENDING;
+    p_client->options &= ( uint8_t )~exlibSNTP_CLIENT_OPT_STEP_MODE;
+
+    /* Feed the clock filter with the new sample */
+    prv_utility_filter_update( p_client, &p_client->sock->descriptor.SocketAddr.sa );
+  }
+  else if( xLibReturnCode != SNTPEX_PENDING )
+  {
+    /* Request failed */
+    p_client->options &= ( uint8_t )~exlibSNTP_CLIENT_OPT_STEP_MODE;
+
+    /* unregister receive event from ISR, close previous connection when it is not reusable */
+    prv_utility_release_connection( p_client, xLibReturnCode );
+  }
+  else
+  {
+    /* Socket is busy, Do Nothing : MISRA 15.7 */
+  }
+
+  if( xLibReturnCode != SNTPEX_PENDING )
+  {
+    /* Request completed or failed, schedule the next one */
+    prv_utility_poll_update( p_client, xLibReturnCode, p_client->kissCode, p_client->vtable_api.get_os_tick() );
+
+#if ( exlibSNTP_CONFIG_STATS == 1 )
+    sntpex_stats_status_add( &p_client->xStats, xLibReturnCode );
+#endif
+  }
+
+  /* Return the error status. */
+  return xLibReturnCode;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   run the client state machine until it would block on the socket.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   xTimestampCtx: Pointer to timestamp list.
+ *          This parameter can be a value of @ref struct xTimestampCtx_t *. 
+ * @retval  SNTPEX_SUCCESS when the timestamp list is ready, SNTPEX_PENDING when the request is still
+ *          in progress, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_poll( sntpex_client_handle_t *p_client, struct xTimestampCtx_t * xTimestampCtx )
+{
+  sntp_ud_t         xLibReturnCode = SNTPEX_SUCCESS;
+  udSntpClientState xPrevState;
+
+  /* Make sure the SNTP client context is valid */
+  if( NULL == p_client )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Keep stepping while the state machine moves forward */
+  do
+  {
+    xPrevState     = p_client->state;
+    xLibReturnCode = sntpex_client_step( p_client, xTimestampCtx );
+  }
+  while( ( xLibReturnCode == SNTPEX_PENDING ) && ( xPrevState != p_client->state ) );
+
+  /* Return the error status. */
+  return xLibReturnCode;
+}
+
+#if ( exlibSNTP_CONFIG_IPV6 == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   race the requests of two clients, typically configured with the IPV6 and the IPV4 addresses of
+ *          the same pool (happy-eyeballs). The first reply wins, the request of the other client is cancelled.
+ * @param   p_client: Pointer to the sntp client handle, preferred family and owner of the clock.
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   p_alternate: Pointer to the sntp client handle of the other family.
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   xTimestampCtx: Pointer to timestamp list, filled with the winning reply.
+ *          This parameter can be a value of @ref struct xTimestampCtx_t *.
+ * @param   pucWinner: Pointer to the winning client, 0 for @ref p_client and 1 for @ref p_alternate, can be NULL.
+ *          This parameter can be a value of @ref uint8_t *.
+ * @retval  SNTPEX_SUCCESS if one client succeeded, the error status of @ref p_client otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_dual_stack_timestamp_get( sntpex_client_handle_t *p_client, sntpex_client_handle_t *p_alternate,
+                                                  struct xTimestampCtx_t * xTimestampCtx, uint8_t * pucWinner )
+{
+  /* Make sure that the SNTP client contexts and timestamp context are valid */
+  if( ( NULL == p_client ) || ( NULL == p_alternate ) || ( NULL == xTimestampCtx ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  sntpex_client_handle_t * apxClient[ 2 ] = { p_client, p_alternate };
+  struct xTimestampCtx_t   axTimestampCtx[ 2 ];
+  struct xSntpSample_t     axSample[ 2 ];
+  sntp_ud_t                axStatus[ 2 ] = { SNTPEX_PENDING, SNTPEX_PENDING };
+  int8_t                   cWinner       = -1;
+  uint8_t                  ucIndex;
+
+  /* Both clients must be initialized and free, the request of a step in progress is not raced */
+  for( ucIndex = 0; ucIndex < 2u; ucIndex++ )
+  {
+    if( ( NULL == apxClient[ ucIndex ]->sock ) || ( apxClient[ ucIndex ]->sock->descriptor.InAddLength == 0u ) || ( p_client == p_alternate ) ||
+        ( 0u != ( apxClient[ ucIndex ]->options & ( exlibSNTP_CLIENT_OPT_STEP_MODE | exlibSNTP_CLIENT_OPT_BROADCAST | exlibSNTP_CLIENT_OPT_RESPONDER ) ) ) )
+    {
+      /* Return the error status. */
+      return SNTPEX_ERR_FAULT_INIT;
+    }
+  }
+
+  /** @remark RFC 8305 : the preferred family is started first, then both requests are in flight. Every pass
+   *  runs the state machines until they would block, the replies read in the same pass are ranked by delay */
+  while( cWinner < 0 )
+  {
+    SlNetSock_SdSet_t   xReadSet;
+    SlNetSock_Timeval_t xWait;
+    int32_t             lMaxFd = -1;
+    uint32_t            ulWait = 0xFFFFFFFFu;
+
+    for( ucIndex = 0; ucIndex < 2u; ucIndex++ )
+    {
+      if( axStatus[ ucIndex ] != SNTPEX_PENDING )
+      {
+        continue;
+      }
+
+      axStatus[ ucIndex ] = sntpex_client_poll( apxClient[ ucIndex ], &axTimestampCtx[ ucIndex ] );
+
+      if( ( axStatus[ ucIndex ] == SNTPEX_SUCCESS ) &&
+          ( SNTPEX_SUCCESS == sntpex_sample_compute( &axTimestampCtx[ ucIndex ], &axSample[ ucIndex ] ) ) &&
+          ( ( cWinner < 0 ) || ( axSample[ ucIndex ].delay < axSample[ cWinner ].delay ) ) )
+      {
+        cWinner = ( int8_t )ucIndex;
+      }
+    }
+
+    /* A reply is received, or both requests failed */
+    if( ( cWinner >= 0 ) || ( ( axStatus[ 0 ] != SNTPEX_PENDING ) && ( axStatus[ 1 ] != SNTPEX_PENDING ) ) )
+    {
+      break;
+    }
+
+    /* Wait for the first reply, or for the first timeout of the pending requests */
+    SlNetSock_sdsClrAll( &xReadSet );
+
+    for( ucIndex = 0; ucIndex < 2u; ucIndex++ )
+    {
+      sntpex_client_handle_t * p_racer = apxClient[ ucIndex ];
+
+      if( axStatus[ ucIndex ] != SNTPEX_PENDING )
+      {
+        continue;
+      }
+
+      uint32_t ulElapsed   = p_racer->vtable_api.get_os_tick() - p_racer->startTime;
+      uint32_t ulRemaining = ( ulElapsed < p_racer->timeout ) ? ( p_racer->timeout - ulElapsed ) : 0u;
+
+      if( p_racer->state == UD_SNTP_CLIENT_STATE_RECEIVING )
+      {
+        SlNetSock_sdsSet( p_racer->sock->fd, &xReadSet );
+        lMaxFd = ( p_racer->sock->fd > lMaxFd ) ? p_racer->sock->fd : lMaxFd;
+      }
+      else
+      {
+        /* Busy socket, the request is sent again on the next pass */
+        ulRemaining = ( ulRemaining > 1u ) ? 1u : ulRemaining;
+      }
+
+      ulWait = ( ulRemaining < ulWait ) ? ulRemaining : ulWait;
+    }
+
+    xWait.tv_sec  = ( int32_t )( ulWait / 1000 );
+    xWait.tv_usec = ( int32_t )( ulWait % 1000 ) * 1000;
+
+    if( lMaxFd >= 0 )
+    {
+      /* The next pass reads the readable socket, or reports the timeout and the socket errors */
+      ( void )SlNetSock_select( ( int16_t )( lMaxFd + 1 ), &xReadSet, NULL, NULL, &xWait );
+    }
+    else if( ( ulWait > 0 ) && ( NULL != p_client->vtable_api.delay_ms ) )
+    {
+      p_client->vtable_api.delay_ms( ulWait );
+    }
+    else
+    {
+      /* Do Nothing : MISRA 15.7 */
+    }
+  }
+
+  /* The other request is not expected anymore */
+  for( ucIndex = 0; ucIndex < 2u; ucIndex++ )
+  {
+    if( axStatus[ ucIndex ] == SNTPEX_PENDING )
+    {
+      prv_utility_request_cancel( apxClient[ ucIndex ] );
+    }
+  }
+
+  if( cWinner < 0 )
+  {
+    /* Return the error status. */
+    return axStatus[ 0 ];
+  }
+
+  *xTimestampCtx = axTimestampCtx[ cWinner ];
+
+  if( NULL != pucWinner )
+  {
+    *pucWinner = ( uint8_t )cWinner;
+  }
+
+  /** @remark A reply of the preferred client already fed its clock filter and scheduled its next request.
+   *  Otherwise the reply of the alternate client feeds it now, once per round */
+  if( ( cWinner == 1 ) && ( axStatus[ 0 ] != SNTPEX_SUCCESS ) )
+  {
+    prv_utility_sample_update( p_client, &axSample[ 1 ], axTimestampCtx[ 1 ].server.li );
+#if ( exlibSNTP_CONFIG_RESPONDER == 1 )
+    prv_utility_sync_source_set( p_client, &axTimestampCtx[ 1 ].server, &p_alternate->sock->descriptor.SocketAddr.sa );
+#endif
+
+    prv_utility_poll_update( p_client, SNTPEX_SUCCESS, 0, p_client->vtable_api.get_os_tick() );
+  }
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+#endif /* exlibSNTP_CONFIG_IPV6 */
+
+#if ( exlibSNTP_CONFIG_TIMER_WHEEL == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   start a step mode request run by a timer wheel, its deadline is armed on the wheel.
+ *          The request is then stepped and expired by @ref sntpex_timer_wheel_poll , not by the application.
+ * @param   p_client: Pointer to the sntp client handle, registered by @ref sntpex_clientInitialization.
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pxWheel: Pointer to the timer wheel, initialized by @ref sntpex_timer_wheel_init.
+ *          This parameter can be a value of @ref struct xSntpTimerWheel_t *.
+ * @param   xTimestampCtx: Pointer to timestamp list, must stay valid until the request is completed.
+ *          This parameter can be a value of @ref struct xTimestampCtx_t *.
+ * @retval  SNTPEX_PENDING when the request is in flight, otherwise the status of the request completed
+ *          on the start (no completion callback is called), A specific error type @ref sntp_ud_t.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_wheel_start( sntpex_client_handle_t *p_client, struct xSntpTimerWheel_t * pxWheel,
+                                     struct xTimestampCtx_t * xTimestampCtx )
+{
+  sntp_ud_t xLibReturnCode;
+  uint64_t  ullNow;
+
+  /* Make sure that the SNTP client context, the timer wheel and timestamp context are valid */
+  if( ( NULL == p_client ) || ( NULL == pxWheel ) || ( NULL == xTimestampCtx ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* The client must be initialized and free, a request in progress is not restarted */
+  if( ( NULL == p_client->sock ) || ( 0u != p_client->xTimer.armed ) ||
+      ( 0u != ( p_client->options & ( exlibSNTP_CLIENT_OPT_STEP_MODE | exlibSNTP_CLIENT_OPT_BROADCAST | exlibSNTP_CLIENT_OPT_RESPONDER ) ) ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_FAULT_INIT;
+  }
+
+  /* The deadline is taken on the wheel tick extension, before the request start tick */
+  ullNow = sntpex_tick64_update( &pxWheel->xTick, p_client->vtable_api.get_os_tick() );
+
+  /* Run the state machine until the request would block on the socket */
+  xLibReturnCode = sntpex_client_poll( p_client, xTimestampCtx );
+
+  if( xLibReturnCode == SNTPEX_PENDING )
+  {
+    p_client->pxWheel        = pxWheel;
+    p_client->xTimer.pvOwner = p_client;
+
+    ( void )sntpex_timer_arm( pxWheel, &p_client->xTimer, ullNow + p_client->timeout );
+  }
+  else
+  {
+    /* Completed or failed on the start, Do Nothing : MISRA 15.7 */
+  }
+
+  /* Return the error status. */
+  return xLibReturnCode;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   run the requests of a timer wheel : the clients with a pending Spawn event or a busy socket are
+ *          stepped, then the elapsed deadlines are expired. Every completed request is reported to the callback.
+ * @param   pxWheel: Pointer to the timer wheel.
+ *          This parameter can be a value of @ref struct xSntpTimerWheel_t *.
+ * @param   ulTick: Operating system tick in ms.
+ *          This parameter can be a value of @ref uint32_t.
+ * @param   cb: completion callback, can be NULL.
+ *          This parameter can be a value of @ref pf_requestCallback.
+ * @retval  number of requests completed by the call.
+ */
+#pragma optimize=speed
+uint8_t sntpex_timer_wheel_poll( struct xSntpTimerWheel_t * pxWheel, uint32_t ulTick, pf_requestCallback cb )
+{
+  struct xSntpTimer_t * pxTimer;
+  uint64_t              ullNow;
+  uint8_t               ucCompleted = 0;
+  uint8_t               ucIndex;
+
+  /* Make sure that the timer wheel is valid */
+  if( NULL == pxWheel )
+  {
+    return 0;
+  }
+
+  ullNow = sntpex_tick64_update( &pxWheel->xTick, ulTick );
+
+  /** @remark A client waiting for its reply is only stepped once the Spawn task queued an event, the
+   *  idle clients cost no socket call. The deadlines are handled by the wheel below */
+  for( ucIndex = 0; ucIndex < exlibSNTP_CLIENT_MAX_NUMBER; ucIndex++ )
+  {
+    sntpex_client_handle_t * p_client = pg_client_registry[ ucIndex ];
+
+    if( ( NULL == p_client ) || ( p_client->pxWheel != pxWheel ) || ( 0u == p_client->xTimer.armed ) ||
+        ( ( p_client->state == UD_SNTP_CLIENT_STATE_RECEIVING ) && ( p_client->xAsynchEvent.head == p_client->xAsynchEvent.tail ) ) )
+    {
+      continue;
+    }
+
+    sntp_ud_t xLibReturnCode = sntpex_client_poll( p_client, p_client->xTimestampList );
+
+    if( xLibReturnCode != SNTPEX_PENDING )
+    {
+      prv_utility_wheel_complete( p_client, xLibReturnCode, cb );
+      ucCompleted++;
+    }
+    else
+    {
+      /* Still in flight, Do Nothing : MISRA 15.7 */
+    }
+  }
+
+  /* Expire the elapsed deadlines, O(1) per expired request */
+  while( NULL != ( pxTimer = sntpex_timer_expire( pxWheel, ullNow ) ) )
+  {
+    sntpex_client_handle_t * p_client = ( sntpex_client_handle_t * )pxTimer->pvOwner;
+
+    /* The reply is not expected anymore */
+    prv_utility_request_cancel( p_client );
+
+    prv_utility_poll_update( p_client, SNTPEX_ERR_TIMEOUT, 0, ulTick );
+
+#if ( exlibSNTP_CONFIG_STATS == 1 )
+    sntpex_stats_status_add( &p_client->xStats, SNTPEX_ERR_TIMEOUT );
+#endif
+
+    prv_utility_wheel_complete( p_client, SNTPEX_ERR_TIMEOUT, cb );
+    ucCompleted++;
+  }
+
+  return ucCompleted;
+}
+#endif /* exlibSNTP_CONFIG_TIMER_WHEEL */
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   set the user callback executed from the Spawn task on RX event.
+ *          It can be used to wake up the task stepping the client @ref sntpex_client_step.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   cb: user callback, NULL to remove it.
+ *          This parameter can be a value of @ref pf_eventCallback.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_set_event_callback( sntpex_client_handle_t *p_client, pf_eventCallback cb )
+{
+  /* Make sure the SNTP client context is valid */
+  if( NULL == p_client )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Save the user callback, it is registered with the next RX event */
+  p_client->pfEventNotify = cb;
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   keep the client socket opened and configured across sync cycles.
+ *          The socket is only rebuilt on interface or address family change, or on socket error.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   enable: 1 to keep the socket opened, 0 to close it on every failed request.
+ *          This parameter can be a value of @ref uint8_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_set_persistent_socket( sntpex_client_handle_t *p_client, uint8_t enable )
+{
+  /* Make sure the SNTP client context is valid */
+  if( NULL == p_client )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  if( enable != 0 )
+  {
+    p_client->options |= exlibSNTP_CLIENT_OPT_PERSISTENT_SOCKET;
+  }
+  else
+  {
+    p_client->options &= ( uint8_t )~exlibSNTP_CLIENT_OPT_PERSISTENT_SOCKET;
+  }
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+#if ( exlibSNTP_CONFIG_AUTH == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   add (or replace) a symmetric key of the client key table.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   ulKeyId: Key Identifier, shared with the server (not 0).
+ *          This parameter can be a value of @ref uint32_t.
+ * @param   ucType: Authentication algorithm.
+ *          This parameter can be a value of @ref sntpex_auth_type_t.
+ * @param   pucKey: Pointer to the key material, copied into the table.
+ *          This parameter can be a value of @ref const uint8_t *.
+ * @param   ucKeyLength: Key length, up to @ref exlibSNTP_AUTH_KEY_MAX_SIZE (16 for AES-CMAC).
+ *          This parameter can be a value of @ref uint8_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_auth_key_add( sntpex_client_handle_t *p_client, uint32_t ulKeyId, uint8_t ucType,
+                                      const uint8_t * pucKey, uint8_t ucKeyLength )
+{
+  struct xSntpKey_t * pxKey = NULL;
+  uint8_t             ucMacSize;
+  uint8_t             ucIndex;
+
+  /* Make sure the SNTP client context and the key are valid */
+  if( ( NULL == p_client ) || ( NULL == pucKey ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /** @remark The Key Identifier 0 is reserved to the crypto-NAK, the key is validated once here so the
+   *  requests only run the MAC computation */
+  ucMacSize = sntpex_auth_mac_size( ucType );
+
+  if( ( ulKeyId == 0 ) || ( ucMacSize == 0 ) || ( ucKeyLength == 0 ) || ( ucKeyLength > exlibSNTP_AUTH_KEY_MAX_SIZE ) ||
+      ( ( ucType == SNTPEX_AUTH_AES_CMAC ) && ( ucKeyLength != 16 ) ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERROR;
+  }
+
+  /* A key with the same identifier is replaced, the selected key pointer stays valid */
+  for( ucIndex = 0; ucIndex < p_client->ucKeyCount; ucIndex++ )
+  {
+    if( p_client->xKeyTable[ ucIndex ].keyId == ulKeyId )
+    {
+      pxKey = &p_client->xKeyTable[ ucIndex ];
+      break;
+    }
+  }
+
+  if( NULL == pxKey )
+  {
+    if( p_client->ucKeyCount >= exlibSNTP_AUTH_MAX_KEYS )
+    {
+      /* The key table is full, return the error status. */
+      return SNTPEX_ERR_FAULT_INIT;
+    }
+
+    pxKey = &p_client->xKeyTable[ p_client->ucKeyCount ];
+    p_client->ucKeyCount++;
+  }
+
+  ( void )memset( pxKey, 0, sizeof( struct xSntpKey_t ) );
+  ( void )memcpy( pxKey->key, pucKey, ucKeyLength );
+
+  pxKey->keyId   = ulKeyId;
+  pxKey->type    = ucType;
+  pxKey->length  = ucKeyLength;
+  pxKey->macSize = ucMacSize;
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   select the key authenticating the requests and the replies.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   ulKeyId: Key Identifier of a key of the table, 0 disables the authentication.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_auth_key_select( sntpex_client_handle_t *p_client, uint32_t ulKeyId )
+{
+  uint8_t ucIndex;
+
+  /* Make sure the SNTP client context is valid */
+  if( NULL == p_client )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  if( ulKeyId == 0 )
+  {
+    /* The requests are no more authenticated */
+    p_client->pxActiveKey = NULL;
+
+    /* Return the error status. */
+    return SNTPEX_SUCCESS;
+  }
+
+  /* The MAC is computed by the crypto accelerator of the application */
+  if( NULL == p_client->vtable_api.compute_mac )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_FAULT_INIT;
+  }
+
+  for( ucIndex = 0; ucIndex < p_client->ucKeyCount; ucIndex++ )
+  {
+    if( p_client->xKeyTable[ ucIndex ].keyId == ulKeyId )
+    {
+      p_client->pxActiveKey = &p_client->xKeyTable[ ucIndex ];
+
+      /* Return the error status. */
+      return SNTPEX_SUCCESS;
+    }
+  }
+
+  /* Unknown key, return the error status. */
+  return SNTPEX_ERROR;
+}
+#endif /* exlibSNTP_CONFIG_AUTH */
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the filtered clock sample of the client (minimum-delay sample of the clock filter).
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pxSample: Pointer to the filtered sample.
+ *          This parameter can be a value of @ref struct xSntpSample_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_clock_offset_get( sntpex_client_handle_t *p_client, struct xSntpSample_t * pxSample )
+{
+  /* Make sure that the SNTP client context and the sample are valid */
+  if( ( NULL == p_client ) || ( NULL == pxSample ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+#if ( exlibSNTP_CONFIG_FILTER == 1 )
+  /* Return the minimum-delay sample, SNTPEX_ERROR when no request succeeded yet */
+  return sntpex_filter_best_get( &p_client->xFilter, pxSample );
+#else
+  /* Without the clock filter, the last sample is the filtered one */
+  *pxSample = p_client->xLastSample;
+
+  /* Return the error status, SNTPEX_ERROR when no request succeeded yet */
+  return ( p_client->xLastSample.epoch != 0u ) ? SNTPEX_SUCCESS : SNTPEX_ERROR;
+#endif
+}
+
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the disciplined time of the client.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pullTime: Pointer to the disciplined 64-UNIX time in us.
+ *          This parameter can be a value of @ref uint64_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERROR when the clock is not disciplined yet (raw time is returned).
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_time_get( sntpex_client_handle_t *p_client, uint64_t * pullTime )
+{
+  /* Make sure that the SNTP client context and the time are valid */
+  if( ( NULL == p_client ) || ( NULL == pullTime ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Apply the correction on top of the raw local clock, which is never written */
+  *pullTime = sntpex_discipline_time_get( &p_client->xDiscipline, p_client->vtable_api.get_unix_timestamp() );
+
+  /* Return the error status. */
+  return ( p_client->xDiscipline.state != SNTPEX_DISCIPLINE_UNSET ) ? SNTPEX_SUCCESS : SNTPEX_ERROR;
+}
+#endif /* exlibSNTP_CONFIG_DISCIPLINE */
+
+#if ( exlibSNTP_CONFIG_TIMESCALE == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   attach a leap seconds table to the disciplined clock. The Leap Indicator of the replies updates
+ *          the table, and the passed leaps are folded into the clock.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pxTimescale: Pointer to the timescale initialized by @ref sntpex_timescale_init , NULL to detach it.
+ *          This parameter can be a value of @ref struct xSntpTimescale_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_timescale_attach( sntpex_client_handle_t *p_client, struct xSntpTimescale_t * pxTimescale )
+{
+  /* Make sure that the SNTP client context is valid */
+  if( NULL == p_client )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  p_client->pxTimescale = pxTimescale;
+
+  /* A disciplined clock selects its entry now, otherwise on its first sample */
+  if( ( NULL != pxTimescale ) && ( p_client->xDiscipline.state != SNTPEX_DISCIPLINE_UNSET ) )
+  {
+    ( void )sntpex_timescale_update( pxTimescale, specNTP_LI_ALARM,
+                                     sntpex_discipline_time_get( &p_client->xDiscipline, p_client->vtable_api.get_unix_timestamp() ) );
+  }
+  else
+  {
+    /* Do Nothing : MISRA 15.7 */
+  }
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the disciplined time on a timescale, O(1). The UTC time is stepped or smeared on the leaps,
+ *          see @ref sntpex_leap_mode_t , the TAI and GPS times are continuous.
+ * @param   p_client: Pointer to the sntp client handle, with an attached timescale.
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   xScale: Timescale of the result.
+ *          This parameter can be a value of @ref sntpex_timescale_t.
+ * @param   pullTime: Pointer to the time in us, see @ref sntpex_timescale_t.
+ *          This parameter can be a value of @ref uint64_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERROR when the clock is not disciplined yet.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_timescale_time_get( sntpex_client_handle_t *p_client, sntpex_timescale_t xScale, uint64_t * pullTime )
+{
+  /* Make sure that the SNTP client context, the timescale and the time are valid */
+  if( ( NULL == p_client ) || ( NULL == p_client->pxTimescale ) || ( NULL == pullTime ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  *pullTime = sntpex_timescale_from_clock( p_client->pxTimescale,
+                                           sntpex_discipline_time_get( &p_client->xDiscipline, p_client->vtable_api.get_unix_timestamp() ),
+                                           xScale );
+
+  /* Return the error status. */
+  return ( p_client->xDiscipline.state != SNTPEX_DISCIPLINE_UNSET ) ? SNTPEX_SUCCESS : SNTPEX_ERROR;
+}
+#endif /* exlibSNTP_CONFIG_TIMESCALE */
+
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the estimated frequency error of the local clock.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  Frequency correction in ppb, 0 when it is not estimated yet.
+ */
+#pragma optimize=speed
+int32_t sntpex_client_frequency_get( sntpex_client_handle_t *p_client )
+{
+  /* Return the frequency, 0 is returned when SNTP client context is not valid */
+  return ( (p_client != NULL) ? ( int32_t )p_client->xDiscipline.freq : 0 ) ;
+}
+#endif /* exlibSNTP_CONFIG_DISCIPLINE */
+
+#if ( exlibSNTP_CONFIG_POLL == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   set the poll exponents range of the client scheduler, the next request is due immediately.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   ucMinExponent: Minimum poll exponent (interval of 2^exponent seconds).
+ *          This parameter can be a value of @ref uint8_t.
+ * @param   ucMaxExponent: Maximum poll exponent, lower or equal to @ref exlibSNTP_POLL_KOD_MAX_EXPONENT .
+ *          This parameter can be a value of @ref uint8_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_set_poll_range( sntpex_client_handle_t *p_client, uint8_t ucMinExponent, uint8_t ucMaxExponent )
+{
+  /* Make sure the SNTP client context is valid */
+  if( NULL == p_client )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Return the error status, SNTPEX_ERROR when the range is not valid */
+  return sntpex_poll_reset( &p_client->xPoll, ucMinExponent, ucMaxExponent );
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the time until the next request of the client is due, the MCU can sleep meanwhile.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  Time in ms, 0 when the request is due.
+ */
+#pragma optimize=speed
+uint32_t sntpex_client_time_until_next_sync( sntpex_client_handle_t *p_client )
+{
+  /* Return the remaining time, 0 is returned when SNTP client context is not valid */
+  return ( (p_client != NULL) ? sntpex_poll_time_until_next( &p_client->xPoll, p_client->vtable_api.get_os_tick() ) : 0 ) ;
+}
+#endif /* exlibSNTP_CONFIG_POLL */
+
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get timestamp list of every configured server, in one round trip.
+ *          The requests are sent back-to-back on the client socket, then the replies are collected
+ *          with a single select-driven receive loop and matched to their server by the originate nonce.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pxTimestampCtx: Array of timestamp list, one entry per configured server.
+ *          This parameter can be a value of @ref struct xTimestampCtx_t *.
+ * @param   pxServerStatus: Array of status, one entry per configured server.
+ *          This parameter can be a value of @ref sntp_ud_t *.
+ * @retval  SNTPEX_SUCCESS if at least one server replied and a majority of the replies agrees,
+ *          SNTPEX_ERROR when no majority agrees (the round is discarded), A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_multi_timestamp_get( sntpex_client_handle_t *p_client, struct xTimestampCtx_t * pxTimestampCtx, sntp_ud_t * pxServerStatus )
+{
+  /* Make sure that the SNTP client context, timestamp and status arrays are valid */
+  if( ( NULL == p_client ) || ( NULL == pxTimestampCtx ) || ( NULL == pxServerStatus ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Make sure the SNTP client is initialized and at least one server is configured */
+  if( ( NULL == p_client->sock ) || ( p_client->ucServerCount == 0 ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_FAULT_INIT;
+  }
+
+  /* The request of a step in progress is not replaced, the client socket is bound to the NTP port
+   * while the broadcast listen or the responder mode is started */
+  if( 0u != ( p_client->options & ( exlibSNTP_CLIENT_OPT_STEP_MODE | exlibSNTP_CLIENT_OPT_BROADCAST | exlibSNTP_CLIENT_OPT_RESPONDER ) ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_FAULT_INIT;
+  }
+
+  struct vsocket    * p_socket       = p_client->sock;
+  sntp_ud_t           xLibReturnCode = SNTPEX_SUCCESS;
+  int32_t             SLReturnCode   = SLNETERR_RET_CODE_OK;
+  uint8_t             aucPending[ exlibSNTP_CLIENT_MAX_SERVERS ] = { 0, };
+  uint8_t             ucPendingCount = 0;
+  uint8_t             ucIndex;
+  sntpex_sockaddr_t   xFromAddr;
+  SlNetSocklen_t      xFromLength;
+  SlNetSock_SdSet_t   xReadSet;
+  SlNetSock_Timeval_t xSelectTimeout;
+  struct xSntpSample_t xSample;
+  uint8_t             ucSurvivors    = 0;
+  uint32_t            ulKissCode     = 0;
+  sntp_ud_t           xSelectCode;
+#if ( exlibSNTP_CONFIG_RESPONDER == 1 )
+  int8_t              cSyncIndex     = -1;
+#endif
+
+  /* set entry tick for global timeout generation */
+  p_client->startTime = p_client->vtable_api.get_os_tick();
+
+  for( ucIndex = 0; ucIndex < p_client->ucServerCount; ucIndex++ )
+  {
+    /* No reply received yet */
+    ( void )memset( &pxTimestampCtx[ ucIndex ], 0, sizeof( struct xTimestampCtx_t ) );
+    pxServerStatus[ ucIndex ] = SNTPEX_ERR_TIMEOUT;
+  }
+
+  /* Open the client socket, only when it is not already opened */
+  if( p_client->state == UD_SNTP_CLIENT_STATE_OPEN )
+  {
+    xLibReturnCode = sntp_sapi[ UD_SNTP_CLIENT_STATE_OPEN ].execFuntion( p_client );
+
+    if( xLibReturnCode != SNTPEX_SUCCESS )
+    {
+      /* close previous connection and change library state to opened */
+      sntp_sapi[ UD_SNTP_CLIENT_STATE_CLOSE ].execFuntion( p_client );
+
+      /* The next request is sent on the next bound interface */
+      prv_utility_interface_failover( p_client, xLibReturnCode );
+
+      /* Return the error status. */
+      return xLibReturnCode;
+    }
+  }
+
+  /* Discard the replies of previous requests queued on the reused socket */
+  prv_utility_flush_socket( p_client );
+
+  /* register receive event from ISR, before the first request leaves the client */
+  prv_utility_register_event( p_client, exlibSNTP_SOFTSR_RECV_BIT, p_client->pfEventNotify );
+
+  /* Send the requests back-to-back, every request has its own originate nonce */
+  for( ucIndex = 0; ucIndex < p_client->ucServerCount; ucIndex++ )
+  {
+    struct x_sntpServer * p_server = &p_client->xServerList[ ucIndex ];
+
+    /* Create NTP request which will be stored on the @ref p_client->payload with size @ref p_client->payloadLen */
+    if( prv_utility_build_request( p_client, p_client->payload ) != SNTPEX_SUCCESS )
+    {
+      /* The request cannot be signed */
+      pxServerStatus[ ucIndex ] = SNTPEX_ERR_AUTH;
+      continue;
+    }
+
+    p_server->expected_orig_ts = p_client->expected_orig_ts;
+
+    /* Send the request, the originate unix 64 timestamp T1 is taken on the transmission */
+    SLReturnCode = prv_utility_send_to( p_client, &p_server->SocketAddr.sa, p_server->InAddLength, &pxTimestampCtx[ ucIndex ].originate64_ts );
+
+    if( SLReturnCode == ( int32_t )p_client->payloadLen )
+    {
+      /* The reply of this server is now expected */
+      aucPending[ ucIndex ] = 1;
+      ucPendingCount++;
+    }
+    else
+    {
+      /* Error send NTP request */
+      pxServerStatus[ ucIndex ] = SNTPEX_ERR_TX;
+    }
+  }
+
+  /* Collect the replies with a single select-driven loop, until every server replied or timeout is occured */
+  while( ucPendingCount > 0 )
+  {
+    uint32_t ulElapsed = p_client->vtable_api.get_os_tick() - p_client->startTime;
+
+    if( ulElapsed >= p_client->timeout )
+    {
+      /* Timeout is occured, pending servers keep the timeout status */
+      break;
+    }
+
+    /* Wait for the socket to become readable, for the remaining time */
+    xSelectTimeout.tv_sec  = ( int32_t )( ( p_client->timeout - ulElapsed ) / 1000 );
+    xSelectTimeout.tv_usec = ( int32_t )( ( p_client->timeout - ulElapsed ) % 1000 ) * 1000;
+
+    SlNetSock_sdsClrAll( &xReadSet );
+    SlNetSock_sdsSet( p_socket->fd, &xReadSet );
+
+    SLReturnCode = SlNetSock_select( p_socket->fd + 1, &xReadSet, NULL, NULL, &xSelectTimeout );
+
+    if( SLReturnCode == 0 )
+    {
+      /* Timeout is occured, pending servers keep the timeout status */
+      break;
+    }
+    else if( SLReturnCode < 0 )
+    {
+      /* Error occured on the socket, return the error status. */
+      xLibReturnCode = SNTPEX_ERR_RX;
+      break;
+    }
+
+    /* Read data from socket, SLReturnCode will return the length of received payload */
+    xFromLength  = sizeof( xFromAddr );
+    SLReturnCode = SlNetSock_recvFrom( p_socket->fd,
+                                       &p_client->payload,
+                                       sizeof( p_client->payload ),
+                                       0,
+                                       &xFromAddr.sa,
+                                       &xFromLength );
+
+    if( SLReturnCode == SLNETERR_BSD_EAGAIN )
+    {
+      /* Spurious wake-up, wait again */
+      continue;
+    }
+    else if( SLReturnCode < 0 )
+    {
+      /* Error receive NTP request, return the error status. */
+      xLibReturnCode = SNTPEX_ERR_RX;
+      break;
+    }
+
+    /* save the reference unix 64 timestamp T4, from the most accurate source captured for this reply */
+    uint64_t ullReferenceTs = prv_utility_rx_timestamp_get( p_client, prv_utility_rx_event_take( p_client ) );
+
+    /* Find the server of this reply, stale or spoofed replies are discarded */
+    int8_t cServer = ( SLReturnCode >= ( int32_t )exlibSNTP_PACKET_HEADER_SIZE ) ?
+                     prv_utility_match_server( p_client, p_client->payload, aucPending ) : -1;
+
+    if( cServer < 0 )
+    {
+      continue;
+    }
+
+    /* save the reply length, the MAC and extension fields are located by the response handling */
+    p_client->payloadLen = ( size_t )SLReturnCode;
+
+    /* Verify and export the reply to the timestamp list of its server */
+    p_client->expected_orig_ts = p_client->xServerList[ cServer ].expected_orig_ts;
+    p_client->xTimestampList   = &pxTimestampCtx[ cServer ];
+    p_client->xTimestampList->reference64_ts = ullReferenceTs;
+
+    pxServerStatus[ cServer ]                  = sFct_sntp_HandlingResponse( p_client );
+    p_client->xServerList[ cServer ].kissCode  = p_client->kissCode;
+
+    aucPending[ cServer ] = 0;
+    ucPendingCount--;
+  }
+
+  /* unregister receive event from ISR */
+  prv_utility_unregister_event( p_client, exlibSNTP_SOFTSR_RECV_BIT );
+
+  if( xLibReturnCode != SNTPEX_SUCCESS )
+  {
+    /* close previous connection and change library state to opened */
+    sntp_sapi[ UD_SNTP_CLIENT_STATE_CLOSE ].execFuntion( p_client );
+
+    /* The next request is sent on the next bound interface */
+    prv_utility_interface_failover( p_client, xLibReturnCode );
+
+    /* Schedule the next request */
+    prv_utility_poll_update( p_client, xLibReturnCode, 0, p_client->vtable_api.get_os_tick() );
+
+#if ( exlibSNTP_CONFIG_STATS == 1 )
+    sntpex_stats_status_add( &p_client->xStats, xLibReturnCode );
+#endif
+
+    /* Return the error status. */
+    return xLibReturnCode;
+  }
+
+  /* Keep the socket opened for the next request */
+  p_client->state = UD_SNTP_CLIENT_STATE_SENDING;
+
+  /* Discard the falsetickers, the combined sample of the survivors feeds the clock filter */
+  xSelectCode = sntpex_select_combine( pxTimestampCtx, pxServerStatus, p_client->ucServerCount, &xSample, &ucSurvivors );
+
+  if( SNTPEX_SUCCESS == xSelectCode )
+  {
+    int8_t cLi = -1;
+
+    /* A leap is only announced, or withdrawn, when the survivors agree, the alarm is ignored */
+    for( ucIndex = 0; ucIndex < p_client->ucServerCount; ucIndex++ )
+    {
+      if( 0u != ( ucSurvivors & ( 1u << ucIndex ) ) )
+      {
+        cLi = ( ( cLi < 0 ) || ( cLi == ( int8_t )pxTimestampCtx[ ucIndex ].server.li ) ) ? ( int8_t )pxTimestampCtx[ ucIndex ].server.li : ( int8_t )specNTP_LI_ALARM;
+      }
+    }
+
+    prv_utility_sample_update( p_client, &xSample, ( cLi < 0 ) ? ( uint8_t )specNTP_LI_ALARM : ( uint8_t )cLi );
+
+#if ( exlibSNTP_CONFIG_RESPONDER == 1 )
+    /* The survivor of the lowest stratum is advertised as the reference of the responder mode */
+    for( ucIndex = 0; ucIndex < p_client->ucServerCount; ucIndex++ )
+    {
+      if( ( 0u != ( ucSurvivors & ( 1u << ucIndex ) ) ) &&
+          ( ( cSyncIndex < 0 ) || ( pxTimestampCtx[ ucIndex ].server.stratum < pxTimestampCtx[ cSyncIndex ].server.stratum ) ) )
+      {
+        cSyncIndex = ( int8_t )ucIndex;
+      }
+    }
+
+    if( cSyncIndex >= 0 )
+    {
+      prv_utility_sync_source_set( p_client, &pxTimestampCtx[ cSyncIndex ].server, &p_client->xServerList[ cSyncIndex ].SocketAddr.sa );
+    }
+#endif
+  }
+
+  /* Return the status of the first replying server, or the last error when no server replied */
+  xLibReturnCode = SNTPEX_ERR_TIMEOUT;
+
+#if ( exlibSNTP_CONFIG_STATS == 1 )
+  /* One status per queried server */
+  for( ucIndex = 0; ucIndex < p_client->ucServerCount; ucIndex++ )
+  {
+    sntpex_stats_status_add( &p_client->xStats, pxServerStatus[ ucIndex ] );
+  }
+#endif
+
+  for( ucIndex = 0; ucIndex < p_client->ucServerCount; ucIndex++ )
+  {
+    if( ( pxServerStatus[ ucIndex ] == SNTPEX_SUCCESS ) || ( xLibReturnCode != SNTPEX_SUCCESS ) )
+    {
+      xLibReturnCode = pxServerStatus[ ucIndex ];
+    }
+
+    /* Keep the strongest kiss code of the rejecting servers, DENY and RSTR before RATE */
+    if( ( pxServerStatus[ ucIndex ] == SNTPEX_ERR_REQUEST_REJECTED ) &&
+        ( ulKissCode != exlibSNTP_KOD_DENY ) && ( ulKissCode != exlibSNTP_KOD_RSTR ) &&
+        ( ( ulKissCode == 0u ) || ( p_client->xServerList[ ucIndex ].kissCode == exlibSNTP_KOD_DENY ) ||
+          ( p_client->xServerList[ ucIndex ].kissCode == exlibSNTP_KOD_RSTR ) ||
+          ( p_client->xServerList[ ucIndex ].kissCode == exlibSNTP_KOD_RATE ) ) )
+    {
+      ulKissCode = p_client->xServerList[ ucIndex ].kissCode;
+    }
+  }
+
+  /* The servers replied but no majority agrees, the round is discarded and the poll is not adapted */
+  if( ( xLibReturnCode == SNTPEX_SUCCESS ) && ( xSelectCode != SNTPEX_SUCCESS ) )
+  {
+    xLibReturnCode = SNTPEX_ERROR;
+  }
+
+  /* Schedule the next request, the kiss of a server slows down the poll when no server replied */
+  prv_utility_poll_update( p_client, ( ( xLibReturnCode != SNTPEX_SUCCESS ) && ( ulKissCode != 0u ) ) ? SNTPEX_ERR_REQUEST_REJECTED : xLibReturnCode,
+                           ulKissCode, p_client->vtable_api.get_os_tick() );
+
+  if( xLibReturnCode == SNTPEX_SUCCESS )
+  {
+    return SNTPEX_SUCCESS;
+  }
+
+  /* No server replied, a transmission error fails over to the next bound interface */
+  if( xLibReturnCode == SNTPEX_ERR_TX )
+  {
+    sntp_sapi[ UD_SNTP_CLIENT_STATE_CLOSE ].execFuntion( p_client );
+    prv_utility_interface_failover( p_client, xLibReturnCode );
+  }
+
+  /* Return the error status. */
+  return xLibReturnCode;
+}
+#endif /* exlibSNTP_CONFIG_MULTI_SERVER */
+
+#if ( exlibSNTP_CONFIG_BROADCAST == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   calibrate the broadcast mode delay with one unicast exchange with the configured server.
+ *          Must be called before @ref sntpex_client_broadcast_listen .
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   xTimestampCtx: Pointer to timestamp list, filled by the unicast exchange.
+ *          This parameter can be a value of @ref struct xTimestampCtx_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_broadcast_calibrate( sntpex_client_handle_t *p_client, struct xTimestampCtx_t * xTimestampCtx )
+{
+  /* Make sure that the SNTP client context and timestamp context are valid */
+  if( ( NULL == p_client ) || ( NULL == xTimestampCtx ))
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  struct xSntpSample_t xSample;
+
+  /* The unicast exchange is sent with the request socket, return the error status. */
+  sntp_ud_t xLibReturnCode = sntpex_client_timestamp_get( p_client, xTimestampCtx );
+
+  if( xLibReturnCode == SNTPEX_SUCCESS )
+  {
+    xLibReturnCode = sntpex_sample_compute( xTimestampCtx, &xSample );
+  }
+
+  if( xLibReturnCode == SNTPEX_SUCCESS )
+  {
+    /** @remark The broadcast path is assumed symmetric with the unicast one. The whole round-trip delay
+     *  is stored, the synthesized exchange of @ref sntpex_client_broadcast_step applies half of it */
+    p_client->llBroadcastDelay = xSample.delay;
+  }
+
+  /* Return the error status. */
+  return xLibReturnCode;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   start the broadcast listen mode, the client socket is bound to the NTP port.
+ *          The request APIs are not available until @ref sntpex_client_broadcast_stop .
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pxGroup: Pointer to the IPV4 or IPV6 multicast group to join, NULL to only receive the IPV4 broadcasts.
+ *          This parameter can be a value of @ref const SlNetSock_Addr_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_broadcast_listen( sntpex_client_handle_t *p_client, const SlNetSock_Addr_t *pxGroup )
+{
+  /* Make sure the SNTP client context is valid */
+  if( NULL == p_client )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Make sure the SNTP client is initialized and the multicast group family is supported */
+  if( ( NULL == p_client->sock ) || ( ( NULL != pxGroup ) && ( 0u == prv_utility_address_length( pxGroup ) ) ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_FAULT_INIT;
+  }
+
+  struct vsocket   * p_socket = p_client->sock;
+  int32_t            SLReturnCode = SLNETERR_RET_CODE_OK;
+
+  /** @remark RFC 4330 section 5 : the broadcast servers send to the NTP port. IPV6 has no broadcast,
+   *  the socket family is the one of the group */
+  sntp_ud_t xLibReturnCode = prv_utility_listen_open( p_client, ( NULL != pxGroup ) ? pxGroup->sa_family : ( uint16_t )SLNETSOCK_AF_INET );
+
+  if( xLibReturnCode != SNTPEX_SUCCESS )
+  {
+    /* Return the error status. */
+    return xLibReturnCode;
+  }
+
+  if( ( NULL != pxGroup ) && ( pxGroup->sa_family == SLNETSOCK_AF_INET ) )
+  {
+    /* Join the multicast group (224.0.1.1 is assigned to NTP) */
+    SlNetSock_IpMreq_t xMembership;
+
+    xMembership.imr_multiaddr = ( ( const SlNetSock_AddrIn_t * )pxGroup )->sin_addr;
+    xMembership.imr_interface = SLNETSOCK_INADDR_ANY;
+
+    SLReturnCode = SlNetSock_setOpt( p_socket->fd, SLNETSOCK_LVL_IP, SLNETSOCK_OPIP_ADD_MEMBERSHIP, &xMembership, sizeof( xMembership ) );
+  }
+#if ( exlibSNTP_CONFIG_IPV6 == 1 )
+  else if( NULL != pxGroup )
+  {
+    /* Join the IPV6 multicast group (ff0X::101 is assigned to NTP) on the bound interface */
+    SlNetSock_IpV6Mreq_t xMembership;
+
+    ( void )memset( &xMembership, 0, sizeof( xMembership ) );
+    ( void )memcpy( &xMembership.ipv6mr_multiaddr, &( ( const SlNetSock_AddrIn6_t * )pxGroup )->sin6_addr, sizeof( xMembership.ipv6mr_multiaddr ) );
+
+    SLReturnCode = SlNetSock_setOpt( p_socket->fd, SLNETSOCK_LVL_IP, SLNETSOCK_OPIPV6_ADD_MEMBERSHIP, &xMembership, sizeof( xMembership ) );
+  }
+#endif
+  else
+  {
+    /* Broadcasts only, Do Nothing : MISRA 15.7 */
+  }
+
+  if( SLReturnCode < 0 )
+  {
+    /* close the listening socket, return the error status. */
+    sntp_sapi[ UD_SNTP_CLIENT_STATE_CLOSE ].execFuntion( p_client );
+    return SNTPEX_ERR_SOCKET_SET_OPT;
+  }
+
+  p_client->options |= exlibSNTP_CLIENT_OPT_BROADCAST;
+
+  /* register receive event from ISR, the first broadcast is timestamped by the Spawn task */
+  prv_utility_register_event( p_client, exlibSNTP_SOFTSR_RECV_BIT, p_client->pfEventNotify );
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   handle the next received broadcast packet (mode 5), the socket is polled without waiting.
+ *          It can be called from the task woken up by @ref p_client->pfEventNotify .
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   xTimestampCtx: Pointer to timestamp list, T1 and T2 are synthesized from the calibrated delay.
+ *          This parameter can be a value of @ref struct xTimestampCtx_t *.
+ * @retval  SNTPEX_SUCCESS when the timestamp list is ready, SNTPEX_PENDING when no packet is received,
+ *          A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_broadcast_step( sntpex_client_handle_t *p_client, struct xTimestampCtx_t * xTimestampCtx )
+{
+  /* Make sure that the SNTP client context and timestamp context are valid */
+  if( ( NULL == p_client ) || ( NULL == xTimestampCtx ))
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Make sure the listen mode is started */
+  if( ( NULL == p_client->sock ) || ( 0u == ( p_client->options & exlibSNTP_CLIENT_OPT_BROADCAST ) ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_FAULT_INIT;
+  }
+
+  struct vsocket      * p_socket = p_client->sock;
+  struct xSntpPacket_t  xPacket;
+  SlNetSock_SdSet_t     xReadSet;
+  SlNetSock_Timeval_t   xNoWait  = { 0, 0 };
+  sntpex_sockaddr_t     xFromAddr;
+  SlNetSocklen_t        xFromLength = sizeof( xFromAddr );
+  uint64_t              ullReceiveTs;
+
+  SlNetSock_sdsClrAll( &xReadSet );
+  SlNetSock_sdsSet( p_socket->fd, &xReadSet );
+
+  int32_t SLReturnCode = SlNetSock_select( p_socket->fd + 1, &xReadSet, NULL, NULL, &xNoWait );
+
+  if( SLReturnCode == 0 )
+  {
+    /* Nothing received yet, return the pending status. */
+    return SNTPEX_PENDING;
+  }
+  else if( SLReturnCode < 0 )
+  {
+    /* Error on the socket, return the error status. */
+    return SNTPEX_ERR_RX;
+  }
+  else
+  {
+    /* Do Nothing : MISRA 15.7 */
+  }
+
+  /* Read data from socket, the extension fields and MAC are not used in broadcast mode */
+  SLReturnCode = SlNetSock_recvFrom( p_socket->fd, p_client->payload, sizeof( p_client->payload ), 0, &xFromAddr.sa, &xFromLength );
+
+  if( SLNETERR_BSD_EAGAIN == SLReturnCode )
+  {
+    /* Spurious wake-up, return the pending status. */
+    return SNTPEX_PENDING;
+  }
+
+  /* save the reference unix 64 timestamp T4 of this broadcast, the receive event stays armed for the next ones */
+  ullReceiveTs = prv_utility_rx_timestamp_get( p_client, prv_utility_listen_event_take( p_client ) );
+
+  if( SLReturnCode < 0 )
+  {
+    /* Error receive NTP packet, return the error status. */
+    return SNTPEX_ERR_RX;
+  }
+
+  /** @remark Broadcast mode can not be authenticated by the nonce, when a servers list is configured
+   *  only its members are trusted */
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+  uint8_t ucIndex;
+
+  for( ucIndex = 0; ucIndex < p_client->ucServerCount; ucIndex++ )
+  {
+    if( 0u != prv_utility_address_equal( &p_client->xServerList[ ucIndex ].SocketAddr, &xFromAddr ) )
+    {
+      break;
+    }
+  }
+
+  if( ( p_client->ucServerCount != 0 ) && ( ucIndex == p_client->ucServerCount ) )
+#else
+  if( ( p_socket->descriptor.InAddLength != 0u ) && ( 0u == prv_utility_address_equal( &p_socket->descriptor.SocketAddr, &xFromAddr ) ) )
+#endif
+  {
+    /* Unknown server, return the error status. */
+    return SNTPEX_ERR_INVALID_MESSAGE;
+  }
+
+#if ( exlibSNTP_CONFIG_AUTH == 1 )
+  /* The broadcast packets are signed with the selected key */
+  if( ( NULL != p_client->pxActiveKey ) &&
+      ( sntpex_auth_verify( &p_client->vtable_api, p_client->pxActiveKey, p_client->payload, ( uint16_t )SLReturnCode ) != SNTPEX_SUCCESS ) )
+  {
+    /* return the error status. */
+    return SNTPEX_ERR_AUTH;
+  }
+#endif
+
+  /* Decode the NTP packet, only the broadcast packets of a synchronized server are used */
+  if( ( sntpex_packet_decode( p_client->payload, ( uint16_t )SLReturnCode, &xPacket ) != SNTPEX_SUCCESS ) ||
+      ( xPacket.vn == 0 ) || ( xPacket.mode != specNTP_MODE_BROADCAST ) || ( xPacket.stratum == 0 ) ||
+      ( ( xPacket.transmitTimestamp.seconds == 0 ) && ( xPacket.transmitTimestamp.fraction == 0 ) ) )
+  {
+    /* return the error status. */
+    return SNTPEX_ERR_INVALID_MESSAGE;
+  }
+
+  /* The broadcast of a server which is not synchronized is discarded */
+  if( ( xPacket.li == specNTP_LI_ALARM ) || ( xPacket.stratum >= specNTP_STRATUM_UNSYNC ) )
+  {
+    /* return the error status. */
+    return SNTPEX_ERR_UNSYNCHRONIZED;
+  }
+
+  /* export the server header fields and the reference and transmit timestamps ( 32 bit sec, 32 bit frac ) */
+  prv_utility_server_info_get( &xPacket, &xTimestampCtx->server );
+  xTimestampCtx->referenceTimestamp = xPacket.referenceTimestamp;
+  xTimestampCtx->receiveTimestamp   = xPacket.transmitTimestamp;
+  xTimestampCtx->transmitTimestamp  = xPacket.transmitTimestamp;
+
+  /** @remark No request is sent, the exchange is synthesized : T2 = T3 and T1 = T4 - delay, so that
+   *  offset = T3 + delay/2 - T4 and the round-trip delay is the calibrated one */
+  xTimestampCtx->transmit64_ts  = prv_utility_ntp_to_epoch( xPacket.transmitTimestamp.seconds, xPacket.transmitTimestamp.fraction );
+  xTimestampCtx->receive64_ts   = xTimestampCtx->transmit64_ts;
+  xTimestampCtx->reference64_ts = ullReceiveTs;
+  xTimestampCtx->originate64_ts = ullReceiveTs - ( uint64_t )p_client->llBroadcastDelay;
+
+  /* Feed the clock filter with the new sample */
+  p_client->xTimestampList = xTimestampCtx;
+  prv_utility_filter_update( p_client, &xFromAddr.sa );
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   stop the broadcast listen mode, the listening socket is closed.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_broadcast_stop( sntpex_client_handle_t *p_client )
+{
+  /* Make sure the SNTP client context is valid */
+  if( NULL == p_client )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  if( 0u != ( p_client->options & exlibSNTP_CLIENT_OPT_BROADCAST ) )
+  {
+    /* unregister receive event from ISR, close the listening socket and change library state to opened */
+    p_client->options &= ( uint8_t )~exlibSNTP_CLIENT_OPT_BROADCAST;
+    prv_utility_unregister_event( p_client, exlibSNTP_SOFTSR_RECV_BIT );
+    sntp_sapi[ UD_SNTP_CLIENT_STATE_CLOSE ].execFuntion( p_client );
+  }
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+#endif /* exlibSNTP_CONFIG_BROADCAST */
+
+#if ( exlibSNTP_CONFIG_RESPONDER == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   start the responder mode, the socket of the responder client is bound to the NTP port and the
+ *          mode 3 requests are answered with the time of the upstream client.
+ *          The request APIs of the responder client are not available until @ref sntpex_client_responder_stop .
+ * @param   p_responder: Pointer to the sntp client handle answering the requests, initialized by @ref sntpex_clientInitialization .
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   p_upstream: Pointer to the sntp client handle disciplined by the upstream servers.
+ *          This parameter can be a value of @ref const sntpex_client_handle_t *.
+ * @param   Family: Address family (IPV4/IPV6) of the answered requests, one responder per family.
+ *          This parameter can be a value of @ref uint8_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_responder_start( sntpex_client_handle_t *p_responder, const sntpex_client_handle_t *p_upstream, uint8_t Family )
+{
+  /* Make sure the SNTP client contexts are valid */
+  if( ( NULL == p_responder ) || ( NULL == p_upstream ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Make sure the SNTP client is initialized, the upstream client must be another handle */
+  if( ( NULL == p_responder->sock ) || ( p_responder == p_upstream ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_FAULT_INIT;
+  }
+
+  /** @remark RFC 4330 section 6 : the clients send their requests to the NTP port, the socket is bound
+   *  to the any address of the family. An unsupported family is rejected by the socket opening */
+  sntp_ud_t xLibReturnCode = prv_utility_listen_open( p_responder, ( uint16_t )Family );
+
+  if( xLibReturnCode != SNTPEX_SUCCESS )
+  {
+    /* Return the error status. */
+    return xLibReturnCode;
+  }
+
+  p_responder->pxUpstream = p_upstream;
+  p_responder->options   |= exlibSNTP_CLIENT_OPT_RESPONDER;
+
+  /* register receive event from ISR, the receive timestamp (T2) of every request is kept on the event ring */
+  prv_utility_register_event( p_responder, exlibSNTP_SOFTSR_RECV_BIT, p_responder->pfEventNotify );
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   answer the next received request, the socket is polled without waiting.
+ *          It can be called from the task woken up by @ref p_responder->pfEventNotify , until it returns SNTPEX_PENDING.
+ * @param   p_responder: Pointer to the sntp client handle answering the requests
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS when a reply is sent, SNTPEX_PENDING when no request is received,
+ *          A specific error type @ref sntp_ud_t otherwise (the request is dropped).
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_responder_step( sntpex_client_handle_t *p_responder )
+{
+  /* Make sure the SNTP client context is valid */
+  if( NULL == p_responder )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Make sure the responder mode is started */
+  if( ( NULL == p_responder->sock ) || ( NULL == p_responder->pxUpstream ) ||
+      ( 0u == ( p_responder->options & exlibSNTP_CLIENT_OPT_RESPONDER ) ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_FAULT_INIT;
+  }
+
+  struct vsocket               * p_socket   = p_responder->sock;
+  const sntpex_client_handle_t * p_upstream = p_responder->pxUpstream;
+  struct xSntpPacket_t           xRequest;
+  struct xSntpPacket_t           xReply;
+  struct xSntpResponderInfo_t    xInfo;
+  SlNetSock_SdSet_t              xReadSet;
+  SlNetSock_Timeval_t            xNoWait  = { 0, 0 };
+  sntpex_sockaddr_t              xFromAddr;
+  SlNetSocklen_t                 xFromLength = sizeof( xFromAddr );
+  uint64_t                       ullReceiveTs;
+  uint16_t                       usLength;
+
+  SlNetSock_sdsClrAll( &xReadSet );
+  SlNetSock_sdsSet( p_socket->fd, &xReadSet );
+
+  int32_t SLReturnCode = SlNetSock_select( p_socket->fd + 1, &xReadSet, NULL, NULL, &xNoWait );
+
+  if( SLReturnCode == 0 )
+  {
+    /* Nothing received yet, return the pending status. */
+    return SNTPEX_PENDING;
+  }
+  else if( SLReturnCode < 0 )
+  {
+    /* Error on the socket, return the error status. */
+    return SNTPEX_ERR_RX;
+  }
+  else
+  {
+    /* Do Nothing : MISRA 15.7 */
+  }
+
+  /* Read the request into the handle payload, the reply is built in place without any allocation */
+  SLReturnCode = SlNetSock_recvFrom( p_socket->fd, p_responder->payload, sizeof( p_responder->payload ), 0, &xFromAddr.sa, &xFromLength );
+
+  if( SLNETERR_BSD_EAGAIN == SLReturnCode )
+  {
+    /* Spurious wake-up, return the pending status. */
+    return SNTPEX_PENDING;
+  }
+
+  /* save the receive timestamp T2 of this request, the receive event stays armed for the next requests */
+  ullReceiveTs = prv_utility_rx_timestamp_get( p_responder, prv_utility_listen_event_take( p_responder ) );
+
+  if( SLReturnCode < 0 )
+  {
+    /* Error receive NTP request, return the error status. */
+    return SNTPEX_ERR_RX;
+  }
+
+
+#if ( exlibSNTP_CONFIG_AUTH == 1 )
+  /* The requests are signed with the selected key */
+  if( ( NULL != p_responder->pxActiveKey ) &&
+      ( sntpex_auth_verify( &p_responder->vtable_api, p_responder->pxActiveKey, p_responder->payload, ( uint16_t )SLReturnCode ) != SNTPEX_SUCCESS ) )
+  {
+    /* return the error status. */
+    return SNTPEX_ERR_AUTH;
+  }
+#endif
+
+  /* Decode the request, only the client requests (mode 3) are answered */
+  if( sntpex_packet_decode( p_responder->payload, ( uint16_t )SLReturnCode, &xRequest ) != SNTPEX_SUCCESS )
+  {
+    /* return the error status. */
+    return SNTPEX_ERR_INVALID_MESSAGE;
+  }
+
+  /** @remark Both clients read the same local clock, the raw timestamps of the responder are converted
+   *  with the discipline of the upstream client. T3 is read last, right before the transmission */
+  ( void )sntpex_responder_info_get( p_upstream, ullReceiveTs, &xInfo );
+
+  if( sntpex_responder_reply_build( &xRequest, &xInfo,
+                                    sntpex_discipline_time_get( &p_upstream->xDiscipline, ullReceiveTs ),
+                                    sntpex_discipline_time_get( &p_upstream->xDiscipline, p_responder->vtable_api.get_unix_timestamp() ),
+                                    &xReply ) != SNTPEX_SUCCESS )
+  {
+    /* return the error status. */
+    return SNTPEX_ERR_INVALID_MESSAGE;
+  }
+
+  ( void )sntpex_packet_encode( &xReply, p_responder->payload, sizeof( p_responder->payload ), &usLength );
+
+#if ( exlibSNTP_CONFIG_AUTH == 1 )
+  if( ( NULL != p_responder->pxActiveKey ) &&
+      ( sntpex_auth_sign( &p_responder->vtable_api, p_responder->pxActiveKey, p_responder->payload,
+                          sizeof( p_responder->payload ), &usLength ) != SNTPEX_SUCCESS ) )
+  {
+    /* return the error status. */
+    return SNTPEX_ERR_AUTH;
+  }
+#endif
+
+  p_responder->payloadLen = usLength;
+
+  /* Send the reply to the requesting peer */
+  SLReturnCode = SlNetSock_sendTo( p_socket->fd, p_responder->payload, usLength, 0, &xFromAddr.sa, xFromLength );
+
+  /* Return the error status. */
+  return ( SLReturnCode == ( int32_t )usLength ) ? SNTPEX_SUCCESS : SNTPEX_ERR_TX;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   stop the responder mode, the listening socket is closed.
+ * @param   p_responder: Pointer to the sntp client handle answering the requests
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_responder_stop( sntpex_client_handle_t *p_responder )
+{
+  /* Make sure the SNTP client context is valid */
+  if( NULL == p_responder )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  if( 0u != ( p_responder->options & exlibSNTP_CLIENT_OPT_RESPONDER ) )
+  {
+    /* unregister receive event from ISR, close the listening socket and change library state to opened */
+    p_responder->options   &= ( uint8_t )~exlibSNTP_CLIENT_OPT_RESPONDER;
+    p_responder->pxUpstream = NULL;
+    prv_utility_unregister_event( p_responder, exlibSNTP_SOFTSR_RECV_BIT );
+    sntp_sapi[ UD_SNTP_CLIENT_STATE_CLOSE ].execFuntion( p_responder );
+  }
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+#endif /* exlibSNTP_CONFIG_RESPONDER */
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   convert NTP timestamp (host order seconds, fraction) to 64-UNIX time in microseconds.
+ * @param   ulSeconds: NTP seconds.
+ *          This parameter can be a value of @ref uint32_t.
+ * @param   ulFraction: NTP fraction.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  unix-64 timestamp in microseconds, this parameter can be a value of @ref uint64_t.
+ */
+#pragma optimize=speed
+uint64_t sntpex_ntp_to_unix64_us( uint32_t ulSeconds, uint32_t ulFraction )
+{
+  return prv_utility_ntp_to_epoch( ulSeconds, ulFraction );
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   convert 64-UNIX time in microseconds to NTP timestamp (host order seconds, fraction).
+ * @param   ullTime: unix-64 timestamp in microseconds.
+ *          This parameter can be a value of @ref uint64_t.
+ * @param   pxTimestamp: Pointer to the NTP timestamp, the era 1 (2036-2104) wraps the seconds.
+ *          This parameter can be a value of @ref NtpTimestamp *.
+ * @retval  None.
+ */
+#pragma optimize=speed
+void sntpex_unix64_us_to_ntp( uint64_t ullTime, NtpTimestamp * pxTimestamp )
+{
+  uint64_t ullMicros = ullTime % 1000000u;
+
+  /** @remark The seconds are truncated to 32 bits (NTP era), the fraction is rounded up so that
+   *  @ref sntpex_ntp_to_unix64_us returns the same microseconds */
+  pxTimestamp->seconds  = ( uint32_t )( ( ullTime / 1000000u ) + ( uint64_t )exlibDIFF_SEC_1900_1970 );
+  pxTimestamp->fraction = ( uint32_t )( ( ( ullMicros << 32 ) + 999999u ) / 1000000u );
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   convert NTP timestamp (host order seconds, fraction) to 64-UNIX time in nanoseconds.
+ * @param   ulSeconds: NTP seconds.
+ *          This parameter can be a value of @ref uint32_t.
+ * @param   ulFraction: NTP fraction.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  unix-64 timestamp in nanoseconds, this parameter can be a value of @ref uint64_t.
+ */
+#pragma optimize=speed
+uint64_t sntpex_ntp_to_unix64_ns( uint32_t ulSeconds, uint32_t ulFraction )
+{
+  return prv_utility_ntp_to_epoch_ns( ulSeconds, ulFraction );
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   convert NTP timestamp (host order seconds, fraction) to native NTP-64 format (32.32 fixed-point).
+ * @param   ulSeconds: NTP seconds.
+ *          This parameter can be a value of @ref uint32_t.
+ * @param   ulFraction: NTP fraction.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  NTP-64 value, this parameter can be a value of @ref uint64_t.
+ */
+#pragma optimize=speed
+uint64_t sntpex_ntp_to_ntp64( uint32_t ulSeconds, uint32_t ulFraction )
+{
+  /* Seconds on the 32 upper bits, fraction on the 32 lower bits, independent from the host endianness */
+  return ( ( uint64_t )ulSeconds << 32 ) | ( uint64_t )ulFraction;
+}
+/** @} */
+/** @} */
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+  * @{
+  */
+/* Private function   ------------------------------------------------------------*/
+/**
+ * @defgroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief Private functions used by @ref sntp_ex_lib_ti.c .
+ * @note  All these functions is declared as static to avoid application call.
+ *       + @ref sFct_sntp_OpenConnection
+ *       + @ref sFct_sntp_ReceiveResponse
+ *       + @ref sFct_sntp_SendRequest
+ *       + @ref sFct_sntp_HandlingResponse
+ *       + @ref sFct_sntp_CloseConnection
+ *       + @ref prv_utility_build_request
+ *       + @ref prv_utility_ntp_to_epoch
+ *       + @ref prv_utility_register_event 
+ *       + @ref prv_utility_unregister_event 
+ *       + @ref prv_utility_dispatch_event 
+ *       + @ref prv_utility_match_server 
+ *       + @ref prv_utility_nonce_generate 
+ *       + @ref prv_utility_nonce_equal 
+ *       + @ref prv_utility_release_connection 
+ *       + @ref prv_utility_interface_failover 
+ *       + @ref prv_utility_flush_socket 
+ *       + @ref prv_utility_filter_update 
+ *       + @ref prv_utility_sample_update 
+ *       + @ref prv_utility_poll_update 
+ *       + @ref prv_utility_sync_source_set 
+ *       + @ref prv_utility_listen_open 
+ *       + @ref prv_utility_listen_event_take 
+ *       + @ref prv_utility_server_info_get 
+ *       + @ref prv_utility_client_register 
+ *       + @ref prv_utility_client_unregister 
+ *       + @ref prv_utility_client_registered 
+ *       + @ref prv_utility_address_length 
+ *       + @ref prv_utility_address_equal 
+ * @{
+ */
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Build the sntp request.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   p_payload: Pointer to the payload.
+ *          This parameter can be a value of @ref void *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+__STATIC_INLINE sntp_ud_t prv_utility_build_request( sntpex_client_handle_t * p_client, void * p_payload )
+{
+  struct xSntpPacket_t xRequest;
+  uint16_t             usLength = 0;
+
   /** @remark The client initializes the NTP payload header. For this purpose, all the NTP 
    *  header fields are set to 0, except the Mode, VN, and optional Transmit Timestamp fields*/
-  memset( request, 0, sizeof( struct x_sntp_request ));
+  memset( &xRequest, 0, sizeof( struct xSntpPacket_t ));
+
+  /* Format the NTP request */
+  xRequest.vn        = specNTP_VERSION_V4;
+  xRequest.mode      = specNTP_MODE_CLIENT;
+  xRequest.stratum   = 2;
+#if ( exlibSNTP_CONFIG_POLL == 1 )
+  xRequest.poll      = p_client->xPoll.exponent;
+#else
+  xRequest.poll      = exlibSNTP_POLL_MIN_EXPONENT;
+#endif
+  xRequest.precision = ( int8_t )0xec; /* -20 */
+
+  /** @remark The Transmit Timestamp allows a simple calculation to determine the
+   *  propagation delay between the server and client and to align the system
+   *  clock generally within a few tens of milliseconds relative to the server */
+
+  /** @remark The Transmit Timestamp is not the request time (T1 is captured locally on the transmission),
+   *  it carries an unpredictable nonce echoed by the server in the Originate Timestamp. A forged reply must
+   *  guess 64 random bits, and the back-to-back requests are distinguishable */
+  prv_utility_nonce_generate( p_client, &p_client->expected_orig_ts );
+  xRequest.transmitTimestamp = p_client->expected_orig_ts;
+
+  /* Serialise the request straight into the payload */
+  if( sntpex_packet_encode( &xRequest, ( uint8_t * )p_payload, exlibSNTP_TIME_MESSAGE_MAX_SIZE, &usLength ) != SNTPEX_SUCCESS )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_INVALID_MESSAGE;
+  }
+
+#if ( exlibSNTP_CONFIG_AUTH == 1 )
+  /* Append the Key Identifier and the MAC of the selected key, the keys are validated at their addition */
+  if( ( NULL != p_client->pxActiveKey ) &&
+      ( sntpex_auth_sign( &p_client->vtable_api, p_client->pxActiveKey, ( uint8_t * )p_payload,
+                          exlibSNTP_TIME_MESSAGE_MAX_SIZE, &usLength ) != SNTPEX_SUCCESS ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_AUTH;
+  }
+#endif
+
+  /* save the payload length */
+  p_client->payloadLen = usLength;
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Open the sntp connection ( socket creation, set opts...)
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+static sntp_ud_t sFct_sntp_OpenConnection( sntpex_client_handle_t * p_client )
+{
+  /* Point to the socket extended Library structure */
+  struct vsocket * p_socket   = ( struct vsocket *)p_client->sock;
+
+  void           * socket_opt = NULL;
+  uint32_t         opt_length = 0;
+  int16_t          opt_name   = 0;
+  int32_t          SLReturnCode = SLNETERR_RET_CODE_OK;
+
+  if ( NULL == p_socket )
+  {
+    /* sntpex_client is not initialized yet, Return the error status*/
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Reuse the persistent socket, when it is created for the same address family and interface */
+  if ( ( 0u != ( p_client->options & exlibSNTP_CLIENT_OPT_PERSISTENT_SOCKET ) ) &&
+       ( p_socket->fd != -1 ) &&
+       ( p_socket->openFamily    == p_socket->descriptor.SocketAddr.sa.sa_family ) &&
+       ( p_socket->openInterface == p_client->interface ) )
+  {
+    /* Socket is already opened and configured, change library state to sending */
+    p_client->state = UD_SNTP_CLIENT_STATE_SENDING;
+
+    /* return the error status. */
+    return SNTPEX_SUCCESS;
+  }
+
+  /* close previous UDP socket only when it is opened */
+  if ( p_socket->fd != -1 )
+  {
+    /* close previous UDP socket */
+    SlNetSock_close( p_socket->fd );
+
+    /* reset virtual socket descriptor */
+    p_socket->fd = -1;
+  }
+
+  /* Create a UDP socket to communicate with NTP server */
+  p_socket->fd = SlNetSock_create( p_socket->descriptor.SocketAddr.sa.sa_family,
+                                   p_socket->descriptor.type,
+                                   p_socket->descriptor.protocol,
+                                   p_client->interface,
+                                   0 );
+  if ( p_socket->fd < 0 )
+  {
+    /* Socket cannot be created, return the error status. */
+    return SNTPEX_ERR_SOCKET_CREATE;
+  }
+
+#ifdef exlibSNTP_CLIENT_USE_NONBLOCKING_TIMEOUT_OPTION  
+
+  /** @remark Non blocking Timeout option, so timeout mecanism is handled on the @ref sntp_ex_ti_lib file
+   *  Keep pooling until the return status is different from @ref SLNETERR_BSD_EAGAIN and timeout is not occured */
+  SlNetSock_Nonblocking_t enableOption =
+  {
+    .nonBlockingEnabled = 1, 
+  };
+
+  socket_opt = &enableOption;
+  opt_name   = SLNETSOCK_OPSOCK_NON_BLOCKING;
+  opt_length = sizeof( enableOption );
+
+#else
+
+  /** @remark blocking Timeout option, so timeout mecanism is handled on the TI TCP Stack.
+   *  The timeout value is @ref p_client->sock->descriptor.timeout */
+  socket_opt = &p_client->sock->descriptor.timeout;
+  opt_name   = SLNETSOCK_OPSOCK_RCV_TIMEO;
+  opt_length = sizeof( SlNetSock_Timeval_t );
+
+#endif /* exlibSNTP_CLIENT_USE_NONBLOCKING_TIMEOUT_OPTION */
+  
+  /* Setting socket options */
+  SLReturnCode = SlNetSock_setOpt( p_client->sock->fd,
+                                   SLNETSOCK_LVL_SOCKET,
+                                   opt_name,
+                                   socket_opt,
+                                   opt_length);
+  if ( SLReturnCode < 0 )
+  {
+    /* Setting socket options is failed, return the error status. */
+    return SNTPEX_ERR_SOCKET_SET_OPT;
+  }
+
+  /* Save the socket creation context, used to reuse the persistent socket */
+  p_socket->openFamily    = p_socket->descriptor.SocketAddr.sa.sa_family;
+  p_socket->openInterface = p_client->interface;
+
+  /* Everything is OK, change library state to sending */
+  p_client->state = UD_SNTP_CLIENT_STATE_SENDING;
+
+  /* return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   send the sntp request.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+static sntp_ud_t sFct_sntp_SendRequest( sntpex_client_handle_t * p_client )
+{
+
+  /* Point to the socket extended Library structure */
+  struct vsocket * p_socket   = ( struct vsocket *)p_client->sock;
+
+  int32_t          SLReturnCode = SLNETERR_RET_CODE_OK;
+
+  /* Discard the replies of previous requests queued on the reused socket */
+  prv_utility_flush_socket( p_client );
+
+  /* register receive event from ISR, before the request leaves the client so a fast reply is not missed */
+  prv_utility_register_event( p_client, exlibSNTP_SOFTSR_RECV_BIT, p_client->pfEventNotify );
+
+  /* Create NTP request which will be stored on the @ref p_client->payload with size @ref p_client->payloadLen */
+  if( prv_utility_build_request( p_client, p_client->payload ) != SNTPEX_SUCCESS )
+  {
+    /* The request cannot be signed, return the error status. */
+    return SNTPEX_ERR_AUTH;
+  }
+
+  /** @remark The originate unix 64 timestamp T1 is taken by @ref prv_utility_send_to on the transmission,
+   *  so the retries of a busy socket are not counted on the round-trip delay */
+
+  if( 0u != ( p_client->options & exlibSNTP_CLIENT_OPT_STEP_MODE ) )
+  {
+    /** @remark Step mode, a single attempt is done. The caller steps again while the socket is busy,
+     *  the timeout is counted from the request start @ref p_client->startTime */
+    SLReturnCode =  prv_utility_send_to( p_client,
+                                         &p_socket->descriptor.SocketAddr.sa,
+                                         p_socket->descriptor.InAddLength,
+                                         &p_client->xTimestampList->originate64_ts );
+
+    exlibSNTP_STATS_ADD( p_client, txEagain, ( SLNETERR_BSD_EAGAIN == SLReturnCode ) );
+
+    if( ( SLNETERR_BSD_EAGAIN == SLReturnCode ) && ( ( p_client->vtable_api.get_os_tick() - p_client->startTime ) < p_client->timeout ) )
+    {
+      /* Socket is busy, return the pending status. */
+      return SNTPEX_PENDING;
+    }
+  }
+  else
+  {
+#ifdef exlibSNTP_CLIENT_USE_NONBLOCKING_TIMEOUT_OPTION
+
+    /** @remark Non blocking Timeout option, so timeout mecanism is handled on the @ref sntp_ex_ti_lib file
+     *  Keep pooling until the return status is different from @ref SLNETERR_BSD_EAGAIN and timeout is not occured.
+     *  The timeout is counted from the request start @ref p_client->startTime , so the send and the receive
+     *  states share one timeout instead of waiting one timeout each */
+    do
+    {
+      /*  Write data to UDP socket, in order to will be sended to the configured server 
+          SLReturnCode will return the length of sended payload */
+      SLReturnCode =  prv_utility_send_to( p_client,
+                                           &p_socket->descriptor.SocketAddr.sa,
+                                           p_socket->descriptor.InAddLength,
+                                           &p_client->xTimestampList->originate64_ts );
+
+      exlibSNTP_STATS_ADD( p_client, txEagain, ( SLNETERR_BSD_EAGAIN == SLReturnCode ) );
+    }
+    while( ( SLReturnCode == ( SLNETERR_BSD_EAGAIN ) ) && ( ( p_client->vtable_api.get_os_tick() - p_client->startTime ) < p_client->timeout ) );
+
+#else
+
+    /** @remark blocking Timeout option, so timeout mecanism is handled on the TI TCP Stack.
+     *  The timeout value is @ref p_client->sock->descriptor.timeout */
+
+    /*  Write data to UDP socket, in order to will be sended to the configured server 
+        SLReturnCode will return the length of sended payload */
+    SLReturnCode =  prv_utility_send_to( p_client,
+                                         &p_socket->descriptor.SocketAddr.sa,
+                                         p_socket->descriptor.InAddLength,
+                                         &p_client->xTimestampList->originate64_ts );
+
+#endif /* exlibSNTP_CLIENT_USE_NONBLOCKING_TIMEOUT_OPTION */
+  }
+
+  if ( SLNETERR_BSD_EAGAIN == SLReturnCode )
+  {
+    /* Timeout is occured, return the error status. */
+    return SNTPEX_ERR_TIMEOUT;
+  }
+  else if ( ( SLReturnCode < 0 ) || ( SLReturnCode != ( int32_t )p_client->payloadLen ) )
+  {
+    /* Error send NTP request, return the error status. */
+    return SNTPEX_ERR_TX;
+  }
+  else
+  {
+    /* clear the payload, to will be used on the receive state */
+    ( void ) memset( &p_client->payload, 0, p_client->payloadLen );
+
+    /* Everything is OK, change library state to receiving */
+    p_client->state = UD_SNTP_CLIENT_STATE_RECEIVING;
+
+    /* return the error status. */
+    return SNTPEX_SUCCESS;
+  }
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   receive the sntp request
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+static sntp_ud_t sFct_sntp_ReceiveResponse( sntpex_client_handle_t *p_client )
+{
+
+  /* Point to the socket extended Library structure */
+  struct vsocket * p_socket   = ( struct vsocket *)p_client->sock;
+
+  int32_t          SLReturnCode = SLNETERR_RET_CODE_OK;
+
+  /* The source of the reply is received apart, the server address of the socket descriptor is kept */
+  sntpex_sockaddr_t xFromAddr;
+  SlNetSocklen_t    xFromLength;
+
+  /** @remark The receive event from ISR is registered by @ref sFct_sntp_SendRequest, before the request leaves the client */
+
+  if( 0u != ( p_client->options & exlibSNTP_CLIENT_OPT_STEP_MODE ) )
+  {
+    /** @remark Step mode, the socket is polled without waiting. The caller steps again (e.g. when woken up
+     *  by @ref p_client->pfEventNotify) until the reply is received or the timeout is occured */
+    SlNetSock_SdSet_t   xReadSet;
+    SlNetSock_Timeval_t xNoWait = { 0, 0 };
+
+    SlNetSock_sdsClrAll( &xReadSet );
+    SlNetSock_sdsSet( p_socket->fd, &xReadSet );
+
+    SLReturnCode = SlNetSock_select( p_socket->fd + 1, &xReadSet, NULL, NULL, &xNoWait );
+
+    exlibSNTP_STATS_ADD( p_client, rxEagain, ( SLReturnCode == 0 ) );
+
+    if( SLReturnCode == 0 )
+    {
+      /* Nothing received yet, return the pending status until timeout is occured. */
+      return ( ( p_client->vtable_api.get_os_tick() - p_client->startTime ) < p_client->timeout ) ? SNTPEX_PENDING : SNTPEX_ERR_TIMEOUT;
+    }
+    else if( SLReturnCode < 0 )
+    {
+      /* Error on the socket, return the error status. */
+      return SNTPEX_ERR_RX;
+    }
+
+    /* Read data from socket, SLReturnCode will return the length of received payload */
+    xFromLength  = sizeof( xFromAddr );
+    SLReturnCode =  SlNetSock_recvFrom( p_socket->fd,
+                                        &p_client->payload,
+                                        sizeof( p_client->payload ),
+                                        0,
+                                        &xFromAddr.sa,
+                                        &xFromLength );
+
+    if( SLNETERR_BSD_EAGAIN == SLReturnCode )
+    {
+      /* Spurious wake-up, return the pending status. */
+      return SNTPEX_PENDING;
+    }
+  }
+  else
+  {
+#ifdef exlibSNTP_CLIENT_USE_NONBLOCKING_TIMEOUT_OPTION
+
+    /** @remark Non blocking Timeout option, so timeout mecanism is handled on the @ref sntp_ex_ti_lib file
+     *  Keep pooling until the return status is different from @ref SLNETERR_BSD_EAGAIN and timeout is not occured.
+     *  The timeout is counted from the request start @ref p_client->startTime */
+    do
+    {
+      /* Read data from socket, SLReturnCode will return the length of received payload */
+      xFromLength  = sizeof( xFromAddr );
+      SLReturnCode =  SlNetSock_recvFrom( p_socket->fd,
+                                          &p_client->payload,
+                                          sizeof( p_client->payload ),
+                                          0,
+                                          &xFromAddr.sa,
+                                          &xFromLength );
+
+      exlibSNTP_STATS_ADD( p_client, rxEagain, ( SLNETERR_BSD_EAGAIN == SLReturnCode ) );
+    }
+    while( ( SLReturnCode == ( SLNETERR_BSD_EAGAIN ) ) && ( ( p_client->vtable_api.get_os_tick() - p_client->startTime ) < p_client->timeout ) );
+#else
+
+    /** @remark blocking Timeout option, so timeout mecanism is handled on the TI TCP Stack.
+     *  The timeout value is @ref p_client->sock->descriptor.timeout */
+
+    /* Read data from socket, SLReturnCode will return the length of received payload */
+    xFromLength  = sizeof( xFromAddr );
+    SLReturnCode =  SlNetSock_recvFrom( p_socket->fd,
+                                        &p_client->payload,
+                                        sizeof( p_client->payload ),
+                                        0,
+                                        &xFromAddr.sa,
+                                        &xFromLength );
+
+#endif /* exlibSNTP_CLIENT_USE_NONBLOCKING_TIMEOUT_OPTION */
+  }
+
+  if ( SLNETERR_BSD_EAGAIN == SLReturnCode )
+  {
+    /* Timeout is occured, return the error status. */
+    return SNTPEX_ERR_TIMEOUT;
+  }
+  else if ( SLReturnCode < 0 )
+  {
+    /* Error receive NTP request, return the error status. */
+    return SNTPEX_ERR_RX;
+  }
+  else if ( SLReturnCode < ( int32_t )exlibSNTP_PACKET_HEADER_SIZE )
+  {
+    /* invalid payload length, return the error status. */
+    return SNTPEX_ERR_INVALID_MESSAGE;
+  }
+  else
+  {
+    /** @remark The reply may be longer than the request, a MAC or extension fields follow the header.
+     *  The reply length is saved for the response handling */
+    p_client->payloadLen = ( size_t )SLReturnCode;
+
+    /* save the reference unix 64 timestamp T4, from the most accurate captured source */
+    p_client->xTimestampList->reference64_ts = prv_utility_rx_timestamp_get( p_client, prv_utility_rx_event_take( p_client ) );
+
+    /* unregister receive event from ISR */
+    prv_utility_unregister_event( p_client, exlibSNTP_SOFTSR_RECV_BIT );
+  
+    /* Everything is OK, change library state to handling response */
+    p_client->state = UD_SNTP_CLIENT_STATE_HANDLING_RSP;
+
+    /* return the error status. */
+    return SNTPEX_SUCCESS;
+  }
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   close the sntp connection
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+static sntp_ud_t sFct_sntp_CloseConnection( sntpex_client_handle_t * p_client )
+{
+  /* Point to the socket extended Library structure */
+  struct vsocket * p_socket   = ( struct vsocket * )p_client->sock;
+
+  if ( NULL == p_socket )
+  {
+    /* sntpex_client is not initialized yet, Return the error status*/
+    return SNTPEX_ERR_NULL_PTR;
+  }
+  
+  /* close UDP socket only when it is opened */
+  if ( p_client->sock->fd != -1 )
+  {
+    /* close previous UDP socket */
+    SlNetSock_close( p_client->sock->fd );
+
+    /* reset virtual socket descriptor */
+    p_client->sock->fd = -1;
+  }
+
+  /* Everything is OK, change library state to open connection */
+  p_client->state = UD_SNTP_CLIENT_STATE_OPEN;
+
+  /* return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Handling and verify the sntp response.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+static sntp_ud_t sFct_sntp_HandlingResponse( sntpex_client_handle_t * p_client )
+{
+  struct xSntpPacket_t  xResponse;
+  struct xSntpTrailer_t xTrailer;
+
+  /* Decode the NTP packet straight from the receive buffer, every field is converted once */
+  if( sntpex_packet_decode( p_client->payload, ( uint16_t )p_client->payloadLen, &xResponse ) != SNTPEX_SUCCESS )
+  {
+    /* return the error status. */
+    return SNTPEX_ERR_INVALID_MESSAGE;
+  }
+
+  /** @remark The extension fields and the MAC following the header must be well formed. A reply filling the
+   *  whole payload buffer may be truncated, its trailer is only checked by the authentication */
+  if( ( p_client->payloadLen < sizeof( p_client->payload ) ) &&
+      ( sntpex_packet_trailer_parse( p_client->payload, ( uint16_t )p_client->payloadLen, &xTrailer ) != SNTPEX_SUCCESS ) )
+  {
+    /* return the error status. */
+    return SNTPEX_ERR_INVALID_MESSAGE;
+  }
+    
+  /* The server reply should be discarded if the VN field is 0 */
+  if( xResponse.vn == 0 )
+  {
+    /* return the error status. */
+    return SNTPEX_ERR_INVALID_MESSAGE;
+  }
+
+  /* The server reply should be discarded if the Transmit Timestamp fields is 0 */
+  if( ( xResponse.transmitTimestamp.seconds == 0 ) && ( xResponse.transmitTimestamp.fraction == 0 ) )
+  {
+    /* return the error status. */
+    return SNTPEX_ERR_INVALID_MESSAGE;
+  }
+
+  /* The server reply should be discarded if the Mode field is not 4 (unicast) or 5 (broadcast) */
+  if(xResponse.mode != specNTP_MODE_SERVER && xResponse.mode != specNTP_MODE_BROADCAST)
+  {
+    /* return the error status. */
+    return SNTPEX_ERR_INVALID_MESSAGE;
+  }
+
+  /** Timestamp when the request was sent from client to server.
+   *  This is used to check if the originated timestamp in the server
+   *  reply matches the one in client request.
+   */
+  if ( 0 == prv_utility_nonce_equal( &xResponse.originateTimestamp, &p_client->expected_orig_ts ) )
+  {
+    /* return the error status. */
+    return SNTPEX_ERR_INVALID_MESSAGE;
+  }
+
+#if ( exlibSNTP_CONFIG_AUTH == 1 )
+  /** @remark An authenticated request expects a reply signed with the same key, a crypto-NAK or an
+   *  unsigned reply is rejected before any header field is trusted */
+  if( ( NULL != p_client->pxActiveKey ) &&
+      ( sntpex_auth_verify( &p_client->vtable_api, p_client->pxActiveKey, p_client->payload, ( uint16_t )p_client->payloadLen ) != SNTPEX_SUCCESS ) )
+  {
+    /* return the error status. */
+    return SNTPEX_ERR_AUTH;
+  }
+#endif
+
+#if ( exlibSNTP_CONFIG_POLL == 1 )
+  /* Save the server poll exponent, a rate limiting server returns its minimum accepted exponent */
+  p_client->xPoll.serverPoll = xResponse.poll;
+#endif
+
+  /* export the server header fields, also available for the rejected replies */
+  prv_utility_server_info_get( &xResponse, &p_client->xTimestampList->server );
+
+  /* Clear kiss code */
+  p_client->kissCode = 0;
+
+  /* Kiss-of-Death packet received? */
+  if(xResponse.stratum == 0)
+  {
+    /* The kiss code is encoded in four-character ASCII strings left justified and zero filled */
+    p_client->kissCode = xResponse.referenceId;
+
+    /* An SNTP client should stop sending to a particular server if that server returns a reply with a Stratum field of 0 */
+    return SNTPEX_ERR_REQUEST_REJECTED;
+  }
+
+  /** @remark RFC 4330 section 5 : the reply of a server which is not synchronized is discarded,
+   *  the alarm leap indicator or a stratum out of the 1-15 range */
+  if( ( xResponse.li == specNTP_LI_ALARM ) || ( xResponse.stratum >= specNTP_STRATUM_UNSYNC ) )
+  {
+    /* return the error status. */
+    return SNTPEX_ERR_UNSYNCHRONIZED;
+  }
+
+  /* export reference, receive and transmit timestamps ( 32 bit sec, 32 bit frac ) */
+  p_client->xTimestampList->referenceTimestamp = xResponse.referenceTimestamp;
+  p_client->xTimestampList->receiveTimestamp   = xResponse.receiveTimestamp;
+  p_client->xTimestampList->transmitTimestamp  = xResponse.transmitTimestamp;
+
+  /* export transmit timestamp ( 64 bit unix format ) */
+  p_client->xTimestampList->transmit64_ts = prv_utility_ntp_to_epoch( xResponse.transmitTimestamp.seconds,
+                                                                      xResponse.transmitTimestamp.fraction );
+
+  /* export receive timestamp ( 64 bit unix format ) */
+  p_client->xTimestampList->receive64_ts  = prv_utility_ntp_to_epoch( xResponse.receiveTimestamp.seconds,
+                                                                      xResponse.receiveTimestamp.fraction );
+
+  /* Everything is OK, change library state to complete */
+  p_client->state = UD_SNTP_CLIENT_STATE_COMPLETE;
+
+  /* return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Convert fraction to microseconds, usecs = ( fraction * 10^6 ) / 2^32
+ * @param   fraction: Number of fractions
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  Microseconds value, this parameter can be a value of @ref uint32_t.
+ */
+#pragma optimize=speed
+__STATIC_INLINE uint32_t prv_utility_frac_to_usecs( uint32_t fraction )
+{
+  /* Branch-free, one 32x32->64 multiply and a shift. The result is always lower than 10^6 */
+  return ( uint32_t )( ( ( uint64_t )fraction * 1000000u ) >> 32 );
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Convert fraction to nanoseconds, nsecs = ( fraction * 10^9 ) / 2^32
+ * @param   fraction: Number of fractions
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  Nanoseconds value, this parameter can be a value of @ref uint32_t.
+ */
+#pragma optimize=speed
+__STATIC_INLINE uint32_t prv_utility_frac_to_nsecs( uint32_t fraction )
+{
+  /* Branch-free, one 32x32->64 multiply and a shift. The result is always lower than 10^9 */
+  return ( uint32_t )( ( ( uint64_t )fraction * 1000000000u ) >> 32 );
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Convert NTP seconds to UNIX seconds, including the NTP era 1 (2036-2104)
+ * @param   ulSeconds: Number of NTP seconds
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  UNIX seconds, this parameter can be a value of @ref uint64_t.
+ */
+#pragma optimize=speed
+__STATIC_INLINE uint64_t prv_utility_ntp_to_unix_seconds( uint32_t ulSeconds )
+{
+  /** @remark RFC 4330 section 3 : when the MSB is set the time is reckoned from 1900 (1968-2036),
+   *  otherwise it is reckoned from 7 February 2036 (2036-2104), so 2^32 seconds are added */
+  return ( ( uint64_t )ulSeconds + ( ( uint64_t )( ~ulSeconds & 0x80000000u ) << 1 ) ) - ( uint64_t )exlibDIFF_SEC_1900_1970;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Convert NTP timestamp (seconds, fraction) to 64-UNIX time in microseconds
+ * @param   ulSeconds: Number of seconds
+ *          This parameter can be a value of @ref uint32_t.
+ * @param   fraction: Number of fractions
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  unix-64 timestamp, this parameter can be a value of @ref uint64_t.
+ */
+#pragma optimize=speed
+__STATIC_INLINE uint64_t prv_utility_ntp_to_epoch( uint32_t ulSeconds, uint32_t ulFraction )
+{
+  /** @remark Return the following calculated process :
+   *  Deduct the time difference in seconds between NTP 1900 and EPOCH 1970, widened to 64-bit before scaling,
+   *  then add the microseconds from the fraction part */
+  return ( prv_utility_ntp_to_unix_seconds( ulSeconds ) * 1000000u ) + ( uint64_t )prv_utility_frac_to_usecs( ulFraction );
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Convert NTP timestamp (seconds, fraction) to 64-UNIX time in nanoseconds
+ * @param   ulSeconds: Number of seconds
+ *          This parameter can be a value of @ref uint32_t.
+ * @param   fraction: Number of fractions
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  unix-64 timestamp in nanoseconds, this parameter can be a value of @ref uint64_t.
+ */
+#pragma optimize=speed
+__STATIC_INLINE uint64_t prv_utility_ntp_to_epoch_ns( uint32_t ulSeconds, uint32_t ulFraction )
+{
+  return ( prv_utility_ntp_to_unix_seconds( ulSeconds ) * 1000000000u ) + ( uint64_t )prv_utility_frac_to_nsecs( ulFraction );
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Register event and callback using @ref exlibSNTP_SOFTSR_RECV_BIT and @ref exlibSNTP_SOFTSR_SEND_BIT
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   eventbitField: event field 
+ *          This parameter can be a value of @ref uint8_t.
+ * @param   cb: callback function
+ *          This parameter can be a value of @ref pf_eventCallback.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_utility_register_event( sntpex_client_handle_t * p_client, uint8_t eventbitField, pf_eventCallback cb )
+{
+  /* register callback */
+  p_client->xAsynchEvent.event_cb  = cb;
+
+  /* Only the host IRQ captures taken from now belong to the awaited reply */
+  if( ( eventbitField & exlibSNTP_SOFTSR_RECV_BIT ) != 0 )
+  {
+    uint64_t ullUnused;
+
+    p_client->ulIrqArmSequence = prv_utility_irq_capture_read( &ullUnused );
+  }
+  
+  /* register event */
+  p_client->xAsynchEvent.event.SR |= eventbitField;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Unregister event and callback using @ref exlibSNTP_SOFTSR_RECV_BIT and @ref exlibSNTP_SOFTSR_SEND_BIT
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   eventbitField: event field 
+ *          This parameter can be a value of @ref uint8_t.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_utility_unregister_event( sntpex_client_handle_t * p_client, uint8_t eventbitField )
+{
+  /* Clear event from SR Soft register, first so the Spawn task does not capture it anymore */
+  p_client->xAsynchEvent.event.SR &= ~(eventbitField);
+
+  /** @remark The Spawn task reads the epoch before the flags, an event still captured with the flag set
+   *  carries the previous epoch and is discarded by @ref prv_utility_event_collect */
+  exlibSNTP_MEMORY_BARRIER();
+
+  /* Clear previous timestamps of the cleared events */
+  if( ( eventbitField & exlibSNTP_SOFTSR_RECV_BIT ) != 0 )
+  {
+    p_client->xAsynchEvent.rx_epoch++;
+    p_client->ucRxEventCount = 0;
+  }
+
+  if( ( eventbitField & exlibSNTP_SOFTSR_SEND_BIT ) != 0 )
+  {
+    p_client->xAsynchEvent.tx_epoch++;
+    p_client->ullTxEventTs = ( uint64_t )0;
+  }
+
+  /* Clear callback, once no event is registered anymore */
+  if( p_client->xAsynchEvent.event.SR == 0 )
+  {
+    p_client->xAsynchEvent.event_cb  = NULL;
+  }
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Send the request and capture its transmit timestamp (T1) on the actual transmission.
+ *          The driver timestamp is preferred, then the Spawn task send event, then the local time
+ *          read right after the successful @ref SlNetSock_sendTo .
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   p_addr: Pointer to the server address.
+ *          This parameter can be a value of @ref SlNetSock_Addr_t *.
+ * @param   usAddrLength: Length of the server address.
+ *          This parameter can be a value of @ref uint16_t.
+ * @param   pullOriginateTs: Pointer to the originate timestamp T1, only written on successful transmission.
+ *          This parameter can be a value of @ref uint64_t *.
+ * @retval  SlNetSock_sendTo return code, this parameter can be a value of @ref int32_t.
+ */
+#pragma optimize=speed
+__STATIC_INLINE int32_t prv_utility_send_to( sntpex_client_handle_t * p_client, SlNetSock_Addr_t * p_addr, uint16_t usAddrLength, uint64_t * pullOriginateTs )
+{
+  int32_t  SLReturnCode;
+  uint64_t ullTimestamp;
+
+  /* arm send event from ISR for this attempt only, the callback of a pending receive event is kept */
+  prv_utility_unregister_event( p_client, exlibSNTP_SOFTSR_SEND_BIT );
+  prv_utility_register_event( p_client, exlibSNTP_SOFTSR_SEND_BIT, p_client->pfEventNotify );
+
+  SLReturnCode = SlNetSock_sendTo( p_client->sock->fd,
+                                   &p_client->payload,
+                                   p_client->payloadLen,
+                                   0,
+                                   p_addr,
+                                   usAddrLength );
+
+  /* Fallback timestamp, taken right after the transmission */
+  ullTimestamp = p_client->vtable_api.get_unix_timestamp();
+
+  if( SLReturnCode == ( int32_t )p_client->payloadLen )
+  {
+    uint64_t ullCaptured = ( NULL != p_client->vtable_api.get_tx_timestamp ) ?
+                           p_client->vtable_api.get_tx_timestamp( p_client->sock->fd ) : ( uint64_t )0;
+
+    /* Driver timestamp first, then the Spawn task send event */
+    if( ullCaptured == ( uint64_t )0 )
+    {
+      ullCaptured = prv_utility_tx_event_take( p_client );
+    }
+
+    *pullOriginateTs = ( ullCaptured != ( uint64_t )0 ) ? ullCaptured : ullTimestamp;
+  }
+
+  /* disarm send event, the next Spawn events belong to the reception */
+  prv_utility_unregister_event( p_client, exlibSNTP_SOFTSR_SEND_BIT );
+
+  return SLReturnCode;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Read the host IRQ capture, consistent with its sequence.
+ * @param   pullTimestamp: Pointer to the captured 64-UNIX time.
+ *          This parameter can be a value of @ref uint64_t *.
+ * @retval  Capture sequence, this parameter can be a value of @ref uint32_t.
+ */
+#pragma optimize=speed
+__STATIC_INLINE uint32_t prv_utility_irq_capture_read( uint64_t * pullTimestamp )
+{
+  uint32_t ulSequence;
+
+  /* Retry while the host IRQ updates the timestamp */
+  do
+  {
+    ulSequence = ulg_irq_capture_sequence;
+    exlibSNTP_MEMORY_BARRIER();
+
+    *pullTimestamp = ullg_irq_capture_timestamp;
+
+    exlibSNTP_MEMORY_BARRIER();
+  }
+  while( ( ( ulSequence & 1u ) != 0 ) || ( ulSequence != ulg_irq_capture_sequence ) );
+
+  return ulSequence;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Select the most accurate receive timestamp (T4) of the received reply.
+ *          The driver timestamp is preferred, then the host IRQ capture, then the Spawn task timestamp,
+ *          then the local time when no source captured the reception.
+ * @remark  The host IRQ capture is a single latest value shared by all the sockets. It is only used when
+ *          exactly one capture is taken since the receive event is armed or since the previous datagram,
+ *          when the replies arrive back-to-back the capture of a later datagram is not taken for this one.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   ullSpawnTs: 64-UNIX time captured by the Spawn task, 0 when not captured.
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  64-UNIX receive time.
+ */
+#pragma optimize=speed
+__STATIC_INLINE uint64_t prv_utility_rx_timestamp_get( sntpex_client_handle_t * p_client, uint64_t ullSpawnTs )
+{
+  uint64_t ullTimestamp = 0;
+  uint64_t ullCapture;
 
-  /* Format the NTP request */
-  request->vn        = specNTP_VERSION_V4;
-  request->mode      = specNTP_MODE_CLIENT;
-  request->stratum   = 2;
-  request->poll      = 0x06;
-  request->precision = 0xec; /* -6 */
+  /* The captures taken up to now belong to this datagram, sequence is increased by 2 on every capture */
+  uint32_t ulSequence = prv_utility_irq_capture_read( &ullCapture );
+  uint32_t ulCaptures = ( ulSequence - p_client->ulIrqArmSequence ) / 2u;
 
-  /** @remark The Transmit Timestamp allows a simple calculation to determine the
-   *  propagation delay between the server and client and to align the system
-   *  clock generally within a few tens of milliseconds relative to the server */
+  p_client->ulIrqArmSequence = ulSequence;
 
-  /* Time at which the NTP request was sent */
-  p_client->expected_orig_ts = p_client->vtable_api.get_os_tick();
-  request->transmitTimestamp.seconds = 0;
-  request->transmitTimestamp.fraction = exlibSLNETUTIL_HTONL(p_client->expected_orig_ts) ;
+  /* Driver facility, the timestamp is taken when the datagram is received */
+  if( NULL != p_client->vtable_api.get_rx_timestamp )
+  {
+    ullTimestamp = p_client->vtable_api.get_rx_timestamp( p_client->sock->fd );
 
-  /* save the payload length */
-  p_client->payloadLen = sizeof( struct x_sntp_request);
+    if( ullTimestamp != ( uint64_t )0 )
+    {
+      p_client->xRxTimestampSource = SNTPEX_TS_SOURCE_DRIVER;
+      return ullTimestamp;
+    }
+  }
 
-  /* Return the error status. */
-  return SNTPEX_SUCCESS;
+  /* Host IRQ capture, only when it is the single capture of this datagram */
+  if( ( ulCaptures == 1u ) && ( ullCapture != ( uint64_t )0 ) )
+  {
+    p_client->xRxTimestampSource = SNTPEX_TS_SOURCE_HOST_IRQ;
+    return ullCapture;
+  }
+
+  /* Spawn task event, includes the Spawn queue latency */
+  if( ullSpawnTs != ( uint64_t )0 )
+  {
+    p_client->xRxTimestampSource = SNTPEX_TS_SOURCE_SPAWN;
+    return ullSpawnTs;
+  }
+
+  /* No source captured the reception, the local time read after the reception is the closest one */
+  p_client->xRxTimestampSource = SNTPEX_TS_SOURCE_LOCAL;
+
+  return p_client->vtable_api.get_unix_timestamp();
 }
 
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
- * @brief   Open the sntp connection ( socket creation, set opts...)
+ * @brief   Store the Spawn event of the client socket on its ring.
  * @param   p_client: Pointer to the sntp client handle
  *          This parameter can be a value of @ref sntpex_client_handle_t *.
- * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ * @param   ucType: Event type, @ref exlibSNTP_SOFTSR_RECV_BIT or @ref exlibSNTP_SOFTSR_SEND_BIT .
+ *          This parameter can be a value of @ref uint8_t.
+ * @retval  None.
  */
 #pragma optimize=speed
-static sntp_ud_t sFct_sntp_OpenConnection( sntpex_client_handle_t * p_client )
+__STATIC_INLINE void prv_utility_dispatch_event( sntpex_client_handle_t * p_client, uint8_t ucType )
 {
-  /* Point to the socket extended Library structure */
-  struct vsocket * p_socket   = ( struct vsocket *)p_client->sock;
+  volatile struct ux_sntpAsynchEvent * p_event = &p_client->xAsynchEvent;
 
-  void           * socket_opt = NULL;
-  uint32_t         opt_length = 0;
-  int16_t          opt_name   = 0;
-  int32_t          SLReturnCode = SLNETERR_RET_CODE_OK;
+  /* save unix 64 timestamp first, method is a pointer to the client get_timestamp APIs @ref get_unix_timestamp */
+  uint64_t ullTimestamp = p_client->vtable_api.get_unix_timestamp();
+  uint8_t  ucEpoch      = ( ucType == exlibSNTP_SOFTSR_SEND_BIT ) ? p_event->tx_epoch : p_event->rx_epoch;
 
-  if ( NULL == p_socket )
+  /** @remark The epoch is read before the flag, see @ref prv_utility_unregister_event . The type is given
+   *  by the Spawn task, a reply received during a later transmission keeps its receive timestamp.
+   *  The flags are only read here, they are owned by the client task */
+  exlibSNTP_MEMORY_BARRIER();
+
+  if( ( p_event->event.SR & ucType ) == 0 )
   {
-    /* sntpex_client is not initialized yet, Return the error status*/
-    return SNTPEX_ERR_NULL_PTR;
+    /* Not armed anymore */
+    return;
   }
 
-  /* close previous UDP socket only when it is opened */
-  if ( p_socket->fd != -1 )
+  uint32_t ulHead = p_event->head;
+
+  /* The client task only moves the tail forward, a full ring drops the newest event */
+  if( ( ulHead - p_event->tail ) < exlibSNTP_EVENT_RING_SIZE )
   {
-    /* close previous UDP socket */
-    SlNetSock_close( p_socket->fd );
+    volatile struct xSntpEventSlot_t * p_slot = &p_event->slot[ ulHead & ( exlibSNTP_EVENT_RING_SIZE - 1u ) ];
 
-    /* reset virtual socket descriptor */
-    p_socket->fd = -1;
+    p_slot->timestamp = ullTimestamp;
+    p_slot->type      = ucType;
+    p_slot->epoch     = ucEpoch;
+
+    /* Publish the slot before the head */
+    exlibSNTP_MEMORY_BARRIER();
+    p_event->head = ulHead + 1u;
+  }
+  else
+  {
+    p_event->dropped++;
   }
 
-  /* Create a UDP socket to communicate with NTP server */
-  p_socket->fd = SlNetSock_create( p_socket->descriptor.SocketAddr.sa_family,
-                                   p_socket->descriptor.type,
-                                   p_socket->descriptor.protocol,
-                                   p_client->interface,
-                                   0 );
-  if ( p_socket->fd < 0 )
+  if( p_event->event_cb != NULL )
   {
-    /* Socket cannot be created, return the error status. */
-    return SNTPEX_ERR_SOCKET_CREATE;
+    /* execute registred library callback */
+    p_event->event_cb( ucType );
   }
+}
 
-#ifdef exlibSNTP_CLIENT_USE_NONBLOCKING_TIMEOUT_OPTION  
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Move the Spawn events of the ring to the client task, the events of a previous arming are discarded.
+ *          The receive timestamps are kept in arrival order, one per received datagram.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_utility_event_collect( sntpex_client_handle_t * p_client )
+{
+  volatile struct ux_sntpAsynchEvent * p_event = &p_client->xAsynchEvent;
+  uint32_t ulTail = p_event->tail;
+  uint32_t ulHead = p_event->head;
 
-  /** @remark Non blocking Timeout option, so timeout mecanism is handled on the @ref sntp_ex_ti_lib file
-   *  Keep pooling until the return status is different from @ref SLNETERR_BSD_EAGAIN and timeout is not occured */
-  SlNetSock_Nonblocking_t enableOption =
+  /* The slots up to the head are published */
+  exlibSNTP_MEMORY_BARRIER();
+
+  while( ulTail != ulHead )
   {
-    .nonBlockingEnabled = 1, 
-  };
+    volatile struct xSntpEventSlot_t * p_slot = &p_event->slot[ ulTail & ( exlibSNTP_EVENT_RING_SIZE - 1u ) ];
 
-  socket_opt = &enableOption;
-  opt_name   = SLNETSOCK_OPSOCK_NON_BLOCKING;
-  opt_length = sizeof( enableOption );
+    if( ( p_slot->type == exlibSNTP_SOFTSR_SEND_BIT ) && ( p_slot->epoch == p_event->tx_epoch ) )
+    {
+      p_client->ullTxEventTs = p_slot->timestamp;
+    }
+    else if( ( p_slot->type == exlibSNTP_SOFTSR_RECV_BIT ) && ( p_slot->epoch == p_event->rx_epoch ) &&
+             ( p_client->ucRxEventCount < exlibSNTP_EVENT_RING_SIZE ) )
+    {
+      p_client->aullRxEventTs[ p_client->ucRxEventCount ] = p_slot->timestamp;
+      p_client->ucRxEventCount++;
+    }
+    else
+    {
+      /* Stale event, Do Nothing : MISRA 15.7 */
+    }
 
-#else
+    ulTail++;
+  }
 
-  /** @remark blocking Timeout option, so timeout mecanism is handled on the TI TCP Stack.
-   *  The timeout value is @ref p_client->sock->descriptor.timeout */
-  socket_opt = &p_client->sock->descriptor.timeout;
-  opt_name   = SLNETSOCK_OPSOCK_RCV_TIMEO;
-  opt_length = sizeof( SlNetSock_Timeval_t );
+  /* Release the slots to the Spawn task, once they are read */
+  exlibSNTP_MEMORY_BARRIER();
+  p_event->tail = ulTail;
+}
 
-#endif /* exlibSNTP_CLIENT_USE_NONBLOCKING_TIMEOUT_OPTION */
-  
-  /* Setting socket options */
-  SLReturnCode = SlNetSock_setOpt( p_client->sock->fd,
-                                   SLNETSOCK_LVL_SOCKET,
-                                   opt_name,
-                                   socket_opt,
-                                   opt_length);
-  if ( SLReturnCode < 0 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Take the receive timestamp of the oldest received datagram.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  64-UNIX time captured by the Spawn task, 0 when not captured.
+ */
+#pragma optimize=speed
+__STATIC_INLINE uint64_t prv_utility_rx_event_take( sntpex_client_handle_t * p_client )
+{
+  uint64_t ullTimestamp;
+  uint8_t  ucIndex;
+
+  prv_utility_event_collect( p_client );
+
+  if( p_client->ucRxEventCount == 0 )
   {
-    /* Setting socket options is failed, return the error status. */
-    return SNTPEX_ERR_SOCKET_SET_OPT;
+    return ( uint64_t )0;
   }
 
-  /* Everything is OK, change library state to sending */
-  p_client->state = UD_SNTP_CLIENT_STATE_SENDING;
+  ullTimestamp = p_client->aullRxEventTs[ 0 ];
 
-  /* return the error status. */
-  return SNTPEX_SUCCESS;
+#if ( exlibSNTP_CONFIG_STATS == 1 )
+  /* Latency between the Spawn event and its consumption by the client task */
+  uint64_t ullLatency = p_client->vtable_api.get_unix_timestamp() - ullTimestamp;
+
+  sntpex_stats_histogram_add( &p_client->xStats.xRxLatency, ( ullLatency > 0xFFFFFFFFu ) ? 0xFFFFFFFFu : ( uint32_t )ullLatency );
+#endif
+
+  /* Keep the next timestamps in arrival order */
+  p_client->ucRxEventCount--;
+
+  for( ucIndex = 0; ucIndex < p_client->ucRxEventCount; ucIndex++ )
+  {
+    p_client->aullRxEventTs[ ucIndex ] = p_client->aullRxEventTs[ ucIndex + 1u ];
+  }
+
+  return ullTimestamp;
 }
 
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
- * @brief   send the sntp request.
+ * @brief   Take the send timestamp of the last transmission.
  * @param   p_client: Pointer to the sntp client handle
  *          This parameter can be a value of @ref sntpex_client_handle_t *.
- * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ * @retval  64-UNIX time captured by the Spawn task, 0 when not captured.
  */
 #pragma optimize=speed
-static sntp_ud_t sFct_sntp_SendRequest( sntpex_client_handle_t * p_client )
+__STATIC_INLINE uint64_t prv_utility_tx_event_take( sntpex_client_handle_t * p_client )
 {
+  uint64_t ullTimestamp;
 
-  /* Point to the socket extended Library structure */
-  struct vsocket * p_socket   = ( struct vsocket *)p_client->sock;
+  prv_utility_event_collect( p_client );
 
-  int32_t          SLReturnCode = SLNETERR_RET_CODE_OK;
+  ullTimestamp           = p_client->ullTxEventTs;
+  p_client->ullTxEventTs = ( uint64_t )0;
 
-  /* Create NTP request which will be stored on the @ref p_client->payload with size @ref p_client->payloadLen */
-  prv_utility_build_request( p_client, p_client->payload );
+  return ullTimestamp;
+}
 
-  /* save the originate unix 64 timestamp T1, method is a pointer to the user get_timestamp APIs @ref get_unix_timestamp */
-  p_client->xTimestampList->originate64_ts = p_client->vtable_api.get_unix_timestamp();
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Find the in-flight server whose originate nonce matches the received reply.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   p_payload: Pointer to the received payload.
+ *          This parameter can be a value of @ref const void *.
+ * @param   pucPending: Array of pending flags, one entry per configured server.
+ *          This parameter can be a value of @ref const uint8_t *.
+ * @retval  Index of the matching server, (-1) when no in-flight request matches.
+ */
+#pragma optimize=speed
+__STATIC_INLINE int8_t prv_utility_match_server( sntpex_client_handle_t * p_client, const void * p_payload, const uint8_t * pucPending )
+{
+  struct xSntpPacket_t xResponse;
+  uint8_t              ucIndex;
 
-#ifdef exlibSNTP_CLIENT_USE_NONBLOCKING_TIMEOUT_OPTION
+  /* The reply length is checked by the caller, only the originate timestamp is used to match the reply */
+  if( sntpex_packet_decode( ( const uint8_t * ) p_payload, exlibSNTP_PACKET_HEADER_SIZE, &xResponse ) != SNTPEX_SUCCESS )
+  {
+    return -1;
+  }
 
-  /** @remark Non blocking Timeout option, so timeout mecanism is handled on the @ref sntp_ex_ti_lib file
-   *  Keep pooling until the return status is different from @ref SLNETERR_BSD_EAGAIN and timeout is not occured */
+  for( ucIndex = 0; ucIndex < p_client->ucServerCount; ucIndex++ )
+  {
+    if( ( pucPending[ ucIndex ] != 0 ) &&
+        ( 0 != prv_utility_nonce_equal( &p_client->xServerList[ ucIndex ].expected_orig_ts, &xResponse.originateTimestamp ) ) )
+    {
+      return ( int8_t )ucIndex;
+    }
+  }
 
-  /* save the initial tick, used for timeout trigging */
-  uint32_t ulTickStart = p_client->vtable_api.get_os_tick();
+  /* No in-flight request matches */
+  return -1;
+}
+#endif /* exlibSNTP_CONFIG_MULTI_SERVER */
 
-  do
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Generate the 64-bit originate nonce of a request.
+ *          The @ref get_random vtable API is preferred, the software generator (SplitMix64) is used otherwise.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pxNonce: Pointer to the nonce, never 0.
+ *          This parameter can be a value of @ref NtpTimestamp *.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_utility_nonce_generate( sntpex_client_handle_t * p_client, NtpTimestamp * pxNonce )
+{
+  uint64_t ullNonce = 0;
+
+  if( ( NULL == p_client->vtable_api.get_random ) || ( 0 != p_client->vtable_api.get_random( &ullNonce, sizeof( ullNonce ) ) ) )
   {
-    /*  Write data to UDP socket, in order to will be sended to the configured server 
-        SLReturnCode will return the length of sended payload */
-    SLReturnCode =  SlNetSock_sendTo( p_socket->fd,
-                                      &p_client->payload,
-                                      p_client->payloadLen,
-                                      0,
-                                      &p_socket->descriptor.SocketAddr,
-                                      p_socket->descriptor.InAddLength );
+    /** @remark The software generator is not cryptographic, the local time is mixed into every nonce so the
+     *  sequence is not only a function of the seed. The TRNG hook is required against an on-path attacker */
+    p_client->ullNonceState += 0x9E3779B97F4A7C15ull ^ p_client->vtable_api.get_unix_timestamp();
+
+    ullNonce = p_client->ullNonceState;
+    ullNonce = ( ullNonce ^ ( ullNonce >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+    ullNonce = ( ullNonce ^ ( ullNonce >> 27 ) ) * 0x94D049BB133111EBull;
+    ullNonce =   ullNonce ^ ( ullNonce >> 31 );
   }
-  while( ( SLReturnCode == ( SLNETERR_BSD_EAGAIN ) ) && ( ( p_client->vtable_api.get_os_tick() - ulTickStart ) < p_client->timeout ) );
 
-#else
+  /* A zero transmit timestamp means not set, it is never used as nonce */
+  pxNonce->seconds  = ( uint32_t )( ullNonce >> 32 );
+  pxNonce->fraction = ( ullNonce == 0 ) ? 1u : ( uint32_t )ullNonce;
+}
 
-  /** @remark blocking Timeout option, so timeout mecanism is handled on the TI TCP Stack.
-   *  The timeout value is @ref p_client->sock->descriptor.timeout */
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Compare two nonces in constant time, the duration does not depend on the matching bits.
+ * @param   pxNonceA: Pointer to the first nonce.
+ *          This parameter can be a value of @ref const NtpTimestamp *.
+ * @param   pxNonceB: Pointer to the second nonce.
+ *          This parameter can be a value of @ref const NtpTimestamp *.
+ * @retval  1 when the nonces are equal, 0 otherwise.
+ */
+#pragma optimize=speed
+__STATIC_INLINE uint8_t prv_utility_nonce_equal( const NtpTimestamp * pxNonceA, const NtpTimestamp * pxNonceB )
+{
+  uint32_t ulDiff = ( pxNonceA->seconds ^ pxNonceB->seconds ) | ( pxNonceA->fraction ^ pxNonceB->fraction );
 
-  /*  Write data to UDP socket, in order to will be sended to the configured server 
-      SLReturnCode will return the length of sended payload */
-  SLReturnCode =  SlNetSock_sendTo( p_socket->fd,
-                                    &p_client->payload,
-                                    p_client->payloadLen,
-                                    0,
-                                    &p_socket->descriptor.SocketAddr,
-                                    p_socket->descriptor.InAddLength );
+  return ( uint8_t )( ( ( ulDiff | ( 0u - ulDiff ) ) >> 31 ) ^ 1u );
+}
 
-#endif /* exlibSNTP_CLIENT_USE_NONBLOCKING_TIMEOUT_OPTION */
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Release the connection after a failed request.
+ *          The persistent socket is kept opened, unless the failure comes from the socket itself.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   xLibReturnCode: Status of the failed request.
+ *          This parameter can be a value of @ref sntp_ud_t.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_utility_release_connection( sntpex_client_handle_t * p_client, sntp_ud_t xLibReturnCode )
+{
+  /* unregister receive event from ISR */
+  prv_utility_unregister_event( p_client, exlibSNTP_SOFTSR_RECV_BIT );
+
+  if( ( 0u != ( p_client->options & exlibSNTP_CLIENT_OPT_PERSISTENT_SOCKET ) ) &&
+      ( p_client->sock->fd != -1 ) &&
+      ( xLibReturnCode != SNTPEX_ERR_SOCKET_CREATE ) &&
+      ( xLibReturnCode != SNTPEX_ERR_SOCKET_SET_OPT ) &&
+      ( xLibReturnCode != SNTPEX_ERR_TX ) &&
+      ( xLibReturnCode != SNTPEX_ERR_RX ) )
+  {
+    /* Socket is still usable, change library state to sending */
+    p_client->state = UD_SNTP_CLIENT_STATE_SENDING;
+  }
+  else
+  {
+    /* close previous connection and change library state to opened */
+    sntp_sapi[ UD_SNTP_CLIENT_STATE_CLOSE ].execFuntion( p_client );
 
-  if ( SLNETERR_BSD_EAGAIN == SLReturnCode )
+    /* The next request is sent on the next bound interface */
+    prv_utility_interface_failover( p_client, xLibReturnCode );
+  }
+}
+
+#if ( exlibSNTP_CONFIG_IPV6 == 1 ) || ( exlibSNTP_CONFIG_TIMER_WHEEL == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Cancel the request started by @ref sntpex_client_step , the reply is not expected anymore.
+ *          A late reply queued on the persistent socket is discarded by the next request.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_utility_request_cancel( sntpex_client_handle_t * p_client )
+{
+  p_client->options &= ( uint8_t )~exlibSNTP_CLIENT_OPT_STEP_MODE;
+
+  /* Same release as a timeout, the persistent socket is kept opened */
+  prv_utility_release_connection( p_client, SNTPEX_ERR_TIMEOUT );
+}
+#endif
+
+#if ( exlibSNTP_CONFIG_TIMER_WHEEL == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Remove the completed request from its timer wheel and report its status.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   xStatus: Status of the completed request.
+ *          This parameter can be a value of @ref sntp_ud_t.
+ * @param   cb: completion callback, can be NULL.
+ *          This parameter can be a value of @ref pf_requestCallback.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_utility_wheel_complete( sntpex_client_handle_t * p_client, sntp_ud_t xStatus, pf_requestCallback cb )
+{
+  sntpex_timer_disarm( p_client->pxWheel, &p_client->xTimer );
+  p_client->pxWheel = NULL;
+
+  if( NULL != cb )
   {
-    /* Timeout is occured, return the error status. */
-    return SNTPEX_ERR_TIMEOUT;
+    cb( p_client, xStatus );
+  }
+  else
+  {
+    /* Do Nothing : MISRA 15.7 */
+  }
+}
+#endif
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Switch to the next bound interface when the request failed on the socket itself.
+ *          A timeout or a rejected request keeps the interface, the path is working.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   xLibReturnCode: Status of the failed request.
+ *          This parameter can be a value of @ref sntp_ud_t.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_utility_interface_failover( sntpex_client_handle_t * p_client, sntp_ud_t xLibReturnCode )
+{
+  if( ( p_client->ucInterfaceCount > 1 ) &&
+      ( ( xLibReturnCode == SNTPEX_ERR_SOCKET_CREATE ) ||
+        ( xLibReturnCode == SNTPEX_ERR_SOCKET_SET_OPT ) ||
+        ( xLibReturnCode == SNTPEX_ERR_TX ) ||
+        ( xLibReturnCode == SNTPEX_ERR_RX ) ) )
+  {
+    /* The interfaces are used in the bind order, then the first one is tried again */
+    p_client->ucInterfaceActive = ( uint8_t )( ( p_client->ucInterfaceActive + 1u ) % p_client->ucInterfaceCount );
+    p_client->interface         = p_client->xInterfaceList[ p_client->ucInterfaceActive ];
+  }
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Feed the clock filter with the sample of the completed request.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pxSource: Pointer to the net address of the replying server.
+ *          This parameter can be a value of @ref const SlNetSock_Addr_t *.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_utility_filter_update( sntpex_client_handle_t * p_client, const SlNetSock_Addr_t * pxSource )
+{
+  struct xSntpSample_t xSample;
+
+  /* Compute offset and delay from T1,T2,T3 and T4 */
+  if( SNTPEX_SUCCESS == sntpex_sample_compute( p_client->xTimestampList, &xSample ) )
+  {
+    prv_utility_sample_update( p_client, &xSample, p_client->xTimestampList->server.li );
+#if ( exlibSNTP_CONFIG_RESPONDER == 1 )
+    prv_utility_sync_source_set( p_client, &p_client->xTimestampList->server, pxSource );
+#endif
   }
-  else if ( ( SLReturnCode < 0 ) || ( SLReturnCode != p_client->payloadLen ) )
+
+  ( void )pxSource;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Feed the clock filter and the clock discipline with a new sample.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pxSample: Pointer to the new sample.
+ *          This parameter can be a value of @ref const struct xSntpSample_t *.
+ * @param   ucLi: Leap Indicator of the reply, @ref specNTP_LI_ALARM when unknown.
+ *          This parameter can be a value of @ref uint8_t.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_utility_sample_update( sntpex_client_handle_t * p_client, const struct xSntpSample_t * pxSample, uint8_t ucLi )
+{
+#if ( exlibSNTP_CONFIG_TIMESCALE == 1 )
+  /* The sample is taken on the scale of the server, after its leaps */
+  prv_utility_leap_fold( p_client, pxSample->epoch );
+#endif
+
+#if ( exlibSNTP_CONFIG_FILTER == 1 )
+  /* Add the sample to the ring */
+  ( void )sntpex_filter_push( &p_client->xFilter, pxSample );
+
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 1 )
+  struct xSntpSample_t xSample;
+
+  /* The clock discipline is only fed with the minimum-delay samples newer than the last used one */
+  if( ( SNTPEX_SUCCESS == sntpex_filter_best_get( &p_client->xFilter, &xSample ) ) &&
+      ( ( p_client->xDiscipline.state == SNTPEX_DISCIPLINE_UNSET ) || ( xSample.epoch > p_client->xDiscipline.lastUpdate ) ) )
   {
-    /* Error send NTP request, return the error status. */
-    return SNTPEX_ERR_TX;
+    ( void )sntpex_discipline_update( &p_client->xDiscipline, &xSample );
   }
-  else
-  {
-    /* clear the payload, to will be used on the receive state */
-    ( void ) memset( &p_client->payload, 0, p_client->payloadLen );
+#endif
+#else
+  /* Without the clock filter, every sample feeds the clock discipline */
+  p_client->xLastSample = *pxSample;
 
-    /* Everything is OK, change library state to receiving */
-    p_client->state = UD_SNTP_CLIENT_STATE_RECEIVING;
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 1 )
+  ( void )sntpex_discipline_update( &p_client->xDiscipline, pxSample );
+#endif
+#endif
 
-    /* return the error status. */
-    return SNTPEX_SUCCESS;
+#if ( exlibSNTP_CONFIG_TIMESCALE == 1 )
+  /* Leap announced by the server, once per poll interval */
+  if( NULL != p_client->pxTimescale )
+  {
+    ( void )sntpex_timescale_update( p_client->pxTimescale, ucLi,
+                                     sntpex_discipline_time_get( &p_client->xDiscipline, pxSample->epoch ) );
   }
+#else
+  ( void )ucLi;
+#endif
+
+#if ( exlibSNTP_CONFIG_FAST_NOW == 1 )
+  /* The readers of the fast time get the new correction */
+  ( void )sntpex_now_publish( p_client );
+#endif
 }
 
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
- * @brief   receive the sntp request
+ * @brief   Schedule the next request of the client from the status of the completed one.
+ *          Does nothing without @ref exlibSNTP_CONFIG_POLL , the application schedules the requests.
  * @param   p_client: Pointer to the sntp client handle
  *          This parameter can be a value of @ref sntpex_client_handle_t *.
- * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ * @param   xStatus: Status of the completed request.
+ *          This parameter can be a value of @ref sntp_ud_t.
+ * @param   ulKissCode: Kiss code of the reply.
+ *          This parameter can be a value of @ref uint32_t.
+ * @param   ulTick: Current os tick in ms.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  None.
  */
 #pragma optimize=speed
-static sntp_ud_t sFct_sntp_ReceiveResponse( sntpex_client_handle_t *p_client )
+__STATIC_INLINE void prv_utility_poll_update( sntpex_client_handle_t * p_client, sntp_ud_t xStatus, uint32_t ulKissCode, uint32_t ulTick )
 {
+#if ( exlibSNTP_CONFIG_POLL == 1 )
+#if ( exlibSNTP_CONFIG_FILTER == 1 )
+  int64_t llJitter = p_client->xFilter.jitter;
+#else
+  int64_t llJitter = 0;
+#endif
 
-  /* Point to the socket extended Library structure */
-  struct vsocket * p_socket   = ( struct vsocket *)p_client->sock;
+  ( void )sntpex_poll_update( &p_client->xPoll, xStatus, ulKissCode, llJitter, &p_client->xDiscipline, ulTick );
+#else
+  ( void )p_client;
+  ( void )xStatus;
+  ( void )ulKissCode;
+  ( void )ulTick;
+#endif
+}
 
-  int32_t          SLReturnCode = SLNETERR_RET_CODE_OK;
+#if ( exlibSNTP_CONFIG_TIMESCALE == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Fold the passed leaps into the clock, before the sample of the new scale is used.
+ *          The phase, the frequency reference and the filtered samples are shifted together, so the
+ *          discipline is neither stepped nor its frequency estimate disturbed by the leap.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   ullRawTime: Raw local 64-UNIX time in us of the new sample.
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_utility_leap_fold( sntpex_client_handle_t * p_client, uint64_t ullRawTime )
+{
+  int64_t llShift = 0;
 
-  /* register receive event from ISR */
-  prv_utility_register_event( exlibSNTP_SOFTSR_RECV_BIT, NULL );
+  /* The clock is not set yet, the first sample sets it on the scale of the server */
+  if( ( NULL == p_client->pxTimescale ) || ( p_client->xDiscipline.state == SNTPEX_DISCIPLINE_UNSET ) ||
+      ( SNTPEX_SUCCESS != sntpex_timescale_leap_fold( p_client->pxTimescale,
+                                                      sntpex_discipline_time_get( &p_client->xDiscipline, ullRawTime ), &llShift ) ) ||
+      ( llShift == 0 ) )
+  {
+    return;
+  }
 
-#ifdef exlibSNTP_CLIENT_USE_NONBLOCKING_TIMEOUT_OPTION
+  p_client->xDiscipline.phase     += llShift;
+  p_client->xDiscipline.refOffset += llShift;
 
-  /** @remark Non blocking Timeout option, so timeout mecanism is handled on the @ref sntp_ex_ti_lib file
-   *  Keep pooling until the return status is different from @ref SLNETERR_BSD_EAGAIN and timeout is not occured */
+#if ( exlibSNTP_CONFIG_FILTER == 1 )
+  uint8_t ucIndex;
 
-  /* save the initial tick, used for timeout trigging */
-  uint32_t ulTickStart = p_client->vtable_api.get_os_tick();
-  do
+  for( ucIndex = 0; ucIndex < exlibSNTP_FILTER_SIZE; ucIndex++ )
   {
-    /* Read data from socket, SLReturnCode will return the length of received payload */
-    SLReturnCode =  SlNetSock_recvFrom( p_socket->fd,
-                                        &p_client->payload,
-                                        p_client->payloadLen,
-                                        0,
-                                        &p_socket->descriptor.SocketAddr,
-                                        &p_socket->descriptor.InAddLength );
+    p_client->xFilter.samples[ ucIndex ].offset += llShift;
   }
-  while( ( SLReturnCode == ( SLNETERR_BSD_EAGAIN ) ) && ( ( p_client->vtable_api.get_os_tick() - ulTickStart ) < p_client->timeout ) );
 #else
+  p_client->xLastSample.offset += llShift;
+#endif
+}
+#endif /* exlibSNTP_CONFIG_TIMESCALE */
 
-  /** @remark blocking Timeout option, so timeout mecanism is handled on the TI TCP Stack.
-   *  The timeout value is @ref p_client->sock->descriptor.timeout */
+#if ( exlibSNTP_CONFIG_RESPONDER == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Record the server of the last sample, advertised by the responder mode.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pxServer: Pointer to the server header fields of the reply.
+ *          This parameter can be a value of @ref const struct xSntpServerInfo_t *.
+ * @param   pxSource: Pointer to the net address of the server.
+ *          This parameter can be a value of @ref const SlNetSock_Addr_t *.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_utility_sync_source_set( sntpex_client_handle_t * p_client, const struct xSntpServerInfo_t * pxServer,
+                                                  const SlNetSock_Addr_t * pxSource )
+{
+  /* Once per poll interval, the IPV6 hash cost is negligible */
+  p_client->xSyncServer       = *pxServer;
+  p_client->ulSyncReferenceId = sntpex_responder_reference_id( &p_client->vtable_api, pxSource );
+}
+#endif /* exlibSNTP_CONFIG_RESPONDER */
+
+#if ( exlibSNTP_CONFIG_BROADCAST == 1 ) || ( exlibSNTP_CONFIG_RESPONDER == 1 )
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Create the socket bound to the NTP port, used by the broadcast and the responder modes.
+ *          The request socket is closed first.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   usFamily: Address family of the socket, bound to the any address of the family.
+ *          This parameter can be a value of @ref uint16_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+__STATIC_INLINE sntp_ud_t prv_utility_listen_open( sntpex_client_handle_t * p_client, uint16_t usFamily )
+{
+  struct vsocket   * p_socket = p_client->sock;
+  sntpex_sockaddr_t  xLocalAddr;
+  uint16_t           usLength;
 
-  /* Read data from socket, SLReturnCode will return the length of received payload */
-  SLReturnCode =  SlNetSock_recvFrom( p_socket->fd,
-                                      &p_client->payload,
-                                      p_client->payloadLen,
-                                      0,
-                                      &p_socket->descriptor.SocketAddr,
-                                      &p_socket->descriptor.InAddLength );
+  /* The request socket is not used anymore, close previous connection */
+  p_client->options &= ( uint8_t )~( exlibSNTP_CLIENT_OPT_STEP_MODE | exlibSNTP_CLIENT_OPT_BROADCAST | exlibSNTP_CLIENT_OPT_RESPONDER );
+  prv_utility_unregister_event( p_client, exlibSNTP_SOFTSR_RECV_BIT | exlibSNTP_SOFTSR_SEND_BIT );
+  sntp_sapi[ UD_SNTP_CLIENT_STATE_CLOSE ].execFuntion( p_client );
 
-#endif /* exlibSNTP_CLIENT_USE_NONBLOCKING_TIMEOUT_OPTION */
+  /** @remark The any address is all zero in both families, only the family and the port are set */
+  ( void )memset( &xLocalAddr, 0, sizeof( xLocalAddr ) );
+  xLocalAddr.sa.sa_family = usFamily;
+  usLength                = prv_utility_address_length( &xLocalAddr.sa );
 
-  if ( SLNETERR_BSD_EAGAIN == SLReturnCode )
+  if( usLength == 0u )
   {
-    /* Timeout is occured, return the error status. */
-    return SNTPEX_ERR_TIMEOUT;
+    /* Family not supported, return the error status. */
+    return SNTPEX_ERR_FAULT_INIT;
   }
-  else if ( SLReturnCode < 0 )
+
+  /* Create a UDP socket on the NTP port */
+  p_socket->fd = SlNetSock_create( ( int16_t )usFamily, p_socket->descriptor.type, p_socket->descriptor.protocol, p_client->interface, 0 );
+
+  if ( p_socket->fd < 0 )
   {
-    /* Error receive NTP request, return the error status. */
-    return SNTPEX_ERR_RX;
+    /* Socket cannot be created, return the error status. */
+    p_socket->fd = -1;
+    return SNTPEX_ERR_SOCKET_CREATE;
   }
-  else if ( SLReturnCode != p_client->payloadLen )
+
+  /* The port is at the same offset in both families */
+  xLocalAddr.in.sin_port = exlibSLNETUTIL_HTONS( exlibSNTP_SERVER_PORT );
+
+  if( SlNetSock_bind( p_socket->fd, &xLocalAddr.sa, usLength ) < 0 )
   {
-    /* invalid payload length, return the error status. */
-    return SNTPEX_ERR_INVALID_MESSAGE;
+    /* close the listening socket, return the error status. */
+    sntp_sapi[ UD_SNTP_CLIENT_STATE_CLOSE ].execFuntion( p_client );
+    return SNTPEX_ERR_SOCKET_SET_OPT;
   }
-  else
-  {
-    /* Error occured on EVENT ISR*/
-    if( xsntpAsynchEvent.timestamp == ( uint64_t )0 )
-    {
-      return SNTPEX_ERR_INVALID_MESSAGE;
-    }
 
-    /* save the reference unix 64 timestamp T4, method is a pointer to the user get_timestamp APIs @ref get_unix_timestamp */  
-    p_client->xTimestampList->reference64_ts = xsntpAsynchEvent.timestamp;
-    
-    /* unregister receive event from ISR */
-    prv_utility_unregister_event( exlibSNTP_SOFTSR_RECV_BIT );
-  
-    /* Everything is OK, change library state to handling response */
-    p_client->state = UD_SNTP_CLIENT_STATE_HANDLING_RSP;
+  /* Save the socket creation context */
+  p_socket->openFamily    = usFamily;
+  p_socket->openInterface = p_client->interface;
 
-    /* return the error status. */
-    return SNTPEX_SUCCESS;
-  }
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
 }
 
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
- * @brief   close the sntp connection
+ * @brief   Take the receive event of the datagram read on the listening socket, then re-arm the socket.
+ * @remark  The listening socket stays armed, every datagram takes the oldest event of the socket. Once no
+ *          other datagram is queued, a new arming epoch discards the events left without their datagram
+ *          (datagram dropped by the stack, full ring), so the next datagram takes its own event and the
+ *          timestamps never lag behind the datagrams.
  * @param   p_client: Pointer to the sntp client handle
  *          This parameter can be a value of @ref sntpex_client_handle_t *.
- * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ * @retval  64-UNIX time captured by the Spawn task, 0 when not captured.
  */
 #pragma optimize=speed
-static sntp_ud_t sFct_sntp_CloseConnection( sntpex_client_handle_t * p_client )
+__STATIC_INLINE uint64_t prv_utility_listen_event_take( sntpex_client_handle_t * p_client )
 {
-  /* Point to the socket extended Library structure */
-  struct vsocket * p_socket   = ( struct vsocket * )p_client->sock;
+  SlNetSock_SdSet_t   xReadSet;
+  SlNetSock_Timeval_t xNoWait      = { 0, 0 };
+  uint64_t            ullTimestamp = prv_utility_rx_event_take( p_client );
 
-  if ( NULL == p_socket )
-  {
-    /* sntpex_client is not initialized yet, Return the error status*/
-    return SNTPEX_ERR_NULL_PTR;
-  }
-  
-  /* close UDP socket only when it is opened */
-  if ( p_client->sock->fd != -1 )
-  {
-    /* close previous UDP socket */
-    SlNetSock_close( p_client->sock->fd );
+  SlNetSock_sdsClrAll( &xReadSet );
+  SlNetSock_sdsSet( p_client->sock->fd, &xReadSet );
 
-    /* reset virtual socket descriptor */
-    p_client->sock->fd = -1;
+  if( SlNetSock_select( p_client->sock->fd + 1, &xReadSet, NULL, NULL, &xNoWait ) == 0 )
+  {
+    /* No datagram queued anymore, the remaining events are stale */
+    prv_utility_unregister_event( p_client, exlibSNTP_SOFTSR_RECV_BIT );
+    prv_utility_register_event( p_client, exlibSNTP_SOFTSR_RECV_BIT, p_client->pfEventNotify );
   }
 
-  /* Everything is OK, change library state to open connection */
-  p_client->state = UD_SNTP_CLIENT_STATE_OPEN;
+  return ullTimestamp;
+}
+#endif /* exlibSNTP_CONFIG_BROADCAST || exlibSNTP_CONFIG_RESPONDER */
 
-  /* return the error status. */
-  return SNTPEX_SUCCESS;
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Export the server header fields of a decoded reply.
+ * @param   pxPacket: Pointer to the decoded reply.
+ *          This parameter can be a value of @ref const struct xSntpPacket_t *.
+ * @param   pxInfo: Pointer to the server header fields.
+ *          This parameter can be a value of @ref struct xSntpServerInfo_t *.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_utility_server_info_get( const struct xSntpPacket_t * pxPacket, struct xSntpServerInfo_t * pxInfo )
+{
+  pxInfo->li             = pxPacket->li;
+  pxInfo->vn             = pxPacket->vn;
+  pxInfo->mode           = pxPacket->mode;
+  pxInfo->stratum        = pxPacket->stratum;
+  pxInfo->poll           = pxPacket->poll;
+  pxInfo->precision      = pxPacket->precision;
+  pxInfo->referenceId    = pxPacket->referenceId;
+
+  /* 16.16 fixed-point seconds to us, us = ( value * 10^6 ) / 2^16 */
+  pxInfo->rootDelay      = ( uint32_t )( ( ( uint64_t )pxPacket->rootDelay      * 1000000u ) >> 16 );
+  pxInfo->rootDispersion = ( uint32_t )( ( ( uint64_t )pxPacket->rootDispersion * 1000000u ) >> 16 );
 }
 
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
- * @brief   Handling and verify the sntp response.
+ * @brief   Discard the stale replies queued on a reused socket (e.g. late reply of a timed out request).
  * @param   p_client: Pointer to the sntp client handle
  *          This parameter can be a value of @ref sntpex_client_handle_t *.
- * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ * @retval  None.
  */
 #pragma optimize=speed
-static sntp_ud_t sFct_sntp_HandlingResponse( sntpex_client_handle_t * p_client )
+__STATIC_INLINE void prv_utility_flush_socket( sntpex_client_handle_t * p_client )
 {
-  /* casting payload to request structure */
-  struct x_sntp_request * responce = ( struct x_sntp_request * ) p_client->payload;
-  
-  /* Ensure the NTP packet is valid */
-  if( p_client->payloadLen < sizeof( struct x_sntp_request ) )
-  {
-    /* return the error status. */
-    return SNTPEX_ERR_INVALID_MESSAGE;
-  }
-    
-  /* The server reply should be discarded if the VN field is 0 */
-  if( responce->vn == 0 )
+  struct vsocket    * p_socket = p_client->sock;
+  SlNetSock_SdSet_t   xReadSet;
+  SlNetSock_Timeval_t xNoWait  = { 0, 0 };
+  sntpex_sockaddr_t   xFromAddr;
+  SlNetSocklen_t      xFromLength;
+  uint8_t             ucIndex;
+
+  /* Only the persistent socket can hold stale replies */
+  if( 0u == ( p_client->options & exlibSNTP_CLIENT_OPT_PERSISTENT_SOCKET ) )
   {
-    /* return the error status. */
-    return SNTPEX_ERR_INVALID_MESSAGE;
+    return;
   }
 
-  /* The server reply should be discarded if the Transmit Timestamp fields is 0 */
-  if( responce->transmitTimestamp.val == 0 )
+  /* The number of discarded replies is bounded, the nonce check rejects the remaining ones */
+  for( ucIndex = 0; ucIndex < exlibSNTP_CLIENT_MAX_SERVERS; ucIndex++ )
   {
-    /* return the error status. */
-    return SNTPEX_ERR_INVALID_MESSAGE;
-  }
+    SlNetSock_sdsClrAll( &xReadSet );
+    SlNetSock_sdsSet( p_socket->fd, &xReadSet );
 
-  /* The server reply should be discarded if the Mode field is not 4 (unicast) or 5 (broadcast) */
-  if(responce->mode != specNTP_MODE_SERVER && responce->mode != specNTP_MODE_BROADCAST)
-  {
-    /* return the error status. */
-    return SNTPEX_ERR_INVALID_MESSAGE;
-  }
+    if( SlNetSock_select( p_socket->fd + 1, &xReadSet, NULL, NULL, &xNoWait ) <= 0 )
+    {
+      /* Nothing is queued anymore */
+      break;
+    }
 
-  /** Timestamp when the request was sent from client to server.
-   *  This is used to check if the originated timestamp in the server
-   *  reply matches the one in client request.
-   */
-  if ( ( responce->originateTimestamp.seconds  != 0 ) ||
-       ( responce->originateTimestamp.fraction != exlibSLNETUTIL_NTOHL(p_client->expected_orig_ts) ) )
-  {
-    /* return the error status. */
-    return SNTPEX_ERR_INVALID_MESSAGE;
+    xFromLength = sizeof( xFromAddr );
+    ( void )SlNetSock_recvFrom( p_socket->fd, p_client->payload, sizeof( p_client->payload ), 0, &xFromAddr.sa, &xFromLength );
   }
+}
 
-  /* Clear kiss code */
-  p_client->kissCode = 0;
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Add the client to the registered clients list.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERR_FAULT_INIT when the list is full.
+ */
+#pragma optimize=speed
+__STATIC_INLINE sntp_ud_t prv_utility_client_register( sntpex_client_handle_t * p_client )
+{
+  uint8_t ucIndex;
 
-  /* Kiss-of-Death packet received? */
-  if(responce->stratum == 0)
+  for( ucIndex = 0; ucIndex < exlibSNTP_CLIENT_MAX_NUMBER; ucIndex++ )
   {
-    /* The kiss code is encoded in four-character ASCII strings left justified and zero filled */
-    p_client->kissCode = exlibSLNETUTIL_NTOHL(responce->referenceId);
+    /* Take the first free slot, the pointer is written once so the Spawn task see a valid client */
+    if( NULL == pg_client_registry[ ucIndex ] )
+    {
+      pg_client_registry[ ucIndex ] = p_client;
 
-    /* An SNTP client should stop sending to a particular server if that server returns a reply with a Stratum field of 0 */
-    return SNTPEX_ERR_REQUEST_REJECTED;
+      /* Return the error status. */
+      return SNTPEX_SUCCESS;
+    }
   }
 
-  /* export transmit timestamp ( 64 bit unix format ) */
-  p_client->xTimestampList->transmit64_ts = prv_utility_ntp_to_epoch( exlibSLNETUTIL_NTOHL(responce->transmitTimestamp.seconds  ),
-                                                                      exlibSLNETUTIL_NTOHL(responce->transmitTimestamp.fraction ) );
-
-  /* export receive timestamp ( 64 bit unix format ) */
-  p_client->xTimestampList->receive64_ts  = prv_utility_ntp_to_epoch( exlibSLNETUTIL_NTOHL(responce->receiveTimestamp.seconds ),
-                                                                      exlibSLNETUTIL_NTOHL(responce->receiveTimestamp.fraction ) );
-
-  /* export reference timestamp ( 32 bit sec, 32 bit frac ) */
-  p_client->xTimestampList->referenceTimestamp.seconds  = exlibSLNETUTIL_NTOHL( responce->referenceTimestamp.seconds );
-  p_client->xTimestampList->referenceTimestamp.fraction = exlibSLNETUTIL_NTOHL( responce->referenceTimestamp.fraction );
-
-  /* export receive timestamp ( 32 bit sec, 32 bit frac ) */
-  p_client->xTimestampList->receiveTimestamp.seconds    = exlibSLNETUTIL_NTOHL( responce->receiveTimestamp.seconds );
-  p_client->xTimestampList->receiveTimestamp.fraction   = exlibSLNETUTIL_NTOHL( responce->receiveTimestamp.fraction );
-
-  /* export transmit timestamp ( 32 bit sec, 32 bit frac ) */
-  p_client->xTimestampList->transmitTimestamp.seconds   = exlibSLNETUTIL_NTOHL( responce->transmitTimestamp.seconds );
-  p_client->xTimestampList->transmitTimestamp.fraction  = exlibSLNETUTIL_NTOHL( responce->transmitTimestamp.fraction );
+  /* Return the error status. */
+  return SNTPEX_ERR_FAULT_INIT;
+}
 
-  /* Everything is OK, change library state to complete */
-  p_client->state = UD_SNTP_CLIENT_STATE_COMPLETE;
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Remove the client from the registered clients list.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_utility_client_unregister( sntpex_client_handle_t * p_client )
+{
+  uint8_t ucIndex;
 
-  /* return the error status. */
-  return SNTPEX_SUCCESS;
+  for( ucIndex = 0; ucIndex < exlibSNTP_CLIENT_MAX_NUMBER; ucIndex++ )
+  {
+    if( p_client == pg_client_registry[ ucIndex ] )
+    {
+      pg_client_registry[ ucIndex ] = NULL;
+    }
+  }
 }
 
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
- * @brief   Convert fraction to microseconds (Formula is inspired from NETX duo stack)
- * @param   fraction: Number of fractions
- *          This parameter can be a value of @ref uint32_t.
- * @retval  Microseconds value, this parameter can be a value of @ref uint32_t.
+ * @brief   Check if the client is on the registered clients list.
+ * @remark  Only the registered clients are dereferenced, the context of a never initialized client may hold garbage.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref const sntpex_client_handle_t *.
+ * @retval  1 when the client is registered, 0 otherwise.
  */
 #pragma optimize=speed
-__STATIC_INLINE uint32_t prv_utility_frac_to_usecs( uint32_t fraction )
+__STATIC_INLINE uint8_t prv_utility_client_registered( const sntpex_client_handle_t * p_client )
 {
-  uint32_t value, segment;
-  int index;
-
-  value = 0;
+  uint8_t ucIndex;
 
-  for( index = 2; index < 32; index+=6)
+  for( ucIndex = 0; ucIndex < exlibSNTP_CLIENT_MAX_NUMBER; ucIndex++ )
   {
-    segment = (fraction >> index ) & 0x3F;
-
-    value = ( ( value & 0x3F ) >= 32) ? (value  >> 6) + segment * 15625 + 1 : (value  >> 6) + segment * 15625 ;
+    if( p_client == pg_client_registry[ ucIndex ] )
+    {
+      return 1u;
+    }
   }
 
-  return value;
+  return 0u;
 }
 
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
- * @brief   Convert Fraction part from NTP fraction to EPOCH subsecond-fraction
- * @param   ulSeconds: Number of seconds
- *          This parameter can be a value of @ref uint32_t.
- * @param   fraction: Number of fractions
- *          This parameter can be a value of @ref uint32_t.
- * @retval  unix-64 timestamp, this parameter can be a value of @ref uint64_t.
+ * @brief   Execute the function of the current state, its duration feeds the statistics block.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  Status of the state function, @ref sntp_ud_t.
  */
 #pragma optimize=speed
-__STATIC_INLINE uint64_t prv_utility_ntp_to_epoch( uint32_t ulSeconds, uint32_t ulFraction )
+__STATIC_INLINE sntp_ud_t prv_utility_state_exec( sntpex_client_handle_t * p_client )
 {
-  /** @remark Return the following calculated process :
-   *  Convert Fraction part from NTP fraction(1/2^32) to EPOCH subsecond-fraction( 1/10^6 ) by dividing by (2^32) then multiplying by (10^6) 
-   *  Deduct the time difference in seconds between NTP 1900 and EPOCH 1970, then add the microseconds from the fraction part*/
-  return ( ( uint64_t )( ( ulSeconds - exlibDIFF_SEC_1900_1970) * 1000000 ) + ( uint64_t )( prv_utility_frac_to_usecs( ulFraction ) ) );
+#if ( exlibSNTP_CONFIG_STATS == 1 )
+  udSntpClientState xState         = p_client->state;
+  uint32_t          ulTickStart    = p_client->vtable_api.get_os_tick();
+  sntp_ud_t         xLibReturnCode = sntp_sapi[ xState ].execFuntion( p_client );
+
+  /* Duration of one call, a busy socket of the step mode counts one call per step */
+  sntpex_stats_histogram_add( &p_client->xStats.xState[ xState ], p_client->vtable_api.get_os_tick() - ulTickStart );
+
+  /* Return the error status. */
+  return xLibReturnCode;
+#else
+  /* Return the error status. */
+  return sntp_sapi[ p_client->state ].execFuntion( p_client );
+#endif
 }
 
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
- * @brief   Register event and callback using @ref exlibSNTP_SOFTSR_RECV_BIT and @ref exlibSNTP_SOFTSR_SEND_BIT
- * @param   eventbitField: event field 
- *          This parameter can be a value of @ref uint8_t.
- * @param   cb: callback function
- *          This parameter can be a value of @ref pf_eventCallback.
- * @retval  None.
+ * @brief   Get the length of a net address from its family.
+ * @param   pxAddress: Pointer to the net address.
+ *          This parameter can be a value of @ref const SlNetSock_Addr_t *.
+ * @retval  Length of the address of the family, 0 when the family is not supported.
  */
 #pragma optimize=speed
-__STATIC_INLINE void prv_utility_register_event( uint8_t eventbitField, pf_eventCallback cb )
+__STATIC_INLINE uint16_t prv_utility_address_length( const SlNetSock_Addr_t * pxAddress )
 {
-  /* register callback */
-  xsntpAsynchEvent.event_cb  = cb;
-  
-  /* register event */
-  xsntpAsynchEvent.event.SR |= eventbitField;
+  if( pxAddress->sa_family == SLNETSOCK_AF_INET )
+  {
+    return ( uint16_t )sizeof( SlNetSock_AddrIn_t );
+  }
+#if ( exlibSNTP_CONFIG_IPV6 == 1 )
+  else if( pxAddress->sa_family == SLNETSOCK_AF_INET6 )
+  {
+    return ( uint16_t )sizeof( SlNetSock_AddrIn6_t );
+  }
+#endif
+  else
+  {
+    return 0;
+  }
 }
 
+#if ( exlibSNTP_CONFIG_BROADCAST == 1 )
 /**
  * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
- * @brief   Unregister event and callback using @ref exlibSNTP_SOFTSR_RECV_BIT and @ref exlibSNTP_SOFTSR_SEND_BIT
- * @param   eventbitField: event field 
- *          This parameter can be a value of @ref uint8_t.
- * @retval  None.
+ * @brief   Compare the family and the host address of two net addresses, the ports are ignored.
+ * @param   pxFirst: Pointer to the first net address.
+ *          This parameter can be a value of @ref const sntpex_sockaddr_t *.
+ * @param   pxSecond: Pointer to the second net address.
+ *          This parameter can be a value of @ref const sntpex_sockaddr_t *.
+ * @retval  1 when both addresses are the same host, 0 otherwise.
  */
 #pragma optimize=speed
-__STATIC_INLINE void prv_utility_unregister_event( uint8_t eventbitField )
+__STATIC_INLINE uint8_t prv_utility_address_equal( const sntpex_sockaddr_t * pxFirst, const sntpex_sockaddr_t * pxSecond )
 {
-  /* Clear previous timestamp */
-  xsntpAsynchEvent.timestamp = ( uint64_t )0;
-
-  /* Clear callback */
-  xsntpAsynchEvent.event_cb  = NULL;
+  if( pxFirst->sa.sa_family != pxSecond->sa.sa_family )
+  {
+    return 0;
+  }
 
-  /* Clear event from SR Soft register */
-  xsntpAsynchEvent.event.SR &= ~(eventbitField);
+  if( pxFirst->sa.sa_family == SLNETSOCK_AF_INET )
+  {
+    return ( pxFirst->in.sin_addr.s_addr == pxSecond->in.sin_addr.s_addr ) ? 1u : 0u;
+  }
+#if ( exlibSNTP_CONFIG_IPV6 == 1 )
+  else if( pxFirst->sa.sa_family == SLNETSOCK_AF_INET6 )
+  {
+    return ( 0 == memcmp( &pxFirst->in6.sin6_addr, &pxSecond->in6.sin6_addr, sizeof( pxFirst->in6.sin6_addr ) ) ) ? 1u : 0u;
+  }
+#endif
+  else
+  {
+    return 0;
+  }
 }
+#endif /* exlibSNTP_CONFIG_BROADCAST */
 /** @} */
 /** @} */
 
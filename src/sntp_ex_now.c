@@ -0,0 +1,323 @@
+/**
+ * @file    sntpex_ti/sntp_ex_now.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Fast disciplined time of the Extended SNTP library, interpolated between the synchronizations.
+ *
+ * @note    The clock discipline of one client is published as a snapshot of two linear segments (the residual
+ *          slew, then the frequency correction only), with the rates in fixed point. A read costs one raw
+ *          clock read and two 64-bit multiplies, no division nor lock.
+ *
+ * @details The snapshot is double buffered with a sequence (latch) : the writer updates one copy while the
+ *          readers use the other one, selected by the parity of the sequence. A reader interrupting the
+ *          writer never waits, a task reader only retries when a whole publication took place during its read.
+ *          The writer is the task running the client, the readers can be any task or interrupt.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Jan 26, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntp_ex_lib_ti.h"
+
+#if ( exlibSNTP_CONFIG_FAST_NOW == 1 )
+
+/* Private define ----------------------------------------------------------------*/
+/* 2^32, the unit of the segment rates is 2^-32 us per us */
+#define exlibSNTP_NOW_RATE_ONE        4294967296LL
+#define exlibSNTP_NOW_PPB             1000000000LL
+
+/* Private variables -------------------------------------------------------------*/
+/**
+ * @brief   Published snapshots of the client discipline.
+ * @details The readers use the copy selected by the low bit of the sequence, the other one is being written. */
+static volatile uint32_t                          ulg_now_sequence;
+static struct xSntpClockSnapshot_t                xg_now_snapshot[ 2 ];
+
+/**
+ * @brief   Client disciplining @ref sntpex_now and its raw local clock, NULL when no client is attached. */
+static const sntpex_client_handle_t * volatile    pg_now_client;
+static uint64_t ( * volatile pfg_now_raw_time )( void );
+
+/* Private function   ------------------------------------------------------------*/
+/**
+ * @defgroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief Fast time utility APIs
+ *        Private functions used by @ref sntp_ex_now.c .
+ *       + @ref prv_now_snapshot_build
+ *       + @ref prv_now_snapshot_write
+ *       + @ref prv_now_rate
+ *       + @ref prv_now_correction
+ * @{
+ */
+/**
+ * @brief Build the two segments of a clock discipline */
+__STATIC_INLINE void    prv_now_snapshot_build( const struct xSntpDiscipline_t * pxDiscipline, struct xSntpClockSnapshot_t * pxSnapshot );
+/**
+ * @brief Publish a snapshot to the readers, both copies are updated one after the other */
+__STATIC_INLINE void    prv_now_snapshot_write( const struct xSntpClockSnapshot_t * pxSnapshot );
+/**
+ * @brief Rate of a frequency correction, rounded to the nearest unit */
+__STATIC_INLINE int64_t prv_now_rate          ( int64_t llPpb );
+/**
+ * @brief Correction of a segment at the raw local time */
+__STATIC_INLINE int64_t prv_now_correction    ( const struct xSntpClockSegment_t * pxSegment, uint64_t ullRawTime );
+/**
+ * @}
+ */
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+  * @{
+  */
+/* Exported function   ------------------------------------------------------------*/
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   select the client disciplining @ref sntpex_now , its discipline is published at once and on every update.
+ *          Must be called from the task running the client.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pfRawTime: Raw local 64-UNIX time in us, safe to call from the interrupts (e.g. high resolution
+ *          timer), on the time base of the @ref get_unix_timestamp vtable API. NULL uses the vtable API.
+ *          This parameter can be a value of @ref uint64_t ( * )( void ).
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_now_attach( sntpex_client_handle_t *p_client, uint64_t ( * pfRawTime )( void ) )
+{
+  /* Make sure that the SNTP client context and its raw local clock are valid */
+  if( ( NULL == p_client ) || ( ( NULL == pfRawTime ) && ( NULL == p_client->vtable_api.get_unix_timestamp ) ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  pg_now_client = p_client;
+  ( void )sntpex_now_publish( p_client );
+
+  /* The raw clock is only given to the readers once the snapshot is published */
+  exlibSNTP_MEMORY_BARRIER();
+  pfg_now_raw_time = ( NULL != pfRawTime ) ? pfRawTime : p_client->vtable_api.get_unix_timestamp;
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   release @ref sntpex_now from the client, it returns 0 until a client is attached again.
+ * @param   p_client: Pointer to the attached sntp client handle
+ *          This parameter can be a value of @ref const sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERROR when the client is not attached.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_now_detach( const sntpex_client_handle_t *p_client )
+{
+  /* Make sure that the SNTP client is the attached one */
+  if( ( NULL == p_client ) || ( p_client != pg_now_client ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERROR;
+  }
+
+  pfg_now_raw_time = NULL;
+  exlibSNTP_MEMORY_BARRIER();
+  pg_now_client = NULL;
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   publish the clock discipline of the client to @ref sntpex_now , called by the library after every
+ *          discipline update. Must be called from the task running the client.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref const sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERROR when the client is not attached.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_now_publish( const sntpex_client_handle_t *p_client )
+{
+  struct xSntpClockSnapshot_t xSnapshot;
+
+  /* Only the attached client is published */
+  if( ( NULL == p_client ) || ( p_client != pg_now_client ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERROR;
+  }
+
+  prv_now_snapshot_build( &p_client->xDiscipline, &xSnapshot );
+  prv_now_snapshot_write( &xSnapshot );
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the disciplined time of the attached client, wait-free and safe to call from the interrupts.
+ *          Within 3 us of @ref sntpex_client_time_get in the hours following an update, the raw time is returned
+ *          while the clock is not disciplined.
+ * @retval  Disciplined 64-UNIX time in us, 0 when no client is attached.
+ */
+#pragma optimize=speed
+uint64_t sntpex_now( void )
+{
+  uint64_t ( * pfRawTime )( void ) = pfg_now_raw_time;
+  const struct xSntpClockSnapshot_t * pxSnapshot;
+  uint64_t ullRawTime;
+  int64_t  llCorrection;
+  uint32_t ulSequence;
+
+  if( NULL == pfRawTime )
+  {
+    return 0;
+  }
+
+  /* The raw time is taken first, the time of the call is returned */
+  ullRawTime = pfRawTime();
+
+  /** @remark The copy of the current parity is stable, the writer updates the other one. The read is only
+   *  retried when a publication completed meanwhile, an interrupt preempting the writer never retries */
+  do
+  {
+    ulSequence = ulg_now_sequence;
+    exlibSNTP_MEMORY_BARRIER();
+
+    pxSnapshot   = &xg_now_snapshot[ ulSequence & 1u ];
+    llCorrection = prv_now_correction( &pxSnapshot->segment[ ( ullRawTime >= pxSnapshot->segment[ 1 ].base ) ? 1 : 0 ], ullRawTime );
+
+    exlibSNTP_MEMORY_BARRIER();
+  }
+  while( ulSequence != ulg_now_sequence );
+
+  return ( uint64_t )( ( int64_t )ullRawTime + llCorrection );
+}
+/** @} */
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+  * @{
+  */
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Build the two segments of a clock discipline, same correction as @ref sntpex_discipline_time_get .
+ *          The residual is slewed at @ref exlibSNTP_DISCIPLINE_MAX_SLEW_PPM until the end of the first segment.
+ * @param   pxDiscipline: Pointer to the clock discipline.
+ *          This parameter can be a value of @ref const struct xSntpDiscipline_t *.
+ * @param   pxSnapshot: Pointer to the built snapshot.
+ *          This parameter can be a value of @ref struct xSntpClockSnapshot_t *.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_now_snapshot_build( const struct xSntpDiscipline_t * pxDiscipline, struct xSntpClockSnapshot_t * pxSnapshot )
+{
+  ( void )memset( pxSnapshot, 0, sizeof( struct xSntpClockSnapshot_t ) );
+
+  /* Without a second segment, the first one is used for any time */
+  pxSnapshot->segment[ 1 ].base = UINT64_MAX;
+
+  /* Not disciplined yet, the raw time is used without correction */
+  if( pxDiscipline->state == SNTPEX_DISCIPLINE_UNSET )
+  {
+    return;
+  }
+
+  /** @remark The rates are rounded, 0.12 ppb at most, i.e. less than 1 us per 2 hours since the update */
+  int64_t llFreqRate = prv_now_rate( pxDiscipline->freq );
+
+  pxSnapshot->segment[ 0 ].base   = pxDiscipline->lastUpdate;
+  pxSnapshot->segment[ 0 ].offset = pxDiscipline->phase;
+  pxSnapshot->segment[ 0 ].rate   = llFreqRate;
+
+  if( pxDiscipline->residual != 0 )
+  {
+    int64_t  llSlewRate  = prv_now_rate( ( int64_t )exlibSNTP_DISCIPLINE_MAX_SLEW_PPM * 1000 );
+    uint64_t ullResidual = ( uint64_t )( ( pxDiscipline->residual > 0 ) ? pxDiscipline->residual : -pxDiscipline->residual );
+    /* Raw time needed to slew the whole residual */
+    uint64_t ullSlewEnd  = ( ( ullResidual * 1000000u ) + ( exlibSNTP_DISCIPLINE_MAX_SLEW_PPM - 1u ) ) / exlibSNTP_DISCIPLINE_MAX_SLEW_PPM;
+
+    pxSnapshot->segment[ 0 ].rate  += ( pxDiscipline->residual > 0 ) ? llSlewRate : -llSlewRate;
+
+    pxSnapshot->segment[ 1 ].base   = pxDiscipline->lastUpdate + ullSlewEnd;
+    pxSnapshot->segment[ 1 ].offset = pxDiscipline->phase + pxDiscipline->residual +
+                                      ( ( pxDiscipline->freq * ( int64_t )ullSlewEnd ) / exlibSNTP_NOW_PPB );
+    pxSnapshot->segment[ 1 ].rate   = llFreqRate;
+  }
+  else
+  {
+    /* Do Nothing : MISRA 15.7 */
+  }
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Publish a snapshot to the readers, both copies are updated one after the other.
+ *          An odd sequence moves the readers to the copy 1 while the copy 0 is written, then back.
+ * @param   pxSnapshot: Pointer to the new snapshot.
+ *          This parameter can be a value of @ref const struct xSntpClockSnapshot_t *.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_now_snapshot_write( const struct xSntpClockSnapshot_t * pxSnapshot )
+{
+  ulg_now_sequence++;
+  exlibSNTP_MEMORY_BARRIER();
+
+  xg_now_snapshot[ 0 ] = *pxSnapshot;
+
+  exlibSNTP_MEMORY_BARRIER();
+  ulg_now_sequence++;
+  exlibSNTP_MEMORY_BARRIER();
+
+  xg_now_snapshot[ 1 ] = *pxSnapshot;
+
+  exlibSNTP_MEMORY_BARRIER();
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Rate of a frequency correction, rounded to the nearest unit.
+ * @param   llPpb: Frequency correction in ppb.
+ *          This parameter can be a value of @ref int64_t.
+ * @retval  Rate in 2^-32 us per us, this parameter can be a value of @ref int64_t.
+ */
+#pragma optimize=speed
+__STATIC_INLINE int64_t prv_now_rate( int64_t llPpb )
+{
+  int64_t llHalf = ( llPpb < 0 ) ? -( exlibSNTP_NOW_PPB / 2 ) : ( exlibSNTP_NOW_PPB / 2 );
+
+  return ( ( llPpb * exlibSNTP_NOW_RATE_ONE ) + llHalf ) / exlibSNTP_NOW_PPB;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Correction of a segment at the raw local time, a raw time before the segment start gets its offset.
+ * @param   pxSegment: Pointer to the segment.
+ *          This parameter can be a value of @ref const struct xSntpClockSegment_t *.
+ * @param   ullRawTime: Raw local 64-UNIX time in us.
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  Correction in us, this parameter can be a value of @ref int64_t.
+ */
+#pragma optimize=speed
+__STATIC_INLINE int64_t prv_now_correction( const struct xSntpClockSegment_t * pxSegment, uint64_t ullRawTime )
+{
+  uint64_t ullElapsed = ( ullRawTime > pxSegment->base ) ? ( ullRawTime - pxSegment->base ) : ( uint64_t )0;
+
+  /** @remark The elapsed time is split in 32-bit halves, the products never overflow whatever the time
+   *  since the last update. The shift is arithmetic, the correction is rounded down */
+  return pxSegment->offset +
+         ( ( int64_t )( ullElapsed >> 32 ) * pxSegment->rate ) +
+         ( ( ( int64_t )( ullElapsed & 0xFFFFFFFFu ) * pxSegment->rate ) >> 32 );
+}
+/** @} */
+
+#endif /* exlibSNTP_CONFIG_FAST_NOW */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
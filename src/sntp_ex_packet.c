@@ -0,0 +1,362 @@
+/**
+ * @file    sntpex_ti/sntp_ex_packet.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   NTP/SNTP time message codec of the Extended SNTP library.
+ *
+ * @note    The time message is parsed and serialised with explicit big-endian loads and stores at the
+ *          RFC 4330 field offsets, the buffer is never casted to a structure. The codec is therefore
+ *          alignment-safe and does not depend on the compiler bitfield layout (TI, GCC and IAR).
+ *
+ * @details Every field is converted once, into the host order decoded view @ref struct xSntpPacket_t .
+ *          The extension fields and the MAC following the header are located without being copied.
+ *          The clock offset and round-trip delay of an exchange are computed as specified by RFC 4330
+ *          section 5, from the 64-UNIX times in microseconds exported in @ref struct xTimestampCtx_t :
+ *          T1 @ref originate64_ts, T2 @ref receive64_ts, T3 @ref transmit64_ts and T4 @ref reference64_ts.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Jan 8, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntp_ex_lib_ti.h"
+
+/* Private function   ------------------------------------------------------------*/
+/**
+ * @defgroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief Packet utility APIs
+ *        Private functions used by @ref sntp_ex_packet.c .
+ *       + @ref prv_packet_load32
+ *       + @ref prv_packet_store32
+ *       + @ref prv_packet_load_ts
+ *       + @ref prv_packet_store_ts
+ * @{
+ */
+/**
+ * @brief Load a big-endian 32-bit field */
+__STATIC_INLINE uint32_t prv_packet_load32( const uint8_t * pucBuffer );
+/**
+ * @brief Store a 32-bit field in big-endian */
+__STATIC_INLINE void     prv_packet_store32( uint8_t * pucBuffer, uint32_t ulValue );
+/**
+ * @brief Load a big-endian NTP timestamp field */
+__STATIC_INLINE void     prv_packet_load_ts( const uint8_t * pucBuffer, NtpTimestamp * pxTimestamp );
+/**
+ * @brief Store an NTP timestamp field in big-endian */
+__STATIC_INLINE void     prv_packet_store_ts( uint8_t * pucBuffer, const NtpTimestamp * pxTimestamp );
+/**
+ * @}
+ */
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+  * @{
+  */
+/* Exported function   ------------------------------------------------------------*/
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   decode an NTP/SNTP time message into the host order view.
+ * @param   pucBuffer: Pointer to the received time message, no alignment is required.
+ *          This parameter can be a value of @ref const uint8_t *.
+ * @param   usLength: Length of the received time message.
+ *          This parameter can be a value of @ref uint16_t.
+ * @param   pxPacket: Pointer to the decoded view.
+ *          This parameter can be a value of @ref struct xSntpPacket_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_packet_decode( const uint8_t * pucBuffer, uint16_t usLength, struct xSntpPacket_t * pxPacket )
+{
+  uint8_t ucFlags;
+
+  /* Make sure that the buffer and the decoded view are valid */
+  if( ( NULL == pucBuffer ) || ( NULL == pxPacket ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Ensure the NTP packet carries the whole header */
+  if( usLength < exlibSNTP_PACKET_HEADER_SIZE )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_INVALID_MESSAGE;
+  }
+
+  /* Field 0 : LI (2 bits), VN (3 bits) and Mode (3 bits), MSB first */
+  ucFlags             = pucBuffer[ exlibSNTP_PKT_OFFSET_FLAGS ];
+  pxPacket->li        = ( uint8_t )( ( ucFlags >> 6 ) & 0x03u );
+  pxPacket->vn        = ( uint8_t )( ( ucFlags >> 3 ) & 0x07u );
+  pxPacket->mode      = ( uint8_t )(   ucFlags        & 0x07u );
+
+  /* Field 1-3 */
+  pxPacket->stratum   = pucBuffer[ exlibSNTP_PKT_OFFSET_STRATUM ];
+  pxPacket->poll      = pucBuffer[ exlibSNTP_PKT_OFFSET_POLL ];
+  pxPacket->precision = ( int8_t )pucBuffer[ exlibSNTP_PKT_OFFSET_PRECISION ];
+
+  /* Field 4-15 */
+  pxPacket->rootDelay      = prv_packet_load32( &pucBuffer[ exlibSNTP_PKT_OFFSET_ROOT_DELAY ] );
+  pxPacket->rootDispersion = prv_packet_load32( &pucBuffer[ exlibSNTP_PKT_OFFSET_ROOT_DISP ] );
+  pxPacket->referenceId    = prv_packet_load32( &pucBuffer[ exlibSNTP_PKT_OFFSET_REF_ID ] );
+
+  /* Field 16-47 */
+  prv_packet_load_ts( &pucBuffer[ exlibSNTP_PKT_OFFSET_REF_TS  ], &pxPacket->referenceTimestamp );
+  prv_packet_load_ts( &pucBuffer[ exlibSNTP_PKT_OFFSET_ORIG_TS ], &pxPacket->originateTimestamp );
+  prv_packet_load_ts( &pucBuffer[ exlibSNTP_PKT_OFFSET_RECV_TS ], &pxPacket->receiveTimestamp );
+  prv_packet_load_ts( &pucBuffer[ exlibSNTP_PKT_OFFSET_XMIT_TS ], &pxPacket->transmitTimestamp );
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   encode the host order view into an NTP/SNTP time message.
+ * @param   pxPacket: Pointer to the host order view.
+ *          This parameter can be a value of @ref const struct xSntpPacket_t *.
+ * @param   pucBuffer: Pointer to the output buffer, no alignment is required.
+ *          This parameter can be a value of @ref uint8_t *.
+ * @param   usSize: Size of the output buffer.
+ *          This parameter can be a value of @ref uint16_t.
+ * @param   pusLength: Pointer to the encoded length.
+ *          This parameter can be a value of @ref uint16_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_packet_encode( const struct xSntpPacket_t * pxPacket, uint8_t * pucBuffer, uint16_t usSize, uint16_t * pusLength )
+{
+  /* Make sure that the view, the buffer and the length are valid */
+  if( ( NULL == pxPacket ) || ( NULL == pucBuffer ) || ( NULL == pusLength ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Ensure the output buffer can hold the whole header */
+  if( usSize < exlibSNTP_PACKET_HEADER_SIZE )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_INVALID_MESSAGE;
+  }
+
+  /* Field 0-3 */
+  pucBuffer[ exlibSNTP_PKT_OFFSET_FLAGS ]     = ( uint8_t )( ( ( pxPacket->li & 0x03u ) << 6 ) |
+                                                             ( ( pxPacket->vn & 0x07u ) << 3 ) |
+                                                               ( pxPacket->mode & 0x07u ) );
+  pucBuffer[ exlibSNTP_PKT_OFFSET_STRATUM ]   = pxPacket->stratum;
+  pucBuffer[ exlibSNTP_PKT_OFFSET_POLL ]      = pxPacket->poll;
+  pucBuffer[ exlibSNTP_PKT_OFFSET_PRECISION ] = ( uint8_t )pxPacket->precision;
+
+  /* Field 4-15 */
+  prv_packet_store32( &pucBuffer[ exlibSNTP_PKT_OFFSET_ROOT_DELAY ], pxPacket->rootDelay );
+  prv_packet_store32( &pucBuffer[ exlibSNTP_PKT_OFFSET_ROOT_DISP ],  pxPacket->rootDispersion );
+  prv_packet_store32( &pucBuffer[ exlibSNTP_PKT_OFFSET_REF_ID ],     pxPacket->referenceId );
+
+  /* Field 16-47 */
+  prv_packet_store_ts( &pucBuffer[ exlibSNTP_PKT_OFFSET_REF_TS  ], &pxPacket->referenceTimestamp );
+  prv_packet_store_ts( &pucBuffer[ exlibSNTP_PKT_OFFSET_ORIG_TS ], &pxPacket->originateTimestamp );
+  prv_packet_store_ts( &pucBuffer[ exlibSNTP_PKT_OFFSET_RECV_TS ], &pxPacket->receiveTimestamp );
+  prv_packet_store_ts( &pucBuffer[ exlibSNTP_PKT_OFFSET_XMIT_TS ], &pxPacket->transmitTimestamp );
+
+  /* save the encoded length */
+  *pusLength = exlibSNTP_PACKET_HEADER_SIZE;
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   locate the extension fields and the MAC following the header of a time message.
+ * @param   pucBuffer: Pointer to the received time message, no alignment is required.
+ *          This parameter can be a value of @ref const uint8_t *.
+ * @param   usLength: Length of the received time message.
+ *          This parameter can be a value of @ref uint16_t.
+ * @param   pxTrailer: Pointer to the located fields.
+ *          This parameter can be a value of @ref struct xSntpTrailer_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERR_INVALID_MESSAGE when the fields are malformed.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_packet_trailer_parse( const uint8_t * pucBuffer, uint16_t usLength, struct xSntpTrailer_t * pxTrailer )
+{
+  uint16_t usOffset = exlibSNTP_PACKET_HEADER_SIZE;
+
+  /* Make sure that the buffer and the located fields are valid */
+  if( ( NULL == pucBuffer ) || ( NULL == pxTrailer ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Ensure the NTP packet carries the whole header */
+  if( usLength < exlibSNTP_PACKET_HEADER_SIZE )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_INVALID_MESSAGE;
+  }
+
+  ( void )memset( pxTrailer, 0, sizeof( struct xSntpTrailer_t ) );
+
+  /** @remark RFC 7822 section 7.5 : the remaining bytes are a MAC when they match the Key Identifier alone
+   *  (crypto-NAK) or with a 16 or 20 bytes digest, an extension field otherwise. Every field advances the
+   *  offset by at least 16 bytes, so the walk is bounded by the buffer length */
+  while( usOffset < usLength )
+  {
+    uint16_t usRemaining = ( uint16_t )( usLength - usOffset );
+
+    if( ( usRemaining == exlibSNTP_AUTH_KEY_ID_SIZE ) ||
+        ( usRemaining == ( exlibSNTP_AUTH_KEY_ID_SIZE + 16u ) ) ||
+        ( usRemaining == ( exlibSNTP_AUTH_KEY_ID_SIZE + exlibSNTP_AUTH_MAC_MAX_SIZE ) ) )
+    {
+      pxTrailer->macOffset = usOffset;
+      pxTrailer->macLength = ( uint8_t )( usRemaining - exlibSNTP_AUTH_KEY_ID_SIZE );
+      pxTrailer->keyId     = prv_packet_load32( &pucBuffer[ usOffset ] );
+
+      /* Return the error status. */
+      return SNTPEX_SUCCESS;
+    }
+
+    /* Extension field : Field Type (16 bits), Length (16 bits) of the whole field, then the value */
+    uint16_t usFieldLength = ( usRemaining < exlibSNTP_EXT_FIELD_MIN_SIZE ) ? 0u :
+                             ( uint16_t )( ( ( uint16_t )pucBuffer[ usOffset + 2u ] << 8 ) | pucBuffer[ usOffset + 3u ] );
+
+    if( ( usFieldLength < exlibSNTP_EXT_FIELD_MIN_SIZE ) || ( ( usFieldLength & 0x03u ) != 0 ) || ( usFieldLength > usRemaining ) ||
+        ( ( usFieldLength == usRemaining ) && ( usFieldLength < exlibSNTP_EXT_FIELD_LAST_MIN_SIZE ) ) )
+    {
+      /* Malformed or truncated field, return the error status. */
+      return SNTPEX_ERR_INVALID_MESSAGE;
+    }
+
+    pxTrailer->extCount++;
+    pxTrailer->extLength = ( uint16_t )( pxTrailer->extLength + usFieldLength );
+    usOffset             = ( uint16_t )( usOffset + usFieldLength );
+  }
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   compute the clock offset and round-trip delay from the timestamp list.
+ * @param   xTimestampCtx: Pointer to timestamp list (T1,T2,T3 and T4).
+ *          This parameter can be a value of @ref const struct xTimestampCtx_t *.
+ * @param   pxSample: Pointer to the computed sample.
+ *          This parameter can be a value of @ref struct xSntpSample_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_sample_compute( const struct xTimestampCtx_t * xTimestampCtx, struct xSntpSample_t * pxSample )
+{
+  /* Make sure that the timestamp list and the sample are valid */
+  if( ( NULL == xTimestampCtx ) || ( NULL == pxSample ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Every timestamp must be filled */
+  if( ( xTimestampCtx->originate64_ts == 0 ) || ( xTimestampCtx->receive64_ts   == 0 ) ||
+      ( xTimestampCtx->transmit64_ts  == 0 ) || ( xTimestampCtx->reference64_ts == 0 ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_INVALID_MESSAGE;
+  }
+
+  /* T1, T2, T3 and T4 */
+  int64_t llT1 = ( int64_t )xTimestampCtx->originate64_ts;
+  int64_t llT2 = ( int64_t )xTimestampCtx->receive64_ts;
+  int64_t llT3 = ( int64_t )xTimestampCtx->transmit64_ts;
+  int64_t llT4 = ( int64_t )xTimestampCtx->reference64_ts;
+
+  /** @remark offset = ((T2 - T1) + (T3 - T4)) / 2 , delay = (T4 - T1) - (T3 - T2)
+   *  The differences are computed first, so the 64-bit sums cannot overflow */
+  pxSample->offset = ( ( llT2 - llT1 ) + ( llT3 - llT4 ) ) / 2;
+  pxSample->delay  = ( llT4 - llT1 ) - ( llT3 - llT2 );
+  pxSample->epoch  = xTimestampCtx->reference64_ts;
+
+  /* A negative delay is only caused by the clocks resolution, it is clamped to 0 */
+  if( pxSample->delay < 0 )
+  {
+    pxSample->delay = 0;
+  }
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+/** @} */
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+  * @{
+  */
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Load a big-endian 32-bit field, byte by byte so no alignment is required.
+ * @param   pucBuffer: Pointer to the field
+ *          This parameter can be a value of @ref const uint8_t *.
+ * @retval  Host order value, this parameter can be a value of @ref uint32_t.
+ */
+#pragma optimize=speed
+__STATIC_INLINE uint32_t prv_packet_load32( const uint8_t * pucBuffer )
+{
+  return ( ( uint32_t )pucBuffer[ 0 ] << 24 ) | ( ( uint32_t )pucBuffer[ 1 ] << 16 ) |
+         ( ( uint32_t )pucBuffer[ 2 ] <<  8 ) |   ( uint32_t )pucBuffer[ 3 ];
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Store a 32-bit field in big-endian, byte by byte so no alignment is required.
+ * @param   pucBuffer: Pointer to the field
+ *          This parameter can be a value of @ref uint8_t *.
+ * @param   ulValue: Host order value
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_packet_store32( uint8_t * pucBuffer, uint32_t ulValue )
+{
+  pucBuffer[ 0 ] = ( uint8_t )( ulValue >> 24 );
+  pucBuffer[ 1 ] = ( uint8_t )( ulValue >> 16 );
+  pucBuffer[ 2 ] = ( uint8_t )( ulValue >>  8 );
+  pucBuffer[ 3 ] = ( uint8_t )( ulValue );
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Load a big-endian NTP timestamp field (32 bit sec, 32 bit frac).
+ * @param   pucBuffer: Pointer to the field
+ *          This parameter can be a value of @ref const uint8_t *.
+ * @param   pxTimestamp: Pointer to the host order timestamp
+ *          This parameter can be a value of @ref NtpTimestamp *.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_packet_load_ts( const uint8_t * pucBuffer, NtpTimestamp * pxTimestamp )
+{
+  pxTimestamp->seconds  = prv_packet_load32( &pucBuffer[ 0 ] );
+  pxTimestamp->fraction = prv_packet_load32( &pucBuffer[ 4 ] );
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Store an NTP timestamp field in big-endian (32 bit sec, 32 bit frac).
+ * @param   pucBuffer: Pointer to the field
+ *          This parameter can be a value of @ref uint8_t *.
+ * @param   pxTimestamp: Pointer to the host order timestamp
+ *          This parameter can be a value of @ref const NtpTimestamp *.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_packet_store_ts( uint8_t * pucBuffer, const NtpTimestamp * pxTimestamp )
+{
+  prv_packet_store32( &pucBuffer[ 0 ], pxTimestamp->seconds );
+  prv_packet_store32( &pucBuffer[ 4 ], pxTimestamp->fraction );
+}
+/** @} */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
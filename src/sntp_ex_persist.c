@@ -0,0 +1,455 @@
+/**
+ * @file    sntpex_ti/sntp_ex_persist.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Warm-start persistence of the clock state of the Extended SNTP library.
+ *
+ * @note    The clock filter, the clock discipline, the poll scheduler, the servers and the server names cache
+ *          are written through the @ref nv_write vtable API (e.g. SimpleLink @ref sl_FsWrite) as a record
+ *          protected by a CRC-32. The record is streamed section by section, no copy of the state is needed.
+ *          Only the sections of the enabled features are written, the record of another configuration has
+ *          another length and is rejected.
+ *
+ * @details The samples, the phase and the cached names are only kept when the raw local clock kept running
+ *          across the reset (e.g. RTC of the hibernate mode), as reported by the @ref get_clock_epoch vtable
+ *          API. Otherwise only the frequency estimate, the poll exponent and the servers are restored, the
+ *          first exchange then sets the phase without waiting for a frequency measurement.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Jan 20, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntp_ex_lib_ti.h"
+
+#if ( exlibSNTP_CONFIG_PERSIST == 1 )
+
+/* Private macros ----------------------------------------------------------------*/
+/* highest number of sections of the record, following the record header */
+#define exlibSNTP_PERSIST_SECTIONS      ( 8u )
+
+/* size of the buffer used to check the record CRC-32 */
+#define exlibSNTP_PERSIST_CHUNK_SIZE    ( 32u )
+
+/* Private function   ------------------------------------------------------------*/
+/**
+ * @defgroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief Persistence utility APIs
+ *        Private functions used by @ref sntp_ex_persist.c .
+ *       + @ref prv_persist_sections
+ *       + @ref prv_persist_crc32
+ *       + @ref prv_persist_check
+ * @{
+ */
+/**
+ * @brief List the client state sections of the record, in the record order */
+__STATIC_INLINE uint8_t  prv_persist_sections( sntpex_client_handle_t * p_client, void * apvSection[], uint16_t ausSize[], uint16_t * pusLength );
+/**
+ * @brief Update a CRC-32 (IEEE 802.3, reflected) with a buffer */
+__STATIC_INLINE uint32_t prv_persist_crc32   ( uint32_t ulCrc, const void * pvData, uint16_t usLength );
+/**
+ * @brief Read the record once, and check its header and its CRC-32 */
+__STATIC_INLINE sntp_ud_t prv_persist_check  ( sntpex_client_handle_t * p_client, struct xSntpPersistHeader_t * pxHeader, uint16_t usLength );
+/**
+ * @}
+ */
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+  * @{
+  */
+/* Exported function   ------------------------------------------------------------*/
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   save the clock state of the client, typically before entering the hibernate mode.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_state_save( sntpex_client_handle_t *p_client )
+{
+  struct xSntpPersistHeader_t xHeader;
+  void                      * apvSection[ exlibSNTP_PERSIST_SECTIONS ];
+  uint16_t                    ausSize[ exlibSNTP_PERSIST_SECTIONS ];
+  uint32_t                    ulOffset;
+  uint32_t                    ulCrc;
+  uint8_t                     ucCount;
+  uint8_t                     ucIndex;
+
+  /* Make sure the SNTP client context is valid */
+  if( NULL == p_client )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* The client must be initialized, and the storage provided by the application */
+  if( ( NULL == p_client->sock ) || ( NULL == p_client->vtable_api.nv_write ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_FAULT_INIT;
+  }
+
+  ( void )memset( &xHeader, 0, sizeof( xHeader ) );
+
+  xHeader.magic     = exlibSNTP_PERSIST_MAGIC;
+  xHeader.version   = exlibSNTP_PERSIST_VERSION;
+  ucCount           = prv_persist_sections( p_client, apvSection, ausSize, &xHeader.length );
+  xHeader.savedTime = p_client->vtable_api.get_unix_timestamp();
+  xHeader.savedTick = p_client->vtable_api.get_os_tick();
+
+  if( NULL != p_client->vtable_api.get_clock_epoch )
+  {
+    xHeader.clockEpoch = p_client->vtable_api.get_clock_epoch();
+  }
+  else
+  {
+    /* Do Nothing : MISRA 15.7 */
+  }
+
+  if( 0 != p_client->vtable_api.nv_write( 0, &xHeader, sizeof( xHeader ) ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_PERSIST;
+  }
+
+  ulCrc    = prv_persist_crc32( 0xFFFFFFFFu, &xHeader, sizeof( xHeader ) );
+  ulOffset = sizeof( xHeader );
+
+  /* Stream the sections straight from the client handle */
+  for( ucIndex = 0; ucIndex < ucCount; ucIndex++ )
+  {
+    if( 0 != p_client->vtable_api.nv_write( ulOffset, apvSection[ ucIndex ], ausSize[ ucIndex ] ) )
+    {
+      /* Return the error status. */
+      return SNTPEX_ERR_PERSIST;
+    }
+
+    ulCrc     = prv_persist_crc32( ulCrc, apvSection[ ucIndex ], ausSize[ ucIndex ] );
+    ulOffset += ausSize[ ucIndex ];
+  }
+
+  /* The CRC-32 closes the record, a partially written record is never restored */
+  ulCrc = ~ulCrc;
+
+  if( 0 != p_client->vtable_api.nv_write( ulOffset, &ulCrc, sizeof( ulCrc ) ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_PERSIST;
+  }
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   restore the clock state saved by @ref sntpex_client_state_save , the next sync is due immediately.
+ *          Must be called after @ref sntpex_clientInitialization , before any request.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERR_PERSIST when no valid record is stored (cold start).
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_state_restore( sntpex_client_handle_t *p_client )
+{
+  struct xSntpPersistHeader_t xHeader;
+  void                      * apvSection[ exlibSNTP_PERSIST_SECTIONS ];
+  uint16_t                    ausSize[ exlibSNTP_PERSIST_SECTIONS ];
+  uint32_t                    ulOffset = sizeof( xHeader );
+  uint16_t                    usLength;
+  uint8_t                     ucSections;
+  uint8_t                     ucIndex;
+
+  /* Make sure the SNTP client context is valid */
+  if( NULL == p_client )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* The client must be initialized, and the storage provided by the application */
+  if( ( NULL == p_client->sock ) || ( NULL == p_client->vtable_api.nv_read ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_FAULT_INIT;
+  }
+
+  ucSections = prv_persist_sections( p_client, apvSection, ausSize, &usLength );
+
+  /* The client state is only overwritten by a valid record */
+  if( prv_persist_check( p_client, &xHeader, usLength ) != SNTPEX_SUCCESS )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_PERSIST;
+  }
+
+  for( ucIndex = 0; ucIndex < ucSections; ucIndex++ )
+  {
+    if( 0 != p_client->vtable_api.nv_read( ulOffset, apvSection[ ucIndex ], ausSize[ ucIndex ] ) )
+    {
+      /* Storage error, back to a cold start */
+#if ( exlibSNTP_CONFIG_FILTER == 1 )
+      sntpex_filter_reset( &p_client->xFilter );
+#else
+      ( void )memset( &p_client->xLastSample, 0, sizeof( p_client->xLastSample ) );
+#endif
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 1 )
+      sntpex_discipline_reset( &p_client->xDiscipline );
+#endif
+#if ( exlibSNTP_CONFIG_POLL == 1 )
+      ( void )sntpex_poll_reset( &p_client->xPoll, exlibSNTP_POLL_MIN_EXPONENT, exlibSNTP_POLL_MAX_EXPONENT );
+#endif
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+      ( void )memset( p_client->xServerList, 0, sizeof( p_client->xServerList ) );
+      p_client->ucServerCount = 0;
+#endif
+#if ( exlibSNTP_CONFIG_DNS_CACHE == 1 )
+      ( void )memset( p_client->xDnsCache, 0, sizeof( p_client->xDnsCache ) );
+#endif
+
+#if ( exlibSNTP_CONFIG_FAST_NOW == 1 )
+      ( void )sntpex_now_publish( p_client );
+#endif
+
+      /* Return the error status. */
+      return SNTPEX_ERR_PERSIST;
+    }
+
+    ulOffset += ausSize[ ucIndex ];
+  }
+
+  uint64_t ullNow  = p_client->vtable_api.get_unix_timestamp();
+  uint32_t ulTick  = p_client->vtable_api.get_os_tick();
+
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+  uint8_t  ucCount = ( p_client->ucServerCount > exlibSNTP_CLIENT_MAX_SERVERS ) ? exlibSNTP_CLIENT_MAX_SERVERS : p_client->ucServerCount;
+
+  /* The in-flight requests of the saved servers are over */
+  p_client->ucServerCount = ucCount;
+
+  for( ucIndex = 0; ucIndex < ucCount; ucIndex++ )
+  {
+    ( void )memset( &p_client->xServerList[ ucIndex ].expected_orig_ts, 0, sizeof( NtpTimestamp ) );
+  }
+#endif
+
+  /** @remark The raw local times of the samples and of the discipline are only meaningful when the raw
+   *  clock kept running, which only the application knows: a restarted clock may well read a later time
+   *  than the save. Otherwise the frequency estimate is kept on an unset discipline, so the first sample
+   *  sets the phase and the time is disciplined at once */
+  if( ( NULL != p_client->vtable_api.get_clock_epoch )                  &&
+      ( xHeader.clockEpoch == p_client->vtable_api.get_clock_epoch() ) &&
+      ( ullNow >= xHeader.savedTime ) )
+  {
+#if ( exlibSNTP_CONFIG_DNS_CACHE == 1 )
+    uint64_t ullElapsed = ( ullNow - xHeader.savedTime ) / 1000u;
+    uint32_t ulElapsed  = ( ullElapsed > 0xFFFFFFFFu ) ? 0xFFFFFFFFu : ( uint32_t )ullElapsed;
+
+    /* Age the cached names with the time spent since the save, in ms */
+    for( ucIndex = 0; ucIndex < exlibSNTP_DNS_CACHE_ENTRIES; ucIndex++ )
+    {
+      struct xSntpDnsEntry_t * pxEntry = &p_client->xDnsCache[ ucIndex ];
+      uint32_t                 ulAge   = xHeader.savedTick - pxEntry->resolvedTick;
+
+      if( ( ulAge >= exlibSNTP_DNS_CACHE_TTL ) || ( ulElapsed >= ( exlibSNTP_DNS_CACHE_TTL - ulAge ) ) )
+      {
+        ( void )memset( pxEntry, 0, sizeof( struct xSntpDnsEntry_t ) );
+      }
+      else
+      {
+        pxEntry->resolvedTick = ulTick - ( ulAge + ulElapsed );
+      }
+    }
+#else
+    /* Do Nothing : MISRA 15.7 */
+#endif
+  }
+  else
+  {
+#if ( exlibSNTP_CONFIG_FILTER == 1 )
+    sntpex_filter_reset( &p_client->xFilter );
+#else
+    ( void )memset( &p_client->xLastSample, 0, sizeof( p_client->xLastSample ) );
+#endif
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 1 )
+    int64_t llFreq = p_client->xDiscipline.freq;
+
+    sntpex_discipline_reset( &p_client->xDiscipline );
+    p_client->xDiscipline.freq = llFreq;
+#endif
+#if ( exlibSNTP_CONFIG_DNS_CACHE == 1 )
+    ( void )memset( p_client->xDnsCache, 0, sizeof( p_client->xDnsCache ) );
+#endif
+  }
+
+#if ( exlibSNTP_CONFIG_POLL == 1 )
+  /* Keep the poll exponent, the next request is due immediately */
+  p_client->xPoll.counter     = 0;
+  p_client->xPoll.failures    = 0;
+  p_client->xPoll.lastRequest = ulTick;
+  p_client->xPoll.interval    = 0;
+#else
+  ( void )ulTick;
+#endif
+
+#if ( exlibSNTP_CONFIG_FAST_NOW == 1 )
+  /* The fast time follows the restored discipline */
+  ( void )sntpex_now_publish( p_client );
+#endif
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+/** @} */
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+  * @{
+  */
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   List the client state sections of the record, in the record order.
+ *          Only the state of the enabled features is listed.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   apvSection: Array of @ref exlibSNTP_PERSIST_SECTIONS section pointers.
+ *          This parameter can be a value of @ref void *[].
+ * @param   ausSize: Array of @ref exlibSNTP_PERSIST_SECTIONS section sizes.
+ *          This parameter can be a value of @ref uint16_t [].
+ * @param   pusLength: Pointer to the total length of the sections.
+ *          This parameter can be a value of @ref uint16_t *.
+ * @retval  Number of sections, this parameter can be a value of @ref uint8_t.
+ */
+#pragma optimize=speed
+__STATIC_INLINE uint8_t prv_persist_sections( sntpex_client_handle_t * p_client, void * apvSection[], uint16_t ausSize[], uint16_t * pusLength )
+{
+  uint8_t ucCount = 0;
+  uint8_t ucIndex;
+
+#if ( exlibSNTP_CONFIG_FILTER == 1 )
+  apvSection[ ucCount ] = &p_client->xFilter;                       ausSize[ ucCount++ ] = sizeof( p_client->xFilter );
+#else
+  apvSection[ ucCount ] = &p_client->xLastSample;                   ausSize[ ucCount++ ] = sizeof( p_client->xLastSample );
+#endif
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 1 )
+  apvSection[ ucCount ] = &p_client->xDiscipline;                   ausSize[ ucCount++ ] = sizeof( p_client->xDiscipline );
+#endif
+#if ( exlibSNTP_CONFIG_POLL == 1 )
+  apvSection[ ucCount ] = &p_client->xPoll;                         ausSize[ ucCount++ ] = sizeof( p_client->xPoll );
+#endif
+  apvSection[ ucCount ] = &p_client->sock->descriptor.SocketAddr;   ausSize[ ucCount++ ] = sizeof( p_client->sock->descriptor.SocketAddr );
+  apvSection[ ucCount ] = &p_client->sock->descriptor.InAddLength;  ausSize[ ucCount++ ] = sizeof( p_client->sock->descriptor.InAddLength );
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+  apvSection[ ucCount ] = p_client->xServerList;                    ausSize[ ucCount++ ] = sizeof( p_client->xServerList );
+  apvSection[ ucCount ] = &p_client->ucServerCount;                 ausSize[ ucCount++ ] = sizeof( p_client->ucServerCount );
+#endif
+#if ( exlibSNTP_CONFIG_DNS_CACHE == 1 )
+  apvSection[ ucCount ] = p_client->xDnsCache;                      ausSize[ ucCount++ ] = sizeof( p_client->xDnsCache );
+#endif
+
+  *pusLength = 0;
+
+  for( ucIndex = 0; ucIndex < ucCount; ucIndex++ )
+  {
+    *pusLength = ( uint16_t )( *pusLength + ausSize[ ucIndex ] );
+  }
+
+  return ucCount;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Update a CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320) with a buffer.
+ * @param   ulCrc: Current CRC-32, 0xFFFFFFFF for the first buffer.
+ *          This parameter can be a value of @ref uint32_t.
+ * @param   pvData: Pointer to the buffer.
+ *          This parameter can be a value of @ref const void *.
+ * @param   usLength: Length of the buffer.
+ *          This parameter can be a value of @ref uint16_t.
+ * @retval  Updated CRC-32, this parameter can be a value of @ref uint32_t.
+ */
+#pragma optimize=speed
+__STATIC_INLINE uint32_t prv_persist_crc32( uint32_t ulCrc, const void * pvData, uint16_t usLength )
+{
+  const uint8_t * pucData = ( const uint8_t * )pvData;
+  uint16_t        usIndex;
+  uint8_t         ucBit;
+
+  for( usIndex = 0; usIndex < usLength; usIndex++ )
+  {
+    ulCrc ^= pucData[ usIndex ];
+
+    for( ucBit = 0; ucBit < 8u; ucBit++ )
+    {
+      ulCrc = ( ulCrc >> 1 ) ^ ( 0xEDB88320u & ( 0u - ( ulCrc & 1u ) ) );
+    }
+  }
+
+  return ulCrc;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Read the record once, and check its header and its CRC-32.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pxHeader: Pointer to the read record header.
+ *          This parameter can be a value of @ref struct xSntpPersistHeader_t *.
+ * @param   usLength: Expected length of the sections, the record of another configuration is rejected.
+ *          This parameter can be a value of @ref uint16_t.
+ * @retval  SNTPEX_SUCCESS if the record is valid, SNTPEX_ERR_PERSIST otherwise.
+ */
+#pragma optimize=speed
+__STATIC_INLINE sntp_ud_t prv_persist_check( sntpex_client_handle_t * p_client, struct xSntpPersistHeader_t * pxHeader, uint16_t usLength )
+{
+  uint8_t  aucChunk[ exlibSNTP_PERSIST_CHUNK_SIZE ];
+  uint32_t ulOffset = sizeof( struct xSntpPersistHeader_t );
+  uint32_t ulEnd    = ulOffset + usLength;
+  uint32_t ulStored;
+  uint32_t ulCrc;
+
+  if( ( 0 != p_client->vtable_api.nv_read( 0, pxHeader, sizeof( struct xSntpPersistHeader_t ) ) ) ||
+      ( pxHeader->magic != exlibSNTP_PERSIST_MAGIC ) || ( pxHeader->version != exlibSNTP_PERSIST_VERSION ) ||
+      ( pxHeader->length != usLength ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_PERSIST;
+  }
+
+  ulCrc = prv_persist_crc32( 0xFFFFFFFFu, pxHeader, sizeof( struct xSntpPersistHeader_t ) );
+
+  /* The sections are checked by chunks, the client state is not modified */
+  while( ulOffset < ulEnd )
+  {
+    uint16_t usChunk = ( uint16_t )( ( ( ulEnd - ulOffset ) > sizeof( aucChunk ) ) ? sizeof( aucChunk ) : ( ulEnd - ulOffset ) );
+
+    if( 0 != p_client->vtable_api.nv_read( ulOffset, aucChunk, usChunk ) )
+    {
+      /* Return the error status. */
+      return SNTPEX_ERR_PERSIST;
+    }
+
+    ulCrc     = prv_persist_crc32( ulCrc, aucChunk, usChunk );
+    ulOffset += usChunk;
+  }
+
+  if( ( 0 != p_client->vtable_api.nv_read( ulEnd, &ulStored, sizeof( ulStored ) ) ) || ( ulStored != ~ulCrc ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_PERSIST;
+  }
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+/** @} */
+
+#endif /* exlibSNTP_CONFIG_PERSIST */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
@@ -0,0 +1,270 @@
+/**
+ * @file    sntpex_ti/sntp_ex_poll.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Adaptive poll interval scheduler of the Extended SNTP library.
+ *
+ * @note    The poll exponent is increased while the clock discipline predicts the offsets within the jitter
+ *          and the frequency is stable, it is decreased otherwise. A hysteresis counter avoids oscillations.
+ *
+ * @details The Kiss-of-Death codes RATE, DENY and RSTR back off the next request exponentially, the failed
+ *          requests are retried from the minimum exponent up to the current one.
+ *          All the intervals are handled in ms with the @ref get_os_tick vtable API.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Jan 12, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntp_ex_lib_ti.h"
+
+#if ( exlibSNTP_CONFIG_POLL == 1 )
+
+/* Private function   ------------------------------------------------------------*/
+/**
+ * @defgroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief Poll utility APIs
+ *        Private functions used by @ref sntp_ex_poll.c .
+ *       + @ref prv_poll_adapt
+ *       + @ref prv_poll_abs
+ * @{
+ */
+/**
+ * @brief Adapt the poll exponent to the result of a successful request */
+__STATIC_INLINE void    prv_poll_adapt( struct xSntpPoll_t * pxPoll, int64_t llJitter, const struct xSntpDiscipline_t * pxDiscipline );
+/**
+ * @brief Absolute value of a 64-bit signed value */
+__STATIC_INLINE int64_t prv_poll_abs  ( int64_t llValue );
+/**
+ * @}
+ */
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+  * @{
+  */
+/* Exported function   ------------------------------------------------------------*/
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   clear the poll scheduler, the next request is due immediately.
+ * @param   pxPoll: Pointer to the poll scheduler.
+ *          This parameter can be a value of @ref struct xSntpPoll_t *.
+ * @param   ucMinExponent: Minimum poll exponent (interval of 2^exponent seconds).
+ *          This parameter can be a value of @ref uint8_t.
+ * @param   ucMaxExponent: Maximum poll exponent, lower or equal to @ref exlibSNTP_POLL_KOD_MAX_EXPONENT .
+ *          This parameter can be a value of @ref uint8_t.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERROR when the range is not valid.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_poll_reset( struct xSntpPoll_t * pxPoll, uint8_t ucMinExponent, uint8_t ucMaxExponent )
+{
+  /* Make sure that the poll scheduler is valid */
+  if( NULL == pxPoll )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Make sure that the range is valid, the interval in ms must fit the os tick */
+  if( ( ucMinExponent > ucMaxExponent ) || ( ucMaxExponent > exlibSNTP_POLL_KOD_MAX_EXPONENT ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERROR;
+  }
+
+  ( void )memset( pxPoll, 0, sizeof( struct xSntpPoll_t ) );
+
+  pxPoll->minExponent = ucMinExponent;
+  pxPoll->maxExponent = ucMaxExponent;
+  pxPoll->exponent    = ucMinExponent;
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   schedule the next request from the result of the completed one.
+ * @param   pxPoll: Pointer to the poll scheduler.
+ *          This parameter can be a value of @ref struct xSntpPoll_t *.
+ * @param   xStatus: Status of the completed request.
+ *          This parameter can be a value of @ref sntp_ud_t.
+ * @param   ulKissCode: Kiss code of the reply, used when the status is @ref SNTPEX_ERR_REQUEST_REJECTED .
+ *          This parameter can be a value of @ref uint32_t.
+ * @param   llJitter: Jitter of the samples in us, @ref jitter of the clock filter (0 without the clock filter).
+ *          This parameter can be a value of @ref int64_t.
+ * @param   pxDiscipline: Pointer to the clock discipline (residual offset and frequency).
+ *          This parameter can be a value of @ref const struct xSntpDiscipline_t *.
+ * @param   ulNow: Current os tick in ms.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_poll_update( struct xSntpPoll_t * pxPoll, sntp_ud_t xStatus, uint32_t ulKissCode,
+                              int64_t llJitter, const struct xSntpDiscipline_t * pxDiscipline, uint32_t ulNow )
+{
+  uint8_t ucExponent;
+
+  /* Make sure that the poll scheduler and the clock discipline are valid */
+  if( ( NULL == pxPoll ) || ( NULL == pxDiscipline ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  if( xStatus == SNTPEX_SUCCESS )
+  {
+    /* The server accepts the requests again */
+    pxPoll->backoff  = 0;
+    pxPoll->failures = 0;
+
+    prv_poll_adapt( pxPoll, llJitter, pxDiscipline );
+
+    ucExponent = pxPoll->exponent;
+  }
+  else if( xStatus == SNTPEX_ERR_REQUEST_REJECTED )
+  {
+    /** @remark RFC 4330 section 8 : DENY and RSTR ask to stop sending, the interval is raised to the maximum.
+     *  RATE asks to reduce the rate, the interval is doubled on every RATE code */
+    if( ( ulKissCode == exlibSNTP_KOD_DENY ) || ( ulKissCode == exlibSNTP_KOD_RSTR ) )
+    {
+      pxPoll->exponent = pxPoll->maxExponent;
+    }
+
+    if( ( pxPoll->exponent + pxPoll->backoff ) < exlibSNTP_POLL_KOD_MAX_EXPONENT )
+    {
+      pxPoll->backoff++;
+    }
+
+    /* The server poll field of the kiss carries its minimum accepted exponent */
+    ucExponent = ( uint8_t )( pxPoll->exponent + pxPoll->backoff );
+    ucExponent = ( pxPoll->serverPoll > ucExponent ) ? pxPoll->serverPoll : ucExponent;
+    ucExponent = ( ucExponent > exlibSNTP_POLL_KOD_MAX_EXPONENT ) ? exlibSNTP_POLL_KOD_MAX_EXPONENT : ucExponent;
+  }
+  else
+  {
+    /* Request lost, retried from the minimum interval up to the current one */
+    ucExponent = ( uint8_t )( pxPoll->minExponent + pxPoll->failures );
+
+    if( ucExponent < pxPoll->exponent )
+    {
+      pxPoll->failures++;
+    }
+    else
+    {
+      ucExponent = pxPoll->exponent;
+    }
+  }
+
+  /* Schedule the next request */
+  pxPoll->lastRequest = ulNow;
+  pxPoll->interval    = ( 1u << ucExponent ) * 1000u;
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the time until the next request is due.
+ * @param   pxPoll: Pointer to the poll scheduler.
+ *          This parameter can be a value of @ref const struct xSntpPoll_t *.
+ * @param   ulNow: Current os tick in ms.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  Time in ms, 0 when the request is due.
+ */
+#pragma optimize=speed
+uint32_t sntpex_poll_time_until_next( const struct xSntpPoll_t * pxPoll, uint32_t ulNow )
+{
+  if( NULL == pxPoll )
+  {
+    return 0;
+  }
+
+  /* The unsigned difference handles the os tick wrap-around */
+  uint32_t ulElapsed = ulNow - pxPoll->lastRequest;
+
+  return ( ulElapsed < pxPoll->interval ) ? ( pxPoll->interval - ulElapsed ) : 0;
+}
+/** @} */
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+  * @{
+  */
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Adapt the poll exponent to the result of a successful request.
+ * @param   pxPoll: Pointer to the poll scheduler.
+ *          This parameter can be a value of @ref struct xSntpPoll_t *.
+ * @param   llJitter: Jitter of the samples, in us.
+ *          This parameter can be a value of @ref int64_t.
+ * @param   pxDiscipline: Pointer to the clock discipline.
+ *          This parameter can be a value of @ref const struct xSntpDiscipline_t *.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_poll_adapt( struct xSntpPoll_t * pxPoll, int64_t llJitter, const struct xSntpDiscipline_t * pxDiscipline )
+{
+  int64_t llFreqDelta = prv_poll_abs( pxDiscipline->freq - pxPoll->lastFreq );
+
+  pxPoll->lastFreq = pxDiscipline->freq;
+
+  /* The jitter is never lower than the resolution of the local clock */
+  llJitter = ( llJitter > exlibSNTP_POLL_JITTER_FLOOR ) ? llJitter : exlibSNTP_POLL_JITTER_FLOOR;
+
+  /* The frequency is not estimated yet, keep the minimum interval */
+  if( pxDiscipline->state != SNTPEX_DISCIPLINE_SYNC )
+  {
+    pxPoll->exponent = pxPoll->minExponent;
+    pxPoll->counter  = 0;
+    return;
+  }
+
+  /** @remark The residual is the part of the offset the discipline did not predict. When it stays within
+   *  the jitter with a stable frequency, a longer interval keeps the same accuracy */
+  if( ( prv_poll_abs( pxDiscipline->residual ) <= ( exlibSNTP_POLL_GATE * llJitter ) ) &&
+      ( llFreqDelta <= exlibSNTP_POLL_FREQ_STABILITY_PPB ) )
+  {
+    pxPoll->counter++;
+
+    if( pxPoll->counter >= exlibSNTP_POLL_HYSTERESIS )
+    {
+      pxPoll->exponent = ( pxPoll->exponent < pxPoll->maxExponent ) ? ( uint8_t )( pxPoll->exponent + 1 ) : pxPoll->maxExponent;
+      pxPoll->counter  = 0;
+    }
+  }
+  else
+  {
+    /* A bad prediction weights twice a good one */
+    pxPoll->counter -= 2;
+
+    if( pxPoll->counter <= -exlibSNTP_POLL_HYSTERESIS )
+    {
+      pxPoll->exponent = ( pxPoll->exponent > pxPoll->minExponent ) ? ( uint8_t )( pxPoll->exponent - 1 ) : pxPoll->minExponent;
+      pxPoll->counter  = 0;
+    }
+  }
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Absolute value of a 64-bit signed value.
+ * @param   llValue: Input value
+ *          This parameter can be a value of @ref int64_t.
+ * @retval  Absolute value, this parameter can be a value of @ref int64_t.
+ */
+#pragma optimize=speed
+__STATIC_INLINE int64_t prv_poll_abs( int64_t llValue )
+{
+  return ( llValue < 0 ) ? -llValue : llValue;
+}
+/** @} */
+
+#endif /* exlibSNTP_CONFIG_POLL */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
@@ -0,0 +1,226 @@
+/**
+ * @file    sntpex_ti/sntp_ex_responder.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Server side of the Extended SNTP library, the replies of the responder mode (RFC 4330 section 6).
+ *
+ * @note    A disciplined gateway answers the mode 3 requests of the peer devices, so the field nodes are
+ *          synchronized on the LAN instead of querying the upstream servers across the WAN link.
+ *
+ * @details The advertised stratum, root delay and root dispersion are derived from the server of the
+ *          last sample of the upstream client, as specified in RFC 5905 section 11.2. An upstream client
+ *          which is not disciplined answers with the alarm leap indicator and the unsynchronized stratum.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Jan 21, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntp_ex_lib_ti.h"
+
+#if ( exlibSNTP_CONFIG_RESPONDER == 1 )
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+  * @{
+  */
+/* Exported function   ------------------------------------------------------------*/
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   compute the reference identifier of a server address (RFC 5905 section 7.3).
+ * @param   pxVtable: Pointer to the virtual table APIs, providing @ref compute_mac for the IPV6 hash.
+ *          This parameter can be a value of @ref const struct ud_op_vtable *.
+ * @param   pxAddress: Pointer to the server net address.
+ *          This parameter can be a value of @ref const SlNetSock_Addr_t *.
+ * @retval  IPV4 address or first 32 bits of the MD5 hash of the IPV6 address (host order), 0 when unknown.
+ */
+#pragma optimize=speed
+uint32_t sntpex_responder_reference_id( const struct ud_op_vtable * pxVtable, const SlNetSock_Addr_t * pxAddress )
+{
+  if( NULL == pxAddress )
+  {
+    return 0;
+  }
+
+  if( pxAddress->sa_family == SLNETSOCK_AF_INET )
+  {
+    return exlibSLNETUTIL_NTOHL( ( ( const SlNetSock_AddrIn_t * )pxAddress )->sin_addr.s_addr );
+  }
+
+#if ( exlibSNTP_CONFIG_IPV6 == 1 )
+  /** @remark The IPV6 address is hashed by the crypto accelerator, MD5 without key */
+  if( ( pxAddress->sa_family == SLNETSOCK_AF_INET6 ) && ( NULL != pxVtable ) && ( NULL != pxVtable->compute_mac ) )
+  {
+    uint8_t aucDigest[ exlibSNTP_AUTH_MAC_MAX_SIZE ];
+    uint8_t ucDigestLength = sizeof( aucDigest );
+
+    if( 0 == pxVtable->compute_mac( SNTPEX_AUTH_MD5, NULL, 0,
+                                    ( const uint8_t * )&( ( const SlNetSock_AddrIn6_t * )pxAddress )->sin6_addr,
+                                    sizeof( SlNetSock_In6Addr_t ), aucDigest, &ucDigestLength ) )
+    {
+      return ( ( uint32_t )aucDigest[ 0 ] << 24 ) | ( ( uint32_t )aucDigest[ 1 ] << 16 ) |
+             ( ( uint32_t )aucDigest[ 2 ] << 8  ) |   ( uint32_t )aucDigest[ 3 ];
+    }
+  }
+#else
+  ( void )pxVtable;
+#endif
+
+  return 0;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   derive the local clock quality advertised to the peers from the upstream client.
+ * @param   p_upstream: Pointer to the sntp client handle disciplined by the upstream servers.
+ *          This parameter can be a value of @ref const sntpex_client_handle_t *.
+ * @param   ullRawTime: Raw local 64-UNIX time in us.
+ *          This parameter can be a value of @ref uint64_t.
+ * @param   pxInfo: Pointer to the local clock quality.
+ *          This parameter can be a value of @ref struct xSntpResponderInfo_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_responder_info_get( const sntpex_client_handle_t * p_upstream, uint64_t ullRawTime, struct xSntpResponderInfo_t * pxInfo )
+{
+  struct xSntpSample_t xSample;
+  int64_t              llJitter;
+  uint64_t             ullDelay;
+  uint64_t             ullDispersion;
+
+  /* Make sure that the upstream client and the clock quality are valid */
+  if( ( NULL == p_upstream ) || ( NULL == pxInfo ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  ( void )memset( pxInfo, 0, sizeof( struct xSntpResponderInfo_t ) );
+  pxInfo->precision = exlibSNTP_RESPONDER_PRECISION;
+
+#if ( exlibSNTP_CONFIG_FILTER == 1 )
+  sntp_ud_t xSampleStatus = sntpex_filter_best_get( &p_upstream->xFilter, &xSample );
+
+  llJitter = p_upstream->xFilter.jitter;
+#else
+  /* Without the clock filter, the last sample is the filtered one */
+  sntp_ud_t xSampleStatus = ( p_upstream->xLastSample.epoch != 0u ) ? SNTPEX_SUCCESS : SNTPEX_ERROR;
+
+  xSample  = p_upstream->xLastSample;
+  llJitter = 0;
+#endif
+
+  /* Not disciplined yet, the peers must not use the local clock */
+  if( ( p_upstream->xDiscipline.state == SNTPEX_DISCIPLINE_UNSET ) || ( SNTPEX_SUCCESS != xSampleStatus ) )
+  {
+    pxInfo->li      = specNTP_LI_ALARM;
+    pxInfo->stratum = specNTP_STRATUM_UNSYNC;
+
+    /* Return the error status. */
+    return SNTPEX_SUCCESS;
+  }
+
+  pxInfo->li             = p_upstream->xSyncServer.li;
+  pxInfo->stratum        = ( uint8_t )( p_upstream->xSyncServer.stratum + 1u );
+  pxInfo->referenceId    = p_upstream->ulSyncReferenceId;
+  pxInfo->reference64_ts = sntpex_discipline_time_get( &p_upstream->xDiscipline, p_upstream->xDiscipline.lastUpdate );
+
+  /* Beyond the highest stratum the clock is advertised as unsynchronized */
+  if( pxInfo->stratum > exlibSNTP_RESPONDER_MAX_STRATUM )
+  {
+    pxInfo->li      = specNTP_LI_ALARM;
+    pxInfo->stratum = specNTP_STRATUM_UNSYNC;
+  }
+
+  /** @remark RFC 5905 section 11.2 : root delay = server root delay + delay, root dispersion = server root
+   *  dispersion + jitter + PHI * elapsed time since the last update */
+  ullDelay      = ( uint64_t )p_upstream->xSyncServer.rootDelay + ( uint64_t )( ( xSample.delay > 0 ) ? xSample.delay : 0 );
+  ullDispersion = ( uint64_t )p_upstream->xSyncServer.rootDispersion + ( uint64_t )( ( llJitter > 0 ) ? llJitter : 0 );
+
+  if( ullRawTime > p_upstream->xDiscipline.lastUpdate )
+  {
+    ullDispersion += ( ( ullRawTime - p_upstream->xDiscipline.lastUpdate ) * exlibSNTP_RESPONDER_PHI_PPM ) / 1000000u;
+  }
+
+  pxInfo->rootDelay      = ( uint32_t )( ( ullDelay      > 0xFFFFFFFFu ) ? 0xFFFFFFFFu : ullDelay );
+  pxInfo->rootDispersion = ( uint32_t )( ( ullDispersion > 0xFFFFFFFFu ) ? 0xFFFFFFFFu : ullDispersion );
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   build the reply (mode 4) of a decoded client request (mode 3).
+ * @param   pxRequest: Pointer to the decoded request.
+ *          This parameter can be a value of @ref const struct xSntpPacket_t *.
+ * @param   pxInfo: Pointer to the local clock quality.
+ *          This parameter can be a value of @ref const struct xSntpResponderInfo_t *.
+ * @param   ullReceiveTime: Disciplined 64-UNIX time in us at which the request is received (T2).
+ *          This parameter can be a value of @ref uint64_t.
+ * @param   ullTransmitTime: Disciplined 64-UNIX time in us at which the reply is sent (T3).
+ *          This parameter can be a value of @ref uint64_t.
+ * @param   pxReply: Pointer to the decoded reply.
+ *          This parameter can be a value of @ref struct xSntpPacket_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERR_INVALID_MESSAGE when the request is not a client request.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_responder_reply_build( const struct xSntpPacket_t * pxRequest, const struct xSntpResponderInfo_t * pxInfo,
+                                        uint64_t ullReceiveTime, uint64_t ullTransmitTime, struct xSntpPacket_t * pxReply )
+{
+  /* Make sure that the request, the clock quality and the reply are valid */
+  if( ( NULL == pxRequest ) || ( NULL == pxInfo ) || ( NULL == pxReply ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /** @remark RFC 4330 section 5 : only the client requests of the versions 1 to 4 are answered */
+  if( ( pxRequest->mode != specNTP_MODE_CLIENT ) || ( pxRequest->vn == 0 ) || ( pxRequest->vn > 4 ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_INVALID_MESSAGE;
+  }
+
+  /** @remark RFC 4330 section 6 : the version and the poll are copied from the request,
+   *  the transmit timestamp of the request is returned as originate timestamp */
+  pxReply->li                 = pxInfo->li;
+  pxReply->vn                 = pxRequest->vn;
+  pxReply->mode               = specNTP_MODE_SERVER;
+  pxReply->stratum            = pxInfo->stratum;
+  pxReply->poll               = pxRequest->poll;
+  pxReply->precision          = pxInfo->precision;
+  pxReply->referenceId        = pxInfo->referenceId;
+  pxReply->originateTimestamp = pxRequest->transmitTimestamp;
+
+  /* us to 16.16 fixed-point seconds, value = ( us * 2^16 ) / 10^6 */
+  pxReply->rootDelay          = ( uint32_t )( ( ( uint64_t )pxInfo->rootDelay      << 16 ) / 1000000u );
+  pxReply->rootDispersion     = ( uint32_t )( ( ( uint64_t )pxInfo->rootDispersion << 16 ) / 1000000u );
+
+  /* An unsynchronized clock sends a null reference timestamp */
+  if( pxInfo->reference64_ts != ( uint64_t )0 )
+  {
+    sntpex_unix64_us_to_ntp( pxInfo->reference64_ts, &pxReply->referenceTimestamp );
+  }
+  else
+  {
+    pxReply->referenceTimestamp.seconds  = 0;
+    pxReply->referenceTimestamp.fraction = 0;
+  }
+
+  sntpex_unix64_us_to_ntp( ullReceiveTime,  &pxReply->receiveTimestamp );
+  sntpex_unix64_us_to_ntp( ullTransmitTime, &pxReply->transmitTimestamp );
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+/** @} */
+
+#endif /* exlibSNTP_CONFIG_RESPONDER */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
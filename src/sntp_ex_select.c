@@ -0,0 +1,304 @@
+/**
+ * @file    sntpex_ti/sntp_ex_select.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Multi-server selection and combining of the Extended SNTP library.
+ *
+ * @note    Every replying server gives a correctness interval [ offset - lambda, offset + lambda ], where the
+ *          root distance lambda = delay/2 + root delay/2 + root dispersion. The intersection algorithm
+ *          (RFC 5905 section 11.2.1, Marzullo) keeps the largest clique of overlapping intervals, the
+ *          servers outside of it are falsetickers.
+ *
+ * @details The survivors are combined by a weighted mean of their offsets, the weight is the inverse of
+ *          the root distance increased by @ref exlibSNTP_SELECT_STRATUM_DISTANCE per stratum level.
+ *          The unsynchronized and reserved strata (@ref exlibSTRATUM_IDX) are never selected.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Jan 16, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntp_ex_lib_ti.h"
+
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+
+/* Private types ------------------------------------------------------------------*/
+/**
+ * @brief Interval endpoint, sorted by value then lower endpoints first */
+struct xSntpEndpoint_t
+{
+  int64_t value;   /* endpoint offset in us.                    */
+  uint8_t isHigh;  /* 0 for the lower endpoint, 1 for the upper. */
+};
+
+/* Private function   ------------------------------------------------------------*/
+/**
+ * @defgroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief Selection utility APIs
+ *        Private functions used by @ref sntp_ex_select.c .
+ *       + @ref prv_select_sort
+ *       + @ref prv_select_intersect
+ * @{
+ */
+/**
+ * @brief Sort the interval endpoints, insertion sort of at most 2 * @ref exlibSNTP_CLIENT_MAX_SERVERS entries */
+__STATIC_INLINE void    prv_select_sort     ( struct xSntpEndpoint_t * pxEndpoints, uint8_t ucCount );
+/**
+ * @brief Find the intersection interval of the truechimers */
+__STATIC_INLINE uint8_t prv_select_intersect( const struct xSntpEndpoint_t * pxEndpoints, uint8_t ucCandidates, int64_t * pllLow, int64_t * pllHigh );
+/**
+ * @}
+ */
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+  * @{
+  */
+/* Exported function   ------------------------------------------------------------*/
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   discard the falsetickers of a multi-server request and combine the survivors.
+ * @param   pxTimestampCtx: Array of timestamp lists, one entry per server.
+ *          This parameter can be a value of @ref const struct xTimestampCtx_t *.
+ * @param   pxServerStatus: Array of request status, one entry per server.
+ *          This parameter can be a value of @ref const sntp_ud_t *.
+ * @param   ucCount: Number of servers, lower or equal to @ref exlibSNTP_CLIENT_MAX_SERVERS .
+ *          This parameter can be a value of @ref uint8_t.
+ * @param   pxResult: Pointer to the combined sample, the delay is the one of the closest survivor.
+ *          This parameter can be a value of @ref struct xSntpSample_t *.
+ * @param   pucSurvivors: Pointer to the survivors bit mask (bit i for server i), can be NULL.
+ *          This parameter can be a value of @ref uint8_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERROR when no majority of the servers agrees.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_select_combine( const struct xTimestampCtx_t * pxTimestampCtx, const sntp_ud_t * pxServerStatus, uint8_t ucCount,
+                                 struct xSntpSample_t * pxResult, uint8_t * pucSurvivors )
+{
+  struct xSntpSample_t   axSample[ exlibSNTP_CLIENT_MAX_SERVERS ];
+  int64_t                allLambda[ exlibSNTP_CLIENT_MAX_SERVERS ];
+  int64_t                allDistance[ exlibSNTP_CLIENT_MAX_SERVERS ];
+  uint8_t                aucServer[ exlibSNTP_CLIENT_MAX_SERVERS ];
+  struct xSntpEndpoint_t axEndpoint[ 2 * exlibSNTP_CLIENT_MAX_SERVERS ];
+  uint8_t                ucCandidates = 0;
+  uint8_t                ucIndex;
+
+  /* Make sure that the timestamp lists, the status and the result are valid */
+  if( ( NULL == pxTimestampCtx ) || ( NULL == pxServerStatus ) || ( NULL == pxResult ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  if( ucCount > exlibSNTP_CLIENT_MAX_SERVERS )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERROR;
+  }
+
+  /* Collect the candidates, only the synchronized servers which replied are used */
+  for( ucIndex = 0; ucIndex < ucCount; ucIndex++ )
+  {
+    const struct xTimestampCtx_t * p_ctx     = &pxTimestampCtx[ ucIndex ];
+    uint8_t                        ucStratum = p_ctx->server.stratum;
+
+    if( ( pxServerStatus[ ucIndex ] != SNTPEX_SUCCESS ) ||
+        ( exlibSTRATUM_IDX( ucStratum ) == 0 ) || ( exlibSTRATUM_IDX( ucStratum ) > 2 ) ||
+        ( sntpex_sample_compute( p_ctx, &axSample[ ucCandidates ] ) != SNTPEX_SUCCESS ) )
+    {
+      continue;
+    }
+
+    /* Root distance, at least 1 us so every interval has a width */
+    int64_t llLambda = ( axSample[ ucCandidates ].delay / 2 ) + ( ( int64_t )p_ctx->server.rootDelay / 2 ) +
+                       ( int64_t )p_ctx->server.rootDispersion;
+    llLambda = ( llLambda < 1 ) ? 1 : llLambda;
+
+    axEndpoint[ 2 * ucCandidates ].value      = axSample[ ucCandidates ].offset - llLambda;
+    axEndpoint[ 2 * ucCandidates ].isHigh     = 0;
+    axEndpoint[ 2 * ucCandidates + 1 ].value  = axSample[ ucCandidates ].offset + llLambda;
+    axEndpoint[ 2 * ucCandidates + 1 ].isHigh = 1;
+
+    /* The stratum only weights the combining, it does not widen the correctness interval */
+    allLambda[ ucCandidates ]   = llLambda;
+    allDistance[ ucCandidates ] = llLambda + ( ( int64_t )ucStratum * exlibSNTP_SELECT_STRATUM_DISTANCE );
+    aucServer[ ucCandidates ]   = ucIndex;
+    ucCandidates++;
+  }
+
+  if( ucCandidates == 0 )
+  {
+    /* No server replied, return the error status. */
+    return SNTPEX_ERROR;
+  }
+
+  prv_select_sort( axEndpoint, ( uint8_t )( 2 * ucCandidates ) );
+
+  int64_t llLow  = 0;
+  int64_t llHigh = 0;
+
+  if( 0 == prv_select_intersect( axEndpoint, ucCandidates, &llLow, &llHigh ) )
+  {
+    /* No majority clique, return the error status. */
+    return SNTPEX_ERROR;
+  }
+
+  /* The truechimers are the candidates whose interval overlaps the intersection */
+  uint8_t  ucBest      = 0xFF;
+  uint8_t  ucMask      = 0;
+  uint64_t ullEpoch    = 0;
+  int64_t  llWeightSum = 0;
+  int64_t  llOffsetSum = 0;
+
+  for( ucIndex = 0; ucIndex < ucCandidates; ucIndex++ )
+  {
+    if( ( ( axSample[ ucIndex ].offset - allLambda[ ucIndex ] ) > llHigh ) || ( ( axSample[ ucIndex ].offset + allLambda[ ucIndex ] ) < llLow ) )
+    {
+      /* Falseticker */
+      continue;
+    }
+
+    ucMask |= ( uint8_t )( 1u << aucServer[ ucIndex ] );
+
+    if( ( ucBest == 0xFF ) || ( allDistance[ ucIndex ] < allDistance[ ucBest ] ) )
+    {
+      ucBest = ucIndex;
+    }
+
+    ullEpoch = ( axSample[ ucIndex ].epoch > ullEpoch ) ? axSample[ ucIndex ].epoch : ullEpoch;
+  }
+
+  /** @remark The offsets are weighted relative to the closest survivor, the differences stay within the
+   *  intersection width, so the 64-bit weighted sums cannot overflow */
+  for( ucIndex = 0; ucIndex < ucCandidates; ucIndex++ )
+  {
+    if( 0u != ( ucMask & ( 1u << aucServer[ ucIndex ] ) ) )
+    {
+      int64_t llWeight = ( int64_t )( 1u << 24 ) / allDistance[ ucIndex ];
+      llWeight = ( llWeight < 1 ) ? 1 : llWeight;
+
+      llWeightSum += llWeight;
+      llOffsetSum += llWeight * ( axSample[ ucIndex ].offset - axSample[ ucBest ].offset );
+    }
+  }
+
+  pxResult->offset = axSample[ ucBest ].offset + ( llOffsetSum / llWeightSum );
+  pxResult->delay  = axSample[ ucBest ].delay;
+  pxResult->epoch  = ullEpoch;
+
+  if( NULL != pucSurvivors )
+  {
+    *pucSurvivors = ucMask;
+  }
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+/** @} */
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+  * @{
+  */
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Sort the interval endpoints by value, the lower endpoints first on equal values.
+ * @param   pxEndpoints: Array of endpoints.
+ *          This parameter can be a value of @ref struct xSntpEndpoint_t *.
+ * @param   ucCount: Number of endpoints.
+ *          This parameter can be a value of @ref uint8_t.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_select_sort( struct xSntpEndpoint_t * pxEndpoints, uint8_t ucCount )
+{
+  uint8_t ucIndex;
+
+  for( ucIndex = 1; ucIndex < ucCount; ucIndex++ )
+  {
+    struct xSntpEndpoint_t xKey  = pxEndpoints[ ucIndex ];
+    uint8_t                ucPos = ucIndex;
+
+    while( ( ucPos > 0 ) &&
+           ( ( pxEndpoints[ ucPos - 1 ].value > xKey.value ) ||
+             ( ( pxEndpoints[ ucPos - 1 ].value == xKey.value ) && ( pxEndpoints[ ucPos - 1 ].isHigh > xKey.isHigh ) ) ) )
+    {
+      pxEndpoints[ ucPos ] = pxEndpoints[ ucPos - 1 ];
+      ucPos--;
+    }
+
+    pxEndpoints[ ucPos ] = xKey;
+  }
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Find the intersection interval of the truechimers, allowing the fewest falsetickers.
+ * @param   pxEndpoints: Array of the sorted endpoints, two per candidate.
+ *          This parameter can be a value of @ref const struct xSntpEndpoint_t *.
+ * @param   ucCandidates: Number of candidates.
+ *          This parameter can be a value of @ref uint8_t.
+ * @param   pllLow: Pointer to the lower bound of the intersection.
+ *          This parameter can be a value of @ref int64_t *.
+ * @param   pllHigh: Pointer to the upper bound of the intersection.
+ *          This parameter can be a value of @ref int64_t *.
+ * @retval  1 when a majority of the candidates intersects, 0 otherwise.
+ */
+#pragma optimize=speed
+__STATIC_INLINE uint8_t prv_select_intersect( const struct xSntpEndpoint_t * pxEndpoints, uint8_t ucCandidates, int64_t * pllLow, int64_t * pllHigh )
+{
+  uint8_t ucFalsetickers;
+
+  /** @remark RFC 5905 section 11.2.1 : the number of allowed falsetickers f is increased until
+   *  n - f intervals intersect, while the truechimers stay a majority ( 2f < n ) */
+  for( ucFalsetickers = 0; ( 2 * ucFalsetickers ) < ucCandidates; ucFalsetickers++ )
+  {
+    uint8_t ucRequired = ( uint8_t )( ucCandidates - ucFalsetickers );
+    int8_t  cChime     = 0;
+    int8_t  cIndex;
+    uint8_t ucFound    = 0;
+
+    /* Lowest point covered by n - f intervals */
+    for( cIndex = 0; cIndex < ( int8_t )( 2 * ucCandidates ); cIndex++ )
+    {
+      cChime += ( pxEndpoints[ cIndex ].isHigh != 0 ) ? -1 : 1;
+
+      if( cChime >= ( int8_t )ucRequired )
+      {
+        *pllLow = pxEndpoints[ cIndex ].value;
+        ucFound = 1;
+        break;
+      }
+    }
+
+    /* Highest point covered by n - f intervals */
+    cChime = 0;
+
+    for( cIndex = ( int8_t )( 2 * ucCandidates - 1 ); ( cIndex >= 0 ) && ( ucFound != 0 ); cIndex-- )
+    {
+      cChime += ( pxEndpoints[ cIndex ].isHigh != 0 ) ? 1 : -1;
+
+      if( cChime >= ( int8_t )ucRequired )
+      {
+        *pllHigh = pxEndpoints[ cIndex ].value;
+        ucFound  = 2;
+        break;
+      }
+    }
+
+    if( ( ucFound == 2 ) && ( *pllLow <= *pllHigh ) )
+    {
+      return 1;
+    }
+  }
+
+  return 0;
+}
+/** @} */
+
+#endif /* exlibSNTP_CONFIG_MULTI_SERVER */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
@@ -0,0 +1,174 @@
+/**
+ * @file    sntpex_ti/sntp_ex_stats.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Statistics block of the Extended SNTP library, hot-path counters and latency histograms.
+ *
+ * @note    The histograms use log2 buckets, the bucket of a value is its number of significant bits (one
+ *          count leading zeros instruction). No division nor search is done on the hot path, so the block
+ *          can be kept enabled on the field devices and exported with the telemetry.
+ *
+ * @details The block is only updated by the task running the client, the Spawn event latency is measured
+ *          when the event is consumed. A copy taken from the same task is consistent.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Jan 23, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntp_ex_lib_ti.h"
+
+#if ( exlibSNTP_CONFIG_STATS == 1 )
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+  * @{
+  */
+/* Exported function   ------------------------------------------------------------*/
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get a copy of the statistics block of the client, optionally cleared once copied.
+ *          Must be called from the task running the client.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @param   pxStats: Pointer to the statistics copy.
+ *          This parameter can be a value of @ref struct xSntpStats_t *.
+ * @param   ucReset: Clear the statistics block once copied, when different from 0.
+ *          This parameter can be a value of @ref uint8_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_stats_get( sntpex_client_handle_t *p_client, struct xSntpStats_t * pxStats, uint8_t ucReset )
+{
+  /* Make sure that the SNTP client context and the statistics copy are valid */
+  if( ( NULL == p_client ) || ( NULL == pxStats ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  *pxStats = p_client->xStats;
+
+  /* Read and clear, the next copy only holds the new values */
+  if( ucReset != 0u )
+  {
+    ( void )sntpex_stats_reset( &p_client->xStats );
+  }
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   clear the statistics block of the client.
+ * @param   p_client: Pointer to the sntp client handle
+ *          This parameter can be a value of @ref sntpex_client_handle_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_client_stats_reset( sntpex_client_handle_t *p_client )
+{
+  /* Make sure that the SNTP client context is valid */
+  if( NULL == p_client )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Return the error status. */
+  return sntpex_stats_reset( &p_client->xStats );
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   clear a statistics block.
+ * @param   pxStats: Pointer to the statistics block.
+ *          This parameter can be a value of @ref struct xSntpStats_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_stats_reset( struct xSntpStats_t * pxStats )
+{
+  /* Make sure that the statistics block is valid */
+  if( NULL == pxStats )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  ( void )memset( pxStats, 0, sizeof( struct xSntpStats_t ) );
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   add a value to a histogram, the bucket is given by the number of significant bits of the value.
+ * @param   pxHistogram: Pointer to the histogram.
+ *          This parameter can be a value of @ref struct xSntpHistogram_t *.
+ * @param   ulValue: Value to add.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  None.
+ */
+#pragma optimize=speed
+void sntpex_stats_histogram_add( struct xSntpHistogram_t * pxHistogram, uint32_t ulValue )
+{
+  uint32_t ulBucket;
+
+  /* Make sure that the histogram is valid */
+  if( NULL == pxHistogram )
+  {
+    return;
+  }
+
+  /** @remark 0 goes to the bucket 0, [ 2^(i-1), 2^i ) to the bucket i, CLZ returns 32 for 0 */
+  ulBucket = 32u - ( uint32_t )__CLZ( ulValue );
+
+  if( ulBucket >= exlibSNTP_STATS_BUCKETS )
+  {
+    /* Greater values are counted by the last bucket */
+    ulBucket = exlibSNTP_STATS_BUCKETS - 1u;
+  }
+
+  pxHistogram->bucket[ ulBucket ]++;
+  pxHistogram->count++;
+  pxHistogram->sum += ulValue;
+
+  if( ulValue > pxHistogram->max )
+  {
+    pxHistogram->max = ulValue;
+  }
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   count the status of a completed request, an unknown code is counted as SNTPEX_ERROR.
+ * @param   pxStats: Pointer to the statistics block.
+ *          This parameter can be a value of @ref struct xSntpStats_t *.
+ * @param   xStatus: Status of the request.
+ *          This parameter can be a value of @ref sntp_ud_t.
+ * @retval  None.
+ */
+#pragma optimize=speed
+void sntpex_stats_status_add( struct xSntpStats_t * pxStats, sntp_ud_t xStatus )
+{
+  /* Make sure that the statistics block is valid */
+  if( NULL == pxStats )
+  {
+    return;
+  }
+
+  pxStats->status[ ( ( uint32_t )xStatus < exlibSNTP_STATS_STATUS_COUNT ) ? ( uint32_t )xStatus : ( uint32_t )SNTPEX_ERROR ]++;
+}
+/** @} */
+
+#endif /* exlibSNTP_CONFIG_STATS */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
@@ -0,0 +1,304 @@
+/**
+ * @file    sntpex_ti/sntp_ex_timer.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Timer wheel of the Extended SNTP library, deadlines of the in-flight requests of many clients.
+ *
+ * @note    The 32-bit os tick in ms wraps every 49.7 days, the deadlines are kept on a 64-bit extension of
+ *          the tick, so they are ordered across the wrap and compared without any modular arithmetic.
+ *
+ * @details The wheel is a hashed timing wheel : a timer is linked on the slot of its deadline, arming and
+ *          disarming are O(1), and the expiry only visits the slots elapsed since the previous call. One
+ *          task running dozens of step mode clients pays O(1) per expired request, instead of polling the
+ *          timeout of every client.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Jan 24, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntp_ex_lib_ti.h"
+
+#if ( exlibSNTP_CONFIG_TIMER_WHEEL == 1 )
+
+/* Private define ----------------------------------------------------------------*/
+#define exlibSNTP_WHEEL_SLOT_WIDTH    ( ( uint64_t )1 << exlibSNTP_WHEEL_SLOT_SHIFT )
+#define exlibSNTP_WHEEL_SPAN          ( ( uint64_t )exlibSNTP_WHEEL_SLOTS << exlibSNTP_WHEEL_SLOT_SHIFT )
+#define exlibSNTP_WHEEL_SLOT_INDEX(t) ( ( uint32_t )( ( t ) >> exlibSNTP_WHEEL_SLOT_SHIFT ) & ( exlibSNTP_WHEEL_SLOTS - 1u ) )
+#define exlibSNTP_WHEEL_SLOT_START(t) ( ( ( t ) >> exlibSNTP_WHEEL_SLOT_SHIFT ) << exlibSNTP_WHEEL_SLOT_SHIFT )
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+  * @{
+  */
+/* Exported function   ------------------------------------------------------------*/
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   extend a 32-bit os tick to 64 bits, a lower tick than the previous one is a wrap.
+ *          Must be called at least once per wrap of the 32-bit tick.
+ * @param   pxTick: Pointer to the tick extension.
+ *          This parameter can be a value of @ref struct xSntpTick64_t *.
+ * @param   ulTick: Operating system tick in ms.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  64-bit tick in ms, 0 when the tick extension is not valid.
+ */
+#pragma optimize=speed
+uint64_t sntpex_tick64_update( struct xSntpTick64_t * pxTick, uint32_t ulTick )
+{
+  /* Make sure that the tick extension is valid */
+  if( NULL == pxTick )
+  {
+    return 0;
+  }
+
+  if( ulTick < pxTick->last )
+  {
+    /* The 32-bit tick wrapped since the previous call */
+    pxTick->high++;
+  }
+  else
+  {
+    /* Do Nothing : MISRA 15.7 */
+  }
+
+  pxTick->last = ulTick;
+
+  return ( ( uint64_t )pxTick->high << 32 ) | ( uint64_t )ulTick;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   clear the timer wheel, no timer is armed.
+ * @param   pxWheel: Pointer to the timer wheel.
+ *          This parameter can be a value of @ref struct xSntpTimerWheel_t *.
+ * @param   ulTick: Operating system tick in ms, origin of the tick extension.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_timer_wheel_init( struct xSntpTimerWheel_t * pxWheel, uint32_t ulTick )
+{
+  /* Make sure that the timer wheel is valid */
+  if( NULL == pxWheel )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  ( void )memset( pxWheel, 0, sizeof( struct xSntpTimerWheel_t ) );
+
+  pxWheel->xTick.last = ulTick;
+  pxWheel->current    = exlibSNTP_WHEEL_SLOT_START( ( uint64_t )ulTick );
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   arm a timer, an armed timer is moved to its new deadline.
+ * @param   pxWheel: Pointer to the timer wheel.
+ *          This parameter can be a value of @ref struct xSntpTimerWheel_t *.
+ * @param   pxTimer: Pointer to the timer, its owner is kept.
+ *          This parameter can be a value of @ref struct xSntpTimer_t *.
+ * @param   ullDeadline: 64-bit tick of the expiry in ms, see @ref sntpex_tick64_update.
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_timer_arm( struct xSntpTimerWheel_t * pxWheel, struct xSntpTimer_t * pxTimer, uint64_t ullDeadline )
+{
+  uint32_t ulSlot;
+
+  /* Make sure that the timer wheel and the timer are valid */
+  if( ( NULL == pxWheel ) || ( NULL == pxTimer ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  sntpex_timer_disarm( pxWheel, pxTimer );
+
+  /** @remark A deadline already elapsed is linked on the next visited slot, instead of the slot of its
+   *  deadline which would only be visited on the next revolution */
+  ulSlot = exlibSNTP_WHEEL_SLOT_INDEX( ( ullDeadline > pxWheel->current ) ? ullDeadline : pxWheel->current );
+
+  pxTimer->deadline = ullDeadline;
+  pxTimer->slot     = ( uint16_t )ulSlot;
+  pxTimer->pxPrev   = NULL;
+  pxTimer->pxNext   = pxWheel->apxSlot[ ulSlot ];
+
+  if( NULL != pxTimer->pxNext )
+  {
+    pxTimer->pxNext->pxPrev = pxTimer;
+  }
+  else
+  {
+    /* First timer of the slot, Do Nothing : MISRA 15.7 */
+  }
+
+  pxWheel->apxSlot[ ulSlot ] = pxTimer;
+  pxTimer->armed             = 1u;
+  pxWheel->armedCount++;
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   disarm a timer, nothing is done when the timer is not armed.
+ * @param   pxWheel: Pointer to the timer wheel.
+ *          This parameter can be a value of @ref struct xSntpTimerWheel_t *.
+ * @param   pxTimer: Pointer to the timer.
+ *          This parameter can be a value of @ref struct xSntpTimer_t *.
+ * @retval  None.
+ */
+#pragma optimize=speed
+void sntpex_timer_disarm( struct xSntpTimerWheel_t * pxWheel, struct xSntpTimer_t * pxTimer )
+{
+  /* Make sure that the timer wheel and the timer are valid, and the timer is armed */
+  if( ( NULL == pxWheel ) || ( NULL == pxTimer ) || ( pxTimer->armed == 0u ) )
+  {
+    return;
+  }
+
+  if( NULL != pxTimer->pxPrev )
+  {
+    pxTimer->pxPrev->pxNext = pxTimer->pxNext;
+  }
+  else
+  {
+    /* First timer of its slot */
+    pxWheel->apxSlot[ pxTimer->slot ] = pxTimer->pxNext;
+  }
+
+  if( NULL != pxTimer->pxNext )
+  {
+    pxTimer->pxNext->pxPrev = pxTimer->pxPrev;
+  }
+  else
+  {
+    /* Last timer of the slot, Do Nothing : MISRA 15.7 */
+  }
+
+  pxTimer->pxNext = NULL;
+  pxTimer->pxPrev = NULL;
+  pxTimer->armed  = 0u;
+  pxWheel->armedCount--;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   take one expired timer, the timer is disarmed. Call again until NULL is returned.
+ * @param   pxWheel: Pointer to the timer wheel.
+ *          This parameter can be a value of @ref struct xSntpTimerWheel_t *.
+ * @param   ullNow: Current 64-bit tick in ms, see @ref sntpex_tick64_update.
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  Pointer to the expired timer, NULL when no deadline is elapsed.
+ */
+#pragma optimize=speed
+struct xSntpTimer_t * sntpex_timer_expire( struct xSntpTimerWheel_t * pxWheel, uint64_t ullNow )
+{
+  struct xSntpTimer_t * pxTimer;
+
+  /* Make sure that the timer wheel is valid */
+  if( NULL == pxWheel )
+  {
+    return NULL;
+  }
+
+  while( ( pxWheel->armedCount > 0u ) && ( pxWheel->current <= ullNow ) )
+  {
+    /* The timers of a later revolution stay on the slot */
+    for( pxTimer = pxWheel->apxSlot[ exlibSNTP_WHEEL_SLOT_INDEX( pxWheel->current ) ]; NULL != pxTimer; pxTimer = pxTimer->pxNext )
+    {
+      if( pxTimer->deadline <= ullNow )
+      {
+        sntpex_timer_disarm( pxWheel, pxTimer );
+
+        return pxTimer;
+      }
+    }
+
+    /* The slot of the current tick is visited again by the next call */
+    if( ( ullNow - pxWheel->current ) < exlibSNTP_WHEEL_SLOT_WIDTH )
+    {
+      return NULL;
+    }
+
+    pxWheel->current += exlibSNTP_WHEEL_SLOT_WIDTH;
+
+    /** @remark After more than one revolution, every slot is visited once : the skipped revolutions
+     *  hash to the same slots */
+    if( ( ullNow - pxWheel->current ) >= exlibSNTP_WHEEL_SPAN )
+    {
+      pxWheel->current = exlibSNTP_WHEEL_SLOT_START( ullNow ) - ( exlibSNTP_WHEEL_SPAN - exlibSNTP_WHEEL_SLOT_WIDTH );
+    }
+    else
+    {
+      /* Do Nothing : MISRA 15.7 */
+    }
+  }
+
+  if( pxWheel->armedCount == 0u )
+  {
+    /* Empty wheel, the next visit starts from the current slot */
+    pxWheel->current = exlibSNTP_WHEEL_SLOT_START( ullNow );
+  }
+  else
+  {
+    /* Do Nothing : MISRA 15.7 */
+  }
+
+  return NULL;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   get the time until the nearest deadline, used as the wait of the task running the wheel.
+ * @param   pxWheel: Pointer to the timer wheel.
+ *          This parameter can be a value of @ref const struct xSntpTimerWheel_t *.
+ * @param   ullNow: Current 64-bit tick in ms, see @ref sntpex_tick64_update.
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  time in ms until the nearest deadline, 0 when it is elapsed, 0xFFFFFFFF when no timer is armed.
+ */
+#pragma optimize=speed
+uint32_t sntpex_timer_wait_get( const struct xSntpTimerWheel_t * pxWheel, uint64_t ullNow )
+{
+  const struct xSntpTimer_t * pxTimer;
+  uint64_t                    ullNearest = ( uint64_t )( -1 );
+  uint32_t                    ulSlot;
+
+  /* Make sure that the timer wheel is valid and a timer is armed */
+  if( ( NULL == pxWheel ) || ( pxWheel->armedCount == 0u ) )
+  {
+    return 0xFFFFFFFFu;
+  }
+
+  /* Not on the hot path, every armed timer is compared */
+  for( ulSlot = 0; ulSlot < exlibSNTP_WHEEL_SLOTS; ulSlot++ )
+  {
+    for( pxTimer = pxWheel->apxSlot[ ulSlot ]; NULL != pxTimer; pxTimer = pxTimer->pxNext )
+    {
+      ullNearest = ( pxTimer->deadline < ullNearest ) ? pxTimer->deadline : ullNearest;
+    }
+  }
+
+  if( ullNearest <= ullNow )
+  {
+    return 0;
+  }
+
+  return ( ( ullNearest - ullNow ) < 0xFFFFFFFFu ) ? ( uint32_t )( ullNearest - ullNow ) : 0xFFFFFFFEu;
+}
+/** @} */
+
+#endif /* exlibSNTP_CONFIG_TIMER_WHEEL */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
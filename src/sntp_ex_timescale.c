@@ -0,0 +1,659 @@
+/**
+ * @file    sntpex_ti/sntp_ex_timescale.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Timescales of the Extended SNTP library, leap seconds table and UTC/TAI/GPS conversions.
+ *
+ * @note    NTP carries UTC, TAI - UTC changes by one second on every leap (IERS Bulletin C). The built-in
+ *          table holds the leaps up to 2017-01-01 (TAI - UTC = 37 s), the next ones are added by the
+ *          application or announced by the Leap Indicator of the replies (RFC 5905 section 7.3).
+ *
+ * @details The disciplined clock runs continuously on the scale of the entry in force, a passed leap is
+ *          folded into the clock by the client on its next sample. Until then the UTC time is corrected on
+ *          the read, stepped on the leap instant or smeared before it, and the TAI and GPS times are
+ *          continuous. Every conversion of the clock is O(1), without any table walk.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Jan 25, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntp_ex_lib_ti.h"
+
+#if ( exlibSNTP_CONFIG_TIMESCALE == 1 )
+
+/* Private define ----------------------------------------------------------------*/
+#define exlibSNTP_TIMESCALE_US        1000000u
+/* GPS epoch 1980-01-06 00:00:00 UTC as UNIX seconds, TAI - GPS is 19 s */
+#define exlibSNTP_GPS_EPOCH_UNIX      315964800u
+#define exlibSNTP_GPS_TAI_OFFSET      19u
+/* GPS epoch on the TAI scale of @ref SNTPEX_TIMESCALE_TAI , in us */
+#define exlibSNTP_GPS_EPOCH_TAI_US    ( ( uint64_t )( exlibSNTP_GPS_EPOCH_UNIX + exlibSNTP_GPS_TAI_OFFSET ) * exlibSNTP_TIMESCALE_US )
+#define exlibSNTP_SECONDS_PER_DAY     86400u
+
+/* Private variables -------------------------------------------------------------*/
+/**
+ * @brief   Built-in leap seconds table.
+ * @details TAI - UTC from 1972-01-01, IERS Bulletin C 72. */
+static const struct xSntpLeapEntry_t xg_leap_table[] =
+{
+  {   63072000u, 10 }, {   78796800u, 11 }, {   94694400u, 12 }, {  126230400u, 13 },
+  {  157766400u, 14 }, {  189302400u, 15 }, {  220924800u, 16 }, {  252460800u, 17 },
+  {  283996800u, 18 }, {  315532800u, 19 }, {  362793600u, 20 }, {  394329600u, 21 },
+  {  425865600u, 22 }, {  489024000u, 23 }, {  567993600u, 24 }, {  631152000u, 25 },
+  {  662688000u, 26 }, {  709948800u, 27 }, {  741484800u, 28 }, {  773020800u, 29 },
+  {  820454400u, 30 }, {  867715200u, 31 }, {  915148800u, 32 }, { 1136073600u, 33 },
+  { 1230768000u, 34 }, { 1341100800u, 35 }, { 1435708800u, 36 }, { 1483228800u, 37 },
+};
+
+/* Private function   ------------------------------------------------------------*/
+/**
+ * @defgroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief Timescale utility APIs
+ *        Private functions used by @ref sntp_ex_timescale.c .
+ *       + @ref prv_timescale_next_set
+ *       + @ref prv_timescale_utc_index
+ *       + @ref prv_timescale_tai_index
+ *       + @ref prv_timescale_month_next
+ * @{
+ */
+/**
+ * @brief Cache the next leap of the entry in force */
+__STATIC_INLINE void     prv_timescale_next_set ( struct xSntpTimescale_t * pxTimescale );
+/**
+ * @brief Entry in force at a UTC or a TAI time, the entry of the clock is tried first */
+__STATIC_INLINE uint8_t  prv_timescale_utc_index( const struct xSntpTimescale_t * pxTimescale, uint64_t ullUtc );
+__STATIC_INLINE uint8_t  prv_timescale_tai_index( const struct xSntpTimescale_t * pxTimescale, uint64_t ullTai );
+/**
+ * @brief First second of the UTC month following the given UNIX second */
+__STATIC_INLINE uint32_t prv_timescale_month_next( uint32_t ulSeconds );
+/**
+ * @}
+ */
+
+/** @addtogroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+  * @{
+  */
+/* Exported function   ------------------------------------------------------------*/
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   load the built-in leap seconds table, the clock is on the scale of its last entry.
+ * @param   pxTimescale: Pointer to the timescale.
+ *          This parameter can be a value of @ref struct xSntpTimescale_t *.
+ * @param   ucMode: Leap second handling of the UTC time.
+ *          This parameter can be a value of @ref sntpex_leap_mode_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_timescale_init( struct xSntpTimescale_t * pxTimescale, uint8_t ucMode )
+{
+  uint8_t ucCount = ( uint8_t )( sizeof( xg_leap_table ) / sizeof( xg_leap_table[ 0 ] ) );
+
+  /* Make sure that the timescale is valid */
+  if( NULL == pxTimescale )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  if( ucMode > ( uint8_t )SNTPEX_LEAP_SMEAR )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERROR;
+  }
+
+  /* A smaller table keeps the most recent leaps */
+  ucCount = ( ucCount > exlibSNTP_LEAP_TABLE_SIZE ) ? exlibSNTP_LEAP_TABLE_SIZE : ucCount;
+
+  ( void )memset( pxTimescale, 0, sizeof( struct xSntpTimescale_t ) );
+  ( void )memcpy( pxTimescale->entry, &xg_leap_table[ ( sizeof( xg_leap_table ) / sizeof( xg_leap_table[ 0 ] ) ) - ucCount ],
+                  ucCount * sizeof( struct xSntpLeapEntry_t ) );
+
+  pxTimescale->count = ucCount;
+  pxTimescale->index = ( uint8_t )( ucCount - 1u );
+  pxTimescale->mode  = ucMode;
+
+  prv_timescale_next_set( pxTimescale );
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   add or confirm an entry of the leap seconds table (e.g. from the IERS leap-seconds.list).
+ *          TAI - UTC must change by one second from the previous entry, and to the next one.
+ * @param   pxTimescale: Pointer to the timescale.
+ *          This parameter can be a value of @ref struct xSntpTimescale_t *.
+ * @param   ulUtc: UNIX seconds from which the offset applies, first second after the leap.
+ *          This parameter can be a value of @ref uint32_t.
+ * @param   sTaiOffset: TAI - UTC from that second, in s.
+ *          This parameter can be a value of @ref int16_t.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERROR when the entry is not consistent or the table is full.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_timescale_leap_add( struct xSntpTimescale_t * pxTimescale, uint32_t ulUtc, int16_t sTaiOffset )
+{
+  uint8_t ucIndex;
+
+  /* Make sure that the timescale is valid */
+  if( NULL == pxTimescale )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* Position of the entry, the first entry is the origin of the table */
+  for( ucIndex = 0; ( ucIndex < pxTimescale->count ) && ( pxTimescale->entry[ ucIndex ].utc < ulUtc ); ucIndex++ )
+  {
+    /* Do Nothing : MISRA 15.7 */
+  }
+
+  if( ( ucIndex == 0u ) ||
+      ( ( sTaiOffset - pxTimescale->entry[ ucIndex - 1u ].taiOffset ) * ( sTaiOffset - pxTimescale->entry[ ucIndex - 1u ].taiOffset ) != 1 ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERROR;
+  }
+
+  if( ( ucIndex < pxTimescale->count ) && ( pxTimescale->entry[ ucIndex ].utc == ulUtc ) )
+  {
+    /* Known leap, the announced one is confirmed */
+    if( ( ( ucIndex + 1u ) < pxTimescale->count ) &&
+        ( ( pxTimescale->entry[ ucIndex + 1u ].taiOffset - sTaiOffset ) * ( pxTimescale->entry[ ucIndex + 1u ].taiOffset - sTaiOffset ) != 1 ) )
+    {
+      /* Return the error status. */
+      return SNTPEX_ERROR;
+    }
+
+    pxTimescale->entry[ ucIndex ].taiOffset = sTaiOffset;
+  }
+  else
+  {
+    if( ( pxTimescale->count >= exlibSNTP_LEAP_TABLE_SIZE ) ||
+        ( ( ucIndex < pxTimescale->count ) &&
+          ( ( pxTimescale->entry[ ucIndex ].taiOffset - sTaiOffset ) * ( pxTimescale->entry[ ucIndex ].taiOffset - sTaiOffset ) != 1 ) ) )
+    {
+      /* Return the error status. */
+      return SNTPEX_ERROR;
+    }
+
+    ( void )memmove( &pxTimescale->entry[ ucIndex + 1u ], &pxTimescale->entry[ ucIndex ],
+                     ( pxTimescale->count - ucIndex ) * sizeof( struct xSntpLeapEntry_t ) );
+
+    pxTimescale->entry[ ucIndex ].utc       = ulUtc;
+    pxTimescale->entry[ ucIndex ].taiOffset = sTaiOffset;
+    pxTimescale->count++;
+
+    /* A past leap keeps the clock on the same entry */
+    if( ucIndex <= pxTimescale->index )
+    {
+      pxTimescale->index++;
+    }
+    else
+    {
+      /* Do Nothing : MISRA 15.7 */
+    }
+  }
+
+  /* Only the last entry can be an announcement */
+  if( ( ucIndex + 1u ) >= pxTimescale->count )
+  {
+    pxTimescale->announced = 0;
+  }
+  else
+  {
+    /* Do Nothing : MISRA 15.7 */
+  }
+
+  prv_timescale_next_set( pxTimescale );
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   update the timescale from the Leap Indicator of a reply and the disciplined clock.
+ *          An announced leap (LI 1 or 2) takes place at the end of the current UTC month, a reply without
+ *          warning (LI 0) withdraws an announcement which is not passed yet.
+ * @param   pxTimescale: Pointer to the timescale.
+ *          This parameter can be a value of @ref struct xSntpTimescale_t *.
+ * @param   ucLi: Leap Indicator of the reply, @ref specNTP_LI_ALARM is ignored.
+ *          This parameter can be a value of @ref uint8_t.
+ * @param   ullClock: Disciplined clock, 64-UNIX time in us, a passed leap is folded first (@ref sntpex_timescale_leap_fold).
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_timescale_update( struct xSntpTimescale_t * pxTimescale, uint8_t ucLi, uint64_t ullClock )
+{
+  uint32_t ulNow = ( uint32_t )( ullClock / exlibSNTP_TIMESCALE_US );
+  uint8_t  ucLast;
+
+  /* Make sure that the timescale is valid */
+  if( ( NULL == pxTimescale ) || ( pxTimescale->count == 0u ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /** @remark The clock is set backward (first sample, restored state), the entry is searched again.
+   *  One second of margin, the folded clock repeats the second before the leap */
+  if( ( ulNow + 1u ) < pxTimescale->entry[ pxTimescale->index ].utc )
+  {
+    pxTimescale->index = prv_timescale_utc_index( pxTimescale, ullClock );
+  }
+  else
+  {
+    /* Do Nothing : MISRA 15.7 */
+  }
+
+  ucLast = ( uint8_t )( pxTimescale->count - 1u );
+
+  if( ( ucLi == specNTP_LI_LAST_MIN_61 ) || ( ucLi == specNTP_LI_LAST_MIN_59 ) )
+  {
+    uint32_t ulLeap = prv_timescale_month_next( ulNow );
+
+    /** @remark The servers keep announcing a short time after the leap, an announcement in the day
+     *  following the leap in force is not a new leap */
+    if( ( ulNow >= ( pxTimescale->entry[ pxTimescale->index ].utc + exlibSNTP_SECONDS_PER_DAY ) ) &&
+        ( pxTimescale->entry[ ucLast ].utc != ulLeap ) )
+    {
+      /* A previous announcement of another month is replaced */
+      if( ( pxTimescale->announced != 0u ) && ( ucLast > pxTimescale->index ) )
+      {
+        pxTimescale->count--;
+        ucLast--;
+      }
+      else
+      {
+        /* Do Nothing : MISRA 15.7 */
+      }
+
+      if( ( pxTimescale->entry[ ucLast ].utc < ulLeap ) && ( pxTimescale->count < exlibSNTP_LEAP_TABLE_SIZE ) )
+      {
+        pxTimescale->entry[ pxTimescale->count ].utc       = ulLeap;
+        pxTimescale->entry[ pxTimescale->count ].taiOffset = ( int16_t )( pxTimescale->entry[ ucLast ].taiOffset +
+                                                                          ( ( ucLi == specNTP_LI_LAST_MIN_61 ) ? 1 : -1 ) );
+        pxTimescale->count++;
+        pxTimescale->announced = 1u;
+      }
+      else
+      {
+        /* Do Nothing : MISRA 15.7 */
+      }
+    }
+    else
+    {
+      /* Do Nothing : MISRA 15.7 */
+    }
+  }
+  else if( ( ucLi == specNTP_LI_NO_WARNING ) && ( pxTimescale->announced != 0u ) && ( ucLast > pxTimescale->index ) )
+  {
+    /* The announced leap is withdrawn */
+    pxTimescale->count--;
+    pxTimescale->announced = 0;
+  }
+  else
+  {
+    /* Alarm, or no announcement : MISRA 15.7 */
+  }
+
+  prv_timescale_next_set( pxTimescale );
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   move the clock to the scale of the passed leaps, the returned shift must be added to the clock.
+ * @param   pxTimescale: Pointer to the timescale.
+ *          This parameter can be a value of @ref struct xSntpTimescale_t *.
+ * @param   ullClock: Disciplined clock, 64-UNIX time in us on the current scale.
+ *          This parameter can be a value of @ref uint64_t.
+ * @param   pllShift: Pointer to the clock shift in us, -10^6 per inserted second, 0 when no leap is passed.
+ *          This parameter can be a value of @ref int64_t *.
+ * @retval  SNTPEX_SUCCESS if successful, A specific error type @ref sntp_ud_t otherwise.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_timescale_leap_fold( struct xSntpTimescale_t * pxTimescale, uint64_t ullClock, int64_t * pllShift )
+{
+  /* Make sure that the timescale and the shift are valid */
+  if( ( NULL == pxTimescale ) || ( NULL == pllShift ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  *pllShift = 0;
+
+  while( ( pxTimescale->nextDelta != 0 ) && ( ullClock >= pxTimescale->nextSwitch ) )
+  {
+    int64_t llStep = ( int64_t )pxTimescale->nextDelta * ( int64_t )exlibSNTP_TIMESCALE_US;
+
+    *pllShift -= llStep;
+    ullClock   = ( uint64_t )( ( int64_t )ullClock - llStep );
+
+    pxTimescale->index++;
+
+    /* The announced leap took place */
+    if( pxTimescale->index == ( uint8_t )( pxTimescale->count - 1u ) )
+    {
+      pxTimescale->announced = 0;
+    }
+    else
+    {
+      /* Do Nothing : MISRA 15.7 */
+    }
+
+    prv_timescale_next_set( pxTimescale );
+  }
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   convert the disciplined clock to a timescale, O(1). The UTC time of a passed leap which is not
+ *          folded yet is stepped or smeared, the TAI and GPS times are continuous.
+ * @param   pxTimescale: Pointer to the timescale.
+ *          This parameter can be a value of @ref const struct xSntpTimescale_t *.
+ * @param   ullClock: Disciplined clock, 64-UNIX time in us on the current scale.
+ *          This parameter can be a value of @ref uint64_t.
+ * @param   xScale: Timescale of the result.
+ *          This parameter can be a value of @ref sntpex_timescale_t.
+ * @retval  time in us on the timescale, see @ref sntpex_timescale_t , 0 when it is not valid.
+ */
+#pragma optimize=speed
+uint64_t sntpex_timescale_from_clock( const struct xSntpTimescale_t * pxTimescale, uint64_t ullClock, sntpex_timescale_t xScale )
+{
+  uint64_t ullTai;
+
+  /* Make sure that the timescale is valid */
+  if( ( NULL == pxTimescale ) || ( pxTimescale->count == 0u ) )
+  {
+    return 0;
+  }
+
+  ullTai = ullClock + ( uint64_t )( ( int64_t )pxTimescale->entry[ pxTimescale->index ].taiOffset * ( int64_t )exlibSNTP_TIMESCALE_US );
+
+  switch( xScale )
+  {
+    case SNTPEX_TIMESCALE_TAI:
+      return ullTai;
+
+    case SNTPEX_TIMESCALE_GPS:
+      return ( ullTai > exlibSNTP_GPS_EPOCH_TAI_US ) ? ( ullTai - exlibSNTP_GPS_EPOCH_TAI_US ) : 0u;
+
+    case SNTPEX_TIMESCALE_UTC:
+    {
+      uint64_t ullCorrection = 0;
+
+      if( pxTimescale->nextDelta == 0 )
+      {
+        return ullClock;
+      }
+
+      if( ullClock >= pxTimescale->nextSwitch )
+      {
+        ullCorrection = exlibSNTP_TIMESCALE_US;
+      }
+      else if( ( pxTimescale->mode == ( uint8_t )SNTPEX_LEAP_SMEAR ) &&
+               ( ( ullClock + ( ( uint64_t )exlibSNTP_LEAP_SMEAR_WINDOW * exlibSNTP_TIMESCALE_US ) ) > pxTimescale->nextSwitch ) )
+      {
+        /** @remark Linear smear, the elapsed window time divided by the window length in s : 10^6 / exlibSNTP_LEAP_SMEAR_WINDOW
+         *  us of correction per elapsed second, the whole second on the leap instant */
+        ullCorrection = ( ullClock + ( ( uint64_t )exlibSNTP_LEAP_SMEAR_WINDOW * exlibSNTP_TIMESCALE_US ) - pxTimescale->nextSwitch ) /
+                        exlibSNTP_LEAP_SMEAR_WINDOW;
+      }
+      else
+      {
+        /* Before the leap, Do Nothing : MISRA 15.7 */
+      }
+
+      return ( pxTimescale->nextDelta > 0 ) ? ( ullClock - ullCorrection ) : ( ullClock + ullCorrection );
+    }
+
+    default:
+      return 0;
+  }
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PUBLIC_APIS
+ * @brief   convert a timestamp between two timescales, O(1) for the timestamps of the entry in force.
+ * @param   pxTimescale: Pointer to the timescale.
+ *          This parameter can be a value of @ref const struct xSntpTimescale_t *.
+ * @param   xFrom: Timescale of the timestamp.
+ *          This parameter can be a value of @ref sntpex_timescale_t.
+ * @param   xTo: Timescale of the result.
+ *          This parameter can be a value of @ref sntpex_timescale_t.
+ * @param   ullTime: Timestamp in us, see @ref sntpex_timescale_t.
+ *          This parameter can be a value of @ref uint64_t.
+ * @param   pullTime: Pointer to the converted timestamp in us.
+ *          This parameter can be a value of @ref uint64_t *.
+ * @retval  SNTPEX_SUCCESS if successful, SNTPEX_ERROR when the timestamp is before the GPS epoch.
+ */
+#pragma optimize=speed
+sntp_ud_t sntpex_timescale_convert( const struct xSntpTimescale_t * pxTimescale, sntpex_timescale_t xFrom, sntpex_timescale_t xTo,
+                                    uint64_t ullTime, uint64_t * pullTime )
+{
+  uint64_t ullTai;
+
+  /* Make sure that the timescale and the converted timestamp are valid */
+  if( ( NULL == pxTimescale ) || ( NULL == pullTime ) || ( pxTimescale->count == 0u ) )
+  {
+    /* Return the error status. */
+    return SNTPEX_ERR_NULL_PTR;
+  }
+
+  /* TAI is the pivot, it has no discontinuity */
+  switch( xFrom )
+  {
+    case SNTPEX_TIMESCALE_UTC:
+      ullTai = ullTime + ( uint64_t )( ( int64_t )pxTimescale->entry[ prv_timescale_utc_index( pxTimescale, ullTime ) ].taiOffset *
+                                       ( int64_t )exlibSNTP_TIMESCALE_US );
+      break;
+
+    case SNTPEX_TIMESCALE_TAI:
+      ullTai = ullTime;
+      break;
+
+    case SNTPEX_TIMESCALE_GPS:
+      ullTai = ullTime + exlibSNTP_GPS_EPOCH_TAI_US;
+      break;
+
+    default:
+      /* Return the error status. */
+      return SNTPEX_ERROR;
+  }
+
+  switch( xTo )
+  {
+    case SNTPEX_TIMESCALE_UTC:
+      /** @remark The TAI second of an inserted leap gives the repeated UTC second */
+      *pullTime = ullTai - ( uint64_t )( ( int64_t )pxTimescale->entry[ prv_timescale_tai_index( pxTimescale, ullTai ) ].taiOffset *
+                                         ( int64_t )exlibSNTP_TIMESCALE_US );
+      break;
+
+    case SNTPEX_TIMESCALE_TAI:
+      *pullTime = ullTai;
+      break;
+
+    case SNTPEX_TIMESCALE_GPS:
+      if( ullTai < exlibSNTP_GPS_EPOCH_TAI_US )
+      {
+        /* Return the error status. */
+        return SNTPEX_ERROR;
+      }
+
+      *pullTime = ullTai - exlibSNTP_GPS_EPOCH_TAI_US;
+      break;
+
+    default:
+      /* Return the error status. */
+      return SNTPEX_ERROR;
+  }
+
+  /* Return the error status. */
+  return SNTPEX_SUCCESS;
+}
+/** @} */
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Cache the next leap of the entry in force, as a clock time on the scale of the entry.
+ *          The clock repeats the last second of an inserted leap, and skips the last second of a deleted one.
+ * @param   pxTimescale: Pointer to the timescale.
+ *          This parameter can be a value of @ref struct xSntpTimescale_t *.
+ * @retval  None.
+ */
+#pragma optimize=speed
+__STATIC_INLINE void prv_timescale_next_set( struct xSntpTimescale_t * pxTimescale )
+{
+  uint8_t ucNext = ( uint8_t )( pxTimescale->index + 1u );
+
+  if( ucNext >= pxTimescale->count )
+  {
+    pxTimescale->nextDelta  = 0;
+    pxTimescale->nextSwitch = ( uint64_t )( -1 );
+
+    return;
+  }
+
+  pxTimescale->nextDelta  = ( int8_t )( pxTimescale->entry[ ucNext ].taiOffset - pxTimescale->entry[ pxTimescale->index ].taiOffset );
+  pxTimescale->nextSwitch = ( uint64_t )pxTimescale->entry[ ucNext ].utc * exlibSNTP_TIMESCALE_US;
+
+  /** @remark The clock of the entry in force reads the last second of the day on the true midnight of a
+   *  deleted leap */
+  if( pxTimescale->nextDelta < 0 )
+  {
+    pxTimescale->nextSwitch -= exlibSNTP_TIMESCALE_US;
+  }
+  else
+  {
+    /* Do Nothing : MISRA 15.7 */
+  }
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Entry in force at a UTC time, the entry of the clock is tried first. The first entry is used
+ *          before the origin of the table.
+ * @param   pxTimescale: Pointer to the timescale.
+ *          This parameter can be a value of @ref const struct xSntpTimescale_t *.
+ * @param   ullUtc: UTC, 64-UNIX time in us.
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  index of the entry.
+ */
+#pragma optimize=speed
+__STATIC_INLINE uint8_t prv_timescale_utc_index( const struct xSntpTimescale_t * pxTimescale, uint64_t ullUtc )
+{
+  uint8_t ucIndex = pxTimescale->index;
+
+  if( ( ullUtc >= ( ( uint64_t )pxTimescale->entry[ ucIndex ].utc * exlibSNTP_TIMESCALE_US ) ) &&
+      ( ( ( ucIndex + 1u ) >= pxTimescale->count ) || ( ullUtc < ( ( uint64_t )pxTimescale->entry[ ucIndex + 1u ].utc * exlibSNTP_TIMESCALE_US ) ) ) )
+  {
+    return ucIndex;
+  }
+
+  /* Older or newer timestamp, the table is walked from its end */
+  for( ucIndex = ( uint8_t )( pxTimescale->count - 1u ); ucIndex > 0u; ucIndex-- )
+  {
+    if( ullUtc >= ( ( uint64_t )pxTimescale->entry[ ucIndex ].utc * exlibSNTP_TIMESCALE_US ) )
+    {
+      break;
+    }
+  }
+
+  return ucIndex;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   Entry in force at a TAI time, the entry of the clock is tried first. The first entry is used
+ *          before the origin of the table.
+ * @param   pxTimescale: Pointer to the timescale.
+ *          This parameter can be a value of @ref const struct xSntpTimescale_t *.
+ * @param   ullTai: TAI, us since 1970-01-01 00:00:00 TAI.
+ *          This parameter can be a value of @ref uint64_t.
+ * @retval  index of the entry.
+ */
+#pragma optimize=speed
+__STATIC_INLINE uint8_t prv_timescale_tai_index( const struct xSntpTimescale_t * pxTimescale, uint64_t ullTai )
+{
+  uint8_t ucIndex = pxTimescale->index;
+
+  /* TAI start of an entry, the UTC start plus its offset */
+#define exlibSNTP_LEAP_TAI_START( i )  ( ( uint64_t )( ( int64_t )pxTimescale->entry[ i ].utc + pxTimescale->entry[ i ].taiOffset ) * exlibSNTP_TIMESCALE_US )
+
+  if( ( ullTai >= exlibSNTP_LEAP_TAI_START( ucIndex ) ) &&
+      ( ( ( ucIndex + 1u ) >= pxTimescale->count ) || ( ullTai < exlibSNTP_LEAP_TAI_START( ucIndex + 1u ) ) ) )
+  {
+    return ucIndex;
+  }
+
+  /* Older or newer timestamp, the table is walked from its end */
+  for( ucIndex = ( uint8_t )( pxTimescale->count - 1u ); ucIndex > 0u; ucIndex-- )
+  {
+    if( ullTai >= exlibSNTP_LEAP_TAI_START( ucIndex ) )
+    {
+      break;
+    }
+  }
+
+#undef exlibSNTP_LEAP_TAI_START
+
+  return ucIndex;
+}
+
+/**
+ * @ingroup EXTENDED_SNTP_LIBRARY_TI_STACK_PRIVATE_APIS
+ * @brief   First second of the UTC month following the given UNIX second (civil calendar from the days count).
+ * @param   ulSeconds: UNIX seconds.
+ *          This parameter can be a value of @ref uint32_t.
+ * @retval  UNIX seconds of the first day of the next month, 00:00:00.
+ */
+#pragma optimize=speed
+__STATIC_INLINE uint32_t prv_timescale_month_next( uint32_t ulSeconds )
+{
+  /** @remark Days since 0000-03-01, the leap day is the last day of the shifted year */
+  uint32_t ulDays  = ( ulSeconds / exlibSNTP_SECONDS_PER_DAY ) + 719468u;
+  uint32_t ulEra   = ulDays / 146097u;
+  uint32_t ulDoe   = ulDays - ( ulEra * 146097u );
+  uint32_t ulYoe   = ( ulDoe - ( ulDoe / 1460u ) + ( ulDoe / 36524u ) - ( ulDoe / 146096u ) ) / 365u;
+  uint32_t ulDoy   = ulDoe - ( ( 365u * ulYoe ) + ( ulYoe / 4u ) - ( ulYoe / 100u ) );
+  uint32_t ulMonth = ( ( 5u * ulDoy ) + 2u ) / 153u;   /* 0 for March */
+
+  /* First day of the next month, in the same shifted year unless the month is February */
+  ulMonth++;
+
+  if( ulMonth == 12u )
+  {
+    ulMonth = 0;
+    ulYoe++;
+  }
+  else
+  {
+    /* Do Nothing : MISRA 15.7 */
+  }
+
+  /* A shifted year of the next era adds its 400 year day */
+  ulDays = ( ulEra * 146097u ) + ( 365u * ulYoe ) + ( ulYoe / 4u ) - ( ulYoe / 100u ) + ( ulYoe / 400u ) +
+           ( ( ( 153u * ulMonth ) + 2u ) / 5u );
+
+  return ( ulDays - 719468u ) * exlibSNTP_SECONDS_PER_DAY;
+}
+
+#endif /* exlibSNTP_CONFIG_TIMESCALE */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
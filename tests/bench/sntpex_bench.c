@@ -0,0 +1,294 @@
+/**
+ * @file    sntpex_ti/tests/bench/sntpex_bench.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Host benchmark of the request modes on the simulated network, with the driver or the Spawn
+ *          receive timestamps : CPU cost of a sync, offset error against the ground truth, and virtual
+ *          time to the first sample and to a disciplined clock within 1 ms.
+ *
+ * @note    The CPU cost includes the simulated SlNetSock layer, it compares the modes, it is not the cost
+ *          on the target. The servers are 10 ms away with 1 ms of jitter and 1 % of loss, the local clock
+ *          starts 500 ms late and 30 ppm fast.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Oct 14, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdio.h>
+#include <time.h>
+#include "sntpex_mock.h"
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+#include <x86intrin.h>
+#define BENCH_CYCLES()               __rdtsc()
+#else
+#define BENCH_CYCLES()               ( 0ull )
+#endif
+
+/* Private macros ----------------------------------------------------------------*/
+#define BENCH_SYNCS                  ( 200u )
+#define BENCH_SERVERS                ( 3u )
+#define BENCH_POLL_INTERVAL          ( 64000000u )  /* us between two measured syncs.             */
+#define BENCH_CONVERGE_MAX_SYNCS     ( 64u )
+#define BENCH_SYNC_BOUND             ( 1000 )       /* us, disciplined clock error of a synced client. */
+#define BENCH_STEP_PERIOD            ( 100u )       /* us between two calls of the step API.         */
+
+/* Private types -----------------------------------------------------------------*/
+typedef enum
+{
+  BENCH_MODE_BLOCKING = 0,
+  BENCH_MODE_STEP,
+  BENCH_MODE_BURST,
+  BENCH_MODE_MULTI,
+} bench_mode_t;
+
+struct xBenchResult_t
+{
+  uint32_t     success;          /* successful syncs.                                   */
+  uint64_t     cpuNs;            /* process CPU time of the syncs, in ns.               */
+  uint64_t     cycles;           /* time stamp counter cycles of the syncs.             */
+  uint64_t     errorSum;         /* sum of the absolute offset errors, in us.           */
+  int64_t      errorMax;         /* largest absolute offset error, in us.               */
+  int64_t      firstSample;      /* virtual time to the first sample, in ms, -1 if none. */
+  int64_t      synced;           /* virtual time to a clock still within 1 ms one poll interval
+                                    after the sync, in ms, -1 if not.                    */
+};
+
+/* Private variables -------------------------------------------------------------*/
+static sntpex_client_handle_t      xg_client;
+static struct ud_op_vtable         xg_vtable;
+static struct xSntpMockServer_t *  pxg_servers[ BENCH_SERVERS ];
+
+static const char * const pcg_mode_names[] = { "blocking", "step", "burst", "multi" };
+
+/* Private function   ------------------------------------------------------------*/
+
+static uint64_t prv_bench_cpu_ns( void )
+{
+  struct timespec xNow;
+
+  ( void )clock_gettime( CLOCK_PROCESS_CPUTIME_ID, &xNow );
+
+  return ( ( uint64_t )xNow.tv_sec * 1000000000u ) + ( uint64_t )xNow.tv_nsec;
+}
+
+static void prv_bench_setup( bench_mode_t xMode, sntpex_mock_ts_mode_t xTsMode )
+{
+  sntpex_sockaddr_t xAddress;
+  uint8_t           ucCount = ( xMode == BENCH_MODE_MULTI ) ? BENCH_SERVERS : 1u;
+  uint8_t           ucIndex;
+
+  sntpex_mock_reset( 0x5EED0000u + ( uint64_t )xMode );
+  sntpex_mock_clock_set( -500000, 30000 );
+  sntpex_mock_timestamp_mode_set( xTsMode, sntpex_eventTriggingFromISR, 20u );
+  sntpex_mock_vtable_get( &xg_vtable );
+
+  ( void )memset( &xg_client, 0, sizeof( xg_client ) );
+  ( void )sntpex_clientInitialization( &xg_client, &xg_vtable );
+
+  for( ucIndex = 0; ucIndex < ucCount; ucIndex++ )
+  {
+    pxg_servers[ ucIndex ] = sntpex_mock_server_add_v4( 0x0A000001u + ucIndex );
+    pxg_servers[ ucIndex ]->latencyUs    = 10000u + ( 2000u * ucIndex );
+    pxg_servers[ ucIndex ]->jitterUs     = 1000u;
+    pxg_servers[ ucIndex ]->lossPermille = 10u;
+
+    sntpex_mock_server_sockaddr( pxg_servers[ ucIndex ], &xAddress );
+
+    if( ucIndex == 0u )
+    {
+      ( void )sntpex_client_set_server_address( &xg_client, &xAddress.sa );
+    }
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+    else
+    {
+      ( void )sntpex_client_add_server_address( &xg_client, &xAddress.sa );
+    }
+#endif
+  }
+}
+
+/* One sync of the mode, the sample of the returned timestamp lists is given in pxSample */
+static sntp_ud_t prv_bench_sync( bench_mode_t xMode, struct xSntpSample_t * pxSample, uint64_t * pullCpuNs, uint64_t * pullCycles )
+{
+  struct xTimestampCtx_t axCtx[ exlibSNTP_CLIENT_MAX_SERVERS ];
+  sntp_ud_t              xStatus = SNTPEX_ERROR;
+  uint64_t               ullCpu;
+  uint64_t               ullCycles;
+
+  if( xMode == BENCH_MODE_STEP )
+  {
+    /* Only the step calls are measured, the application runs between them */
+    *pullCpuNs  = 0;
+    *pullCycles = 0;
+
+    do
+    {
+      ullCpu    = prv_bench_cpu_ns();
+      ullCycles = BENCH_CYCLES();
+      xStatus   = sntpex_client_step( &xg_client, &axCtx[ 0 ] );
+      *pullCycles += BENCH_CYCLES() - ullCycles;
+      *pullCpuNs  += prv_bench_cpu_ns() - ullCpu;
+
+      sntpex_mock_advance( BENCH_STEP_PERIOD );
+    }
+    while( xStatus == SNTPEX_PENDING );
+  }
+  else
+  {
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+    sntp_ud_t axStatus[ exlibSNTP_CLIENT_MAX_SERVERS ];
+#endif
+
+    ullCpu    = prv_bench_cpu_ns();
+    ullCycles = BENCH_CYCLES();
+
+    if( xMode == BENCH_MODE_BLOCKING )
+    {
+      xStatus = sntpex_client_timestamp_get( &xg_client, &axCtx[ 0 ] );
+    }
+    else if( xMode == BENCH_MODE_BURST )
+    {
+      xStatus = sntpex_client_burst_timestamp_get( &xg_client, &axCtx[ 0 ], 4, 20u );
+    }
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+    else
+    {
+      xStatus = sntpex_client_multi_timestamp_get( &xg_client, axCtx, axStatus );
+    }
+#endif
+
+    *pullCycles = BENCH_CYCLES() - ullCycles;
+    *pullCpuNs  = prv_bench_cpu_ns() - ullCpu;
+
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+    if( ( xMode == BENCH_MODE_MULTI ) && ( xStatus == SNTPEX_SUCCESS ) )
+    {
+      return sntpex_select_combine( axCtx, axStatus, BENCH_SERVERS, pxSample, NULL );
+    }
+#endif
+  }
+
+  if( xStatus != SNTPEX_SUCCESS )
+  {
+    return xStatus;
+  }
+
+  return sntpex_sample_compute( &axCtx[ 0 ], pxSample );
+}
+
+static void prv_bench_run( bench_mode_t xMode, sntpex_mock_ts_mode_t xTsMode, struct xBenchResult_t * pxResult )
+{
+  struct xSntpSample_t xSample;
+  uint64_t             ullCpuNs;
+  uint64_t             ullCycles;
+  uint64_t             ullStart;
+  uint32_t             ulIndex;
+
+  ( void )memset( pxResult, 0, sizeof( struct xBenchResult_t ) );
+  pxResult->firstSample = -1;
+  pxResult->synced      = -1;
+
+  /* Cost and accuracy, one sync per poll interval */
+  prv_bench_setup( xMode, xTsMode );
+
+  for( ulIndex = 0; ulIndex < BENCH_SYNCS; ulIndex++ )
+  {
+    if( prv_bench_sync( xMode, &xSample, &ullCpuNs, &ullCycles ) == SNTPEX_SUCCESS )
+    {
+      int64_t llError = xSample.offset - sntpex_mock_true_offset( pxg_servers[ 0 ] );
+
+      llError = ( llError < 0 ) ? -llError : llError;
+
+      pxResult->success++;
+      pxResult->cpuNs    += ullCpuNs;
+      pxResult->cycles   += ullCycles;
+      pxResult->errorSum += ( uint64_t )llError;
+      pxResult->errorMax  = ( llError > pxResult->errorMax ) ? llError : pxResult->errorMax;
+    }
+
+    sntpex_mock_advance( BENCH_POLL_INTERVAL );
+  }
+
+  sntpex_client_deinitialization( &xg_client );
+
+  /* Convergence from a cold start */
+  prv_bench_setup( xMode, xTsMode );
+  ullStart = sntpex_mock_true_time();
+
+  for( ulIndex = 0; ( ulIndex < BENCH_CONVERGE_MAX_SYNCS ) && ( pxResult->synced < 0 ); ulIndex++ )
+  {
+    if( ( prv_bench_sync( xMode, &xSample, &ullCpuNs, &ullCycles ) == SNTPEX_SUCCESS ) && ( pxResult->firstSample < 0 ) )
+    {
+      pxResult->firstSample = ( int64_t )( ( sntpex_mock_true_time() - ullStart ) / 1000u );
+    }
+
+    sntpex_mock_advance( BENCH_POLL_INTERVAL );
+
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 1 )
+    uint64_t ullTime;
+
+    /* The frequency error is corrected when the clock holds until the next sync */
+    if( sntpex_client_time_get( &xg_client, &ullTime ) == SNTPEX_SUCCESS )
+    {
+      int64_t llError = ( int64_t )( ullTime - sntpex_mock_true_time() );
+
+      if( ( llError < BENCH_SYNC_BOUND ) && ( llError > -BENCH_SYNC_BOUND ) )
+      {
+        pxResult->synced = ( int64_t )( ( sntpex_mock_true_time() - ullStart - BENCH_POLL_INTERVAL ) / 1000u );
+      }
+    }
+#endif
+  }
+
+  sntpex_client_deinitialization( &xg_client );
+}
+
+/* Exported function   ------------------------------------------------------------*/
+
+int main( void )
+{
+  static const char * const pcTsNames[] = { "driver", "spawn" };
+  struct xBenchResult_t     xResult;
+  uint8_t                   ucMode;
+  uint8_t                   ucTs;
+
+  ( void )printf( "%-9s %-7s %5s %10s %10s %9s %9s %11s %10s\n", "mode", "rx ts", "syncs", "cpu ns", "cycles",
+                  "err us", "max us", "first ms", "synced ms" );
+
+  for( ucMode = BENCH_MODE_BLOCKING; ucMode <= BENCH_MODE_MULTI; ucMode++ )
+  {
+#if ( exlibSNTP_CONFIG_MULTI_SERVER != 1 )
+    if( ucMode == BENCH_MODE_MULTI )
+    {
+      continue;
+    }
+#endif
+
+    for( ucTs = SNTPEX_MOCK_TS_DRIVER; ucTs <= SNTPEX_MOCK_TS_SPAWN; ucTs++ )
+    {
+      prv_bench_run( ( bench_mode_t )ucMode, ( sntpex_mock_ts_mode_t )ucTs, &xResult );
+
+      uint32_t ulCount = ( xResult.success != 0u ) ? xResult.success : 1u;
+
+      ( void )printf( "%-9s %-7s %5u %10llu %10llu %9llu %9lld %11lld %10lld\n", pcg_mode_names[ ucMode ], pcTsNames[ ucTs ],
+                      ( unsigned )xResult.success,
+                      ( unsigned long long )( xResult.cpuNs / ulCount ),
+                      ( unsigned long long )( xResult.cycles / ulCount ),
+                      ( unsigned long long )( xResult.errorSum / ulCount ),
+                      ( long long )xResult.errorMax,
+                      ( long long )xResult.firstSample,
+                      ( long long )xResult.synced );
+    }
+  }
+
+  return 0;
+}
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
@@ -0,0 +1,41 @@
+/**
+ * @file    sntpex_ti/tests/mock/sntpex_host_port.h
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Host definitions of the CMSIS keywords and intrinsics used by the Extended SNTP library.
+ *
+ * @note    Force-included before every source of the host build (-include), the target build gets them from
+ *          the CMSIS headers of the application.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Oct 14, 2026
+ * @author  Ridha MASTOURI
+ */
+
+#ifndef SNTPEX_MOCK_HOST_PORT_H_
+#define SNTPEX_MOCK_HOST_PORT_H_
+
+#define __STATIC_INLINE  static inline
+
+/* The packed request view is never used on the host, the packet codec serialises every field */
+#define __packed
+
+/* The host threads share the memory of one process, a compiler barrier orders the accesses */
+static inline void __DMB( void )
+{
+  __asm__ volatile( "" ::: "memory" );
+}
+
+/* Count leading zeros, 32 for 0 as on the Cortex-M CLZ instruction */
+static inline unsigned int __CLZ( unsigned int ulValue )
+{
+  return ( ulValue != 0u ) ? ( unsigned int )__builtin_clz( ulValue ) : 32u;
+}
+
+#endif /* SNTPEX_MOCK_HOST_PORT_H_ */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
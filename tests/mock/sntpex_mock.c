@@ -0,0 +1,1346 @@
+/**
+ * @file    sntpex_ti/tests/mock/sntpex_mock.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Simulated network, NTP servers and local clock of the host tests and benchmarks.
+ *
+ * @note    Implements the SlNetSock and SlNetUtil APIs of the mock headers, and the virtual table APIs of the
+ *          library. Not thread safe, the whole simulation runs on the test thread.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Oct 14, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntpex_mock.h"
+
+/* Private macros ----------------------------------------------------------------*/
+#define SNTPEX_MOCK_FOREVER            ( ( uint64_t )( -1 ) )
+#define SNTPEX_MOCK_REFID_GPS          ( 0x47505300u ) /* "GPS" */
+#define SNTPEX_MOCK_ROOT_DELAY         ( 0x00000080u ) /* 16.16 s, about 2 ms  */
+#define SNTPEX_MOCK_ROOT_DISPERSION    ( 0x00000040u ) /* 16.16 s, about 1 ms  */
+#define SNTPEX_MOCK_MD5_SIZE           ( 16u )
+
+/* Private types ------------------------------------------------------------------*/
+struct xSntpMockDatagram_t
+{
+  uint64_t     deliverAt;        /* true time of the arrival on the socket.      */
+  uint64_t     rxLocal;          /* local time of the arrival.                   */
+  uint8_t      used;
+  uint8_t      arrived;
+  uint8_t      server;           /* index of the sending server.                 */
+  uint16_t     length;
+  uint8_t      data[ exlibSNTP_TIME_MESSAGE_MAX_SIZE ];
+};
+
+struct xSntpMockSocket_t
+{
+  uint8_t      used;
+  uint8_t      nonBlocking;
+  uint16_t     family;
+  uint16_t     port;             /* bound port, 0 when not bound.                */
+  uint64_t     rcvTimeoutUs;     /* 0 waits forever.                             */
+  uint64_t     lastRx;           /* local time of the last received datagram.    */
+  uint64_t     lastTx;           /* local time of the last sent datagram.        */
+  struct xSntpMockDatagram_t queue[ SNTPEX_MOCK_QUEUE_SIZE ];
+};
+
+struct xSntpMockMd5_t
+{
+  uint32_t     state[ 4 ];
+  uint64_t     length;
+  uint8_t      block[ 64 ];
+  uint8_t      used;
+};
+
+/* Private variables -------------------------------------------------------------*/
+static struct
+{
+  uint64_t                 now;          /* true time, in us.                  */
+  int64_t                  clockOffset;  /* local clock offset, in us.         */
+  int32_t                  driftPpb;     /* local clock frequency error.       */
+  uint64_t                 driftOrigin;  /* true time of the clock setting.    */
+  uint32_t                 clockEpoch;
+  uint64_t                 rng;
+  uint32_t                 busy;
+  sntpex_mock_ts_mode_t    mode;
+  pf_mockSpawnHook         pfHook;
+  uint32_t                 spawnLatency;
+  uint8_t                  serverCount;
+  struct xSntpMockServer_t server[ SNTPEX_MOCK_MAX_SERVERS ];
+  struct xSntpMockSocket_t socket[ SNTPEX_MOCK_MAX_SOCKETS ];
+  uint8_t                  nv[ SNTPEX_MOCK_NV_SIZE ];
+  uint8_t                  nvFail;
+  struct xSntpMockStats_t  stats;
+} xg_mock;
+
+/* Private function   ------------------------------------------------------------*/
+static uint64_t prv_mock_local_at( uint64_t ullTrue );
+static void     prv_mock_deliver( uint64_t ullUntil );
+static struct xSntpMockSocket_t   * prv_mock_socket( int16_t sd );
+static struct xSntpMockDatagram_t * prv_mock_ready( struct xSntpMockSocket_t * pxSocket );
+static struct xSntpMockDatagram_t * prv_mock_pending( struct xSntpMockSocket_t * pxSocket, uint64_t ullDeadline );
+static int8_t   prv_mock_server_find( const SlNetSock_Addr_t * pxAddress, SlNetSocklen_t xLength );
+static void     prv_mock_serve( struct xSntpMockSocket_t * pxSocket, uint8_t ucServer, const uint8_t * pucRequest, uint32_t ulLength );
+static struct xSntpMockDatagram_t * prv_mock_listener_slot( uint16_t usFamily );
+static void     prv_mock_header_set( uint8_t * pucPacket, const struct xSntpMockServer_t * pxServer, uint8_t ucMode, uint64_t ullReference );
+static uint32_t prv_mock_jitter( uint32_t ulJitter );
+static void     prv_mock_store32( uint8_t * pucBuffer, uint32_t ulValue );
+static uint32_t prv_mock_load32( const uint8_t * pucBuffer );
+static void     prv_mock_store_ts( uint8_t * pucBuffer, uint64_t ullTime );
+static void     prv_mock_md5_init( struct xSntpMockMd5_t * pxMd5 );
+static void     prv_mock_md5_update( struct xSntpMockMd5_t * pxMd5, const uint8_t * pucData, uint32_t ulLength );
+static void     prv_mock_md5_final( struct xSntpMockMd5_t * pxMd5, uint8_t * pucDigest );
+static void     prv_mock_md5_block( uint32_t * pulState, const uint8_t * pucBlock );
+
+/* Virtual table APIs */
+static int8_t   prv_mock_get_sntp_time( uint32_t * pulSeconds, uint32_t * pulFraction );
+static uint64_t prv_mock_get_unix_timestamp( void );
+static uint32_t prv_mock_get_os_tick( void );
+static void     prv_mock_delay_ms( uint32_t ulDelay );
+static uint64_t prv_mock_get_rx_timestamp( int sd );
+static uint64_t prv_mock_get_tx_timestamp( int sd );
+static int32_t  prv_mock_get_random( void * pvBuffer, uint16_t usLength );
+static int32_t  prv_mock_compute_mac( uint8_t ucType, const uint8_t * pucKey, uint8_t ucKeyLength,
+                                      const uint8_t * pucData, uint16_t usLength, uint8_t * pucMac, uint8_t * pucMacLength );
+static int32_t  prv_mock_nv_write( uint32_t ulOffset, const void * pvData, uint16_t usLength );
+static int32_t  prv_mock_nv_read( uint32_t ulOffset, void * pvData, uint16_t usLength );
+static uint32_t prv_mock_get_clock_epoch( void );
+
+/* Exported function   ------------------------------------------------------------*/
+
+/**
+ * @brief   Reset the simulation : no server, no socket, local clock on the true time at @ref SNTPEX_MOCK_START_TIME .
+ * @param   ullSeed: Seed of the jitter, loss and random bytes generator, the runs are reproducible.
+ * @retval  None.
+ */
+void sntpex_mock_reset( uint64_t ullSeed )
+{
+  ( void )memset( &xg_mock, 0, sizeof( xg_mock ) );
+
+  xg_mock.now         = SNTPEX_MOCK_START_TIME;
+  xg_mock.driftOrigin = SNTPEX_MOCK_START_TIME;
+  xg_mock.rng         = ullSeed ^ 0x9E3779B97F4A7C15ull;
+  xg_mock.clockEpoch  = 1;
+  xg_mock.mode        = SNTPEX_MOCK_TS_DRIVER;
+}
+
+/**
+ * @brief   Advance the true time, the replies arriving meanwhile are delivered on their socket.
+ * @param   ullMicros: Duration, in us.
+ * @retval  None.
+ */
+void sntpex_mock_advance( uint64_t ullMicros )
+{
+  prv_mock_deliver( xg_mock.now + ullMicros );
+}
+
+/**
+ * @brief   Get the true time, 64-UNIX time in us.
+ */
+uint64_t sntpex_mock_true_time( void )
+{
+  return xg_mock.now;
+}
+
+/**
+ * @brief   Get the local time read by the library, 64-UNIX time in us.
+ */
+uint64_t sntpex_mock_local_time( void )
+{
+  return prv_mock_local_at( xg_mock.now );
+}
+
+/**
+ * @brief   Set the local clock, from now it reads the true time plus the offset, plus the drift of the frequency error.
+ * @param   llOffsetUs: Local time minus the true time, in us.
+ * @param   lDriftPpb: Frequency error of the local clock, in ppb.
+ * @retval  None.
+ */
+void sntpex_mock_clock_set( int64_t llOffsetUs, int32_t lDriftPpb )
+{
+  xg_mock.clockOffset = llOffsetUs;
+  xg_mock.driftPpb    = lDriftPpb;
+  xg_mock.driftOrigin = xg_mock.now;
+}
+
+/**
+ * @brief   Set the run of the raw local clock returned by the get_clock_epoch vtable API.
+ */
+void sntpex_mock_clock_epoch_set( uint32_t ulEpoch )
+{
+  xg_mock.clockEpoch = ulEpoch;
+}
+
+/**
+ * @brief   Refuse the next send attempts with SLNETERR_BSD_EAGAIN, each attempt takes @ref SNTPEX_MOCK_POLL_STEP .
+ * @param   ulAttempts: Number of refused attempts.
+ * @retval  None.
+ */
+void sntpex_mock_busy_set( uint32_t ulAttempts )
+{
+  xg_mock.busy = ulAttempts;
+}
+
+/**
+ * @brief   Select the timestamps source of the virtual table returned by @ref sntpex_mock_vtable_get .
+ * @param   xMode: Driver timestamps, or the Spawn hook on every transmission and arrival.
+ * @param   pfHook: Spawn hook, @ref sntpex_eventTriggingFromISR , NULL disables the Spawn events.
+ * @param   ulSpawnLatencyUs: Delay between an arrival and the Spawn hook, the queue latency of the Spawn task.
+ * @retval  None.
+ */
+void sntpex_mock_timestamp_mode_set( sntpex_mock_ts_mode_t xMode, pf_mockSpawnHook pfHook, uint32_t ulSpawnLatencyUs )
+{
+  xg_mock.mode         = xMode;
+  xg_mock.pfHook       = pfHook;
+  xg_mock.spawnLatency = ulSpawnLatencyUs;
+}
+
+/**
+ * @brief   Fill the virtual table APIs with the simulated clock, storage and MD5 accelerator.
+ * @note    The driver timestamps APIs return 0 out of the @ref SNTPEX_MOCK_TS_DRIVER mode, the library falls
+ *          back to the Spawn timestamps.
+ * @param   pxVtable: Pointer to the virtual table.
+ * @retval  None.
+ */
+void sntpex_mock_vtable_get( struct ud_op_vtable * pxVtable )
+{
+  ( void )memset( pxVtable, 0, sizeof( struct ud_op_vtable ) );
+
+  pxVtable->get_sntp_time      = prv_mock_get_sntp_time;
+  pxVtable->get_unix_timestamp = prv_mock_get_unix_timestamp;
+  pxVtable->get_os_tick        = prv_mock_get_os_tick;
+  pxVtable->delay_ms           = prv_mock_delay_ms;
+  pxVtable->get_random         = prv_mock_get_random;
+  pxVtable->compute_mac        = prv_mock_compute_mac;
+  pxVtable->nv_write           = prv_mock_nv_write;
+  pxVtable->nv_read            = prv_mock_nv_read;
+  pxVtable->get_clock_epoch    = prv_mock_get_clock_epoch;
+  pxVtable->get_rx_timestamp   = prv_mock_get_rx_timestamp;
+  pxVtable->get_tx_timestamp   = prv_mock_get_tx_timestamp;
+}
+
+/**
+ * @brief   Get the counters of the simulation.
+ */
+const struct xSntpMockStats_t * sntpex_mock_stats_get( void )
+{
+  return &xg_mock.stats;
+}
+
+/**
+ * @brief   Get the next value of the simulation generator (splitmix64).
+ */
+uint32_t sntpex_mock_random( void )
+{
+  uint64_t ullValue;
+
+  xg_mock.rng += 0x9E3779B97F4A7C15ull;
+  ullValue     = xg_mock.rng;
+  ullValue     = ( ullValue ^ ( ullValue >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+  ullValue     = ( ullValue ^ ( ullValue >> 27 ) ) * 0x94D049BB133111EBull;
+
+  return ( uint32_t )( ( ullValue ^ ( ullValue >> 31 ) ) >> 16 );
+}
+
+/**
+ * @brief   Add an IPV4 server, synchronized at stratum 2 on the true time with a 5 ms one-way latency.
+ * @param   ulAddress: IPV4 address, host order.
+ * @retval  Pointer to the server configuration, NULL when the servers table is full.
+ */
+struct xSntpMockServer_t * sntpex_mock_server_add_v4( uint32_t ulAddress )
+{
+  uint8_t aucAddress[ 16 ] = { 0, };
+
+  prv_mock_store32( aucAddress, ulAddress );
+
+  struct xSntpMockServer_t * pxServer = sntpex_mock_server_add_v6( aucAddress );
+
+  if( NULL != pxServer )
+  {
+    pxServer->family = SLNETSOCK_AF_INET;
+  }
+
+  return pxServer;
+}
+
+/**
+ * @brief   Add an IPV6 server, synchronized at stratum 2 on the true time with a 5 ms one-way latency.
+ * @param   pucAddress: IPV6 address, 16 bytes in network order.
+ * @retval  Pointer to the server configuration, NULL when the servers table is full.
+ */
+struct xSntpMockServer_t * sntpex_mock_server_add_v6( const uint8_t * pucAddress )
+{
+  if( xg_mock.serverCount >= SNTPEX_MOCK_MAX_SERVERS )
+  {
+    return NULL;
+  }
+
+  struct xSntpMockServer_t * pxServer = &xg_mock.server[ xg_mock.serverCount++ ];
+
+  ( void )memset( pxServer, 0, sizeof( struct xSntpMockServer_t ) );
+  ( void )memcpy( pxServer->address, pucAddress, sizeof( pxServer->address ) );
+
+  pxServer->family       = SLNETSOCK_AF_INET6;
+  pxServer->latencyUs    = 5000;
+  pxServer->processingUs = 50;
+  pxServer->stratum      = 2;
+
+  return pxServer;
+}
+
+/**
+ * @brief   Get the socket address of a server, as configured on the client.
+ * @param   pxServer: Pointer to the server.
+ * @param   pxAddress: Pointer to the socket address, NTP port.
+ * @retval  None.
+ */
+void sntpex_mock_server_sockaddr( const struct xSntpMockServer_t * pxServer, sntpex_sockaddr_t * pxAddress )
+{
+  ( void )memset( pxAddress, 0, sizeof( sntpex_sockaddr_t ) );
+
+  if( pxServer->family == SLNETSOCK_AF_INET )
+  {
+    pxAddress->in.sin_family = SLNETSOCK_AF_INET;
+    pxAddress->in.sin_port   = SlNetUtil_htons( exlibSNTP_SERVER_PORT );
+    ( void )memcpy( &pxAddress->in.sin_addr.s_addr, pxServer->address, 4 );
+  }
+#if ( exlibSNTP_CONFIG_IPV6 == 1 )
+  else
+  {
+    pxAddress->in6.sin6_family = SLNETSOCK_AF_INET6;
+    pxAddress->in6.sin6_port   = SlNetUtil_htons( exlibSNTP_SERVER_PORT );
+    ( void )memcpy( pxAddress->in6.sin6_addr._S6_un._S6_u8, pxServer->address, 16 );
+  }
+#endif
+}
+
+/**
+ * @brief   Get the true clock offset of a server, its time minus the local time, in us.
+ */
+int64_t sntpex_mock_true_offset( const struct xSntpMockServer_t * pxServer )
+{
+  return ( ( int64_t )xg_mock.now + pxServer->offsetUs ) - ( int64_t )sntpex_mock_local_time();
+}
+
+/**
+ * @brief   Send a client request (mode 3) from a host to the socket bound to the NTP port of its family.
+ * @note    The request is signed with the key of the host, the reply of the library is kept in its answer.
+ * @param   pxPeer: Pointer to the requesting host, a server of the simulation.
+ * @retval  True time of the arrival of the request, 0 when no socket listens or its buffers are full.
+ */
+uint64_t sntpex_mock_peer_request( struct xSntpMockServer_t * pxPeer )
+{
+  struct xSntpMockDatagram_t * pxData = prv_mock_listener_slot( pxPeer->family );
+
+  if( NULL == pxData )
+  {
+    return 0;
+  }
+
+  uint64_t ullArrival = xg_mock.now + pxPeer->latencyUs + prv_mock_jitter( pxPeer->jitterUs );
+
+  prv_mock_header_set( pxData->data, pxPeer, specNTP_MODE_CLIENT, 0 );
+  prv_mock_store_ts( &pxData->data[ exlibSNTP_PKT_OFFSET_XMIT_TS ], ( uint64_t )( ( int64_t )xg_mock.now + pxPeer->offsetUs ) );
+
+  pxData->length = exlibSNTP_PACKET_HEADER_SIZE;
+
+  if( pxPeer->keyId != 0u )
+  {
+    prv_mock_store32( &pxData->data[ exlibSNTP_PACKET_HEADER_SIZE ], pxPeer->keyId );
+    sntpex_mock_md5( pxPeer->key, pxPeer->keyLength, pxData->data, exlibSNTP_PACKET_HEADER_SIZE,
+                     &pxData->data[ exlibSNTP_PACKET_HEADER_SIZE + exlibSNTP_AUTH_KEY_ID_SIZE ] );
+    pxData->length = exlibSNTP_PACKET_HEADER_SIZE + exlibSNTP_AUTH_KEY_ID_SIZE + SNTPEX_MOCK_MD5_SIZE;
+  }
+
+  pxData->used      = 1u;
+  pxData->server    = ( uint8_t )( pxPeer - xg_mock.server );
+  pxData->deliverAt = ullArrival;
+  pxPeer->requests++;
+
+  return ullArrival;
+}
+
+/**
+ * @brief   Send a broadcast packet (mode 5) of a server to the socket bound to the NTP port of its family.
+ * @param   pxServer: Pointer to the broadcasting server.
+ * @retval  True time of the arrival of the packet, 0 when no socket listens or its buffers are full.
+ */
+uint64_t sntpex_mock_broadcast_send( struct xSntpMockServer_t * pxServer )
+{
+  struct xSntpMockDatagram_t * pxData = prv_mock_listener_slot( pxServer->family );
+
+  if( NULL == pxData )
+  {
+    return 0;
+  }
+
+  uint64_t ullTransmit = ( uint64_t )( ( int64_t )xg_mock.now + pxServer->offsetUs );
+
+  prv_mock_header_set( pxData->data, pxServer, specNTP_MODE_BROADCAST, ullTransmit - 16000000u );
+  prv_mock_store_ts( &pxData->data[ exlibSNTP_PKT_OFFSET_XMIT_TS ], ullTransmit );
+
+  pxData->length    = exlibSNTP_PACKET_HEADER_SIZE;
+  pxData->used      = 1u;
+  pxData->server    = ( uint8_t )( pxServer - xg_mock.server );
+  pxData->deliverAt = xg_mock.now + pxServer->latencyUs + pxServer->asymmetryUs + prv_mock_jitter( pxServer->jitterUs );
+  pxServer->replies++;
+
+  return pxData->deliverAt;
+}
+
+/**
+ * @brief   Flip the bits of one byte of the storage.
+ */
+void sntpex_mock_nv_corrupt( uint32_t ulOffset )
+{
+  if( ulOffset < SNTPEX_MOCK_NV_SIZE )
+  {
+    xg_mock.nv[ ulOffset ] ^= 0xFFu;
+  }
+}
+
+/**
+ * @brief   Make the storage reads and writes fail, when different from 0.
+ */
+void sntpex_mock_nv_fail_set( uint8_t ucFail )
+{
+  xg_mock.nvFail = ucFail;
+}
+
+/**
+ * @brief   Compute MD5( key || data ) (RFC 1321).
+ * @param   pucKey: Pointer to the key, NULL without key.
+ * @param   ucKeyLength: Key length in bytes.
+ * @param   pucData: Pointer to the data.
+ * @param   usLength: Data length in bytes.
+ * @param   pucDigest: Pointer to the 16 bytes digest.
+ * @retval  None.
+ */
+void sntpex_mock_md5( const uint8_t * pucKey, uint8_t ucKeyLength, const uint8_t * pucData, uint16_t usLength, uint8_t * pucDigest )
+{
+  struct xSntpMockMd5_t xMd5;
+
+  prv_mock_md5_init( &xMd5 );
+
+  if( NULL != pucKey )
+  {
+    prv_mock_md5_update( &xMd5, pucKey, ucKeyLength );
+  }
+
+  prv_mock_md5_update( &xMd5, pucData, usLength );
+  prv_mock_md5_final( &xMd5, pucDigest );
+}
+
+/* SlNetSock APIs ----------------------------------------------------------------*/
+
+int16_t SlNetSock_create( int16_t domain, int16_t type, int16_t protocol, uint32_t ifBitmap, int16_t flags )
+{
+  int16_t sd;
+
+  ( void )type;
+  ( void )protocol;
+  ( void )ifBitmap;
+  ( void )flags;
+
+  for( sd = 0; sd < ( int16_t )SNTPEX_MOCK_MAX_SOCKETS; sd++ )
+  {
+    struct xSntpMockSocket_t * pxSocket = &xg_mock.socket[ sd ];
+
+    if( pxSocket->used == 0u )
+    {
+      ( void )memset( pxSocket, 0, sizeof( struct xSntpMockSocket_t ) );
+      pxSocket->used   = 1u;
+      pxSocket->family = ( uint16_t )domain;
+
+      return sd;
+    }
+  }
+
+  return SLNETERR_BSD_ENOMEM;
+}
+
+int32_t SlNetSock_close( int16_t sd )
+{
+  struct xSntpMockSocket_t * pxSocket = prv_mock_socket( sd );
+
+  if( NULL == pxSocket )
+  {
+    return SLNETERR_BSD_EBADF;
+  }
+
+  /* The queued datagrams are lost with the socket */
+  ( void )memset( pxSocket, 0, sizeof( struct xSntpMockSocket_t ) );
+
+  return SLNETERR_RET_CODE_OK;
+}
+
+int32_t SlNetSock_setOpt( int16_t sd, int16_t level, int16_t optname, void * optval, SlNetSocklen_t optlen )
+{
+  struct xSntpMockSocket_t * pxSocket = prv_mock_socket( sd );
+
+  if( ( NULL == pxSocket ) || ( NULL == optval ) )
+  {
+    return SLNETERR_BSD_EBADF;
+  }
+
+  if( ( level == SLNETSOCK_LVL_SOCKET ) && ( optname == SLNETSOCK_OPSOCK_NON_BLOCKING ) && ( optlen >= sizeof( SlNetSock_Nonblocking_t ) ) )
+  {
+    pxSocket->nonBlocking = ( ( const SlNetSock_Nonblocking_t * )optval )->nonBlockingEnabled != 0u;
+  }
+  else if( ( level == SLNETSOCK_LVL_SOCKET ) && ( optname == SLNETSOCK_OPSOCK_RCV_TIMEO ) && ( optlen >= sizeof( SlNetSock_Timeval_t ) ) )
+  {
+    const SlNetSock_Timeval_t * pxTimeout = ( const SlNetSock_Timeval_t * )optval;
+
+    pxSocket->rcvTimeoutUs = ( ( uint64_t )pxTimeout->tv_sec * 1000000u ) + ( uint64_t )pxTimeout->tv_usec;
+  }
+  else
+  {
+    /* Multicast memberships, accepted without effect */
+  }
+
+  return SLNETERR_RET_CODE_OK;
+}
+
+int32_t SlNetSock_bind( int16_t sd, const SlNetSock_Addr_t * addr, int16_t addrlen )
+{
+  struct xSntpMockSocket_t * pxSocket = prv_mock_socket( sd );
+
+  if( ( NULL == pxSocket ) || ( NULL == addr ) || ( addrlen < ( int16_t )sizeof( SlNetSock_AddrIn_t ) ) )
+  {
+    return SLNETERR_BSD_EBADF;
+  }
+
+  /* The port is at the same offset in both families */
+  pxSocket->port = SlNetUtil_ntohs( ( ( const SlNetSock_AddrIn_t * )addr )->sin_port );
+
+  return SLNETERR_RET_CODE_OK;
+}
+
+int32_t SlNetSock_sendTo( int16_t sd, const void * buf, uint32_t len, int32_t flags, const SlNetSock_Addr_t * to, SlNetSocklen_t tolen )
+{
+  struct xSntpMockSocket_t * pxSocket = prv_mock_socket( sd );
+
+  ( void )flags;
+
+  if( ( NULL == pxSocket ) || ( NULL == buf ) || ( NULL == to ) )
+  {
+    return SLNETERR_BSD_EBADF;
+  }
+
+  if( xg_mock.busy > 0u )
+  {
+    /* Busy socket, the attempt takes one poll step */
+    xg_mock.busy--;
+    xg_mock.stats.busy++;
+    prv_mock_deliver( xg_mock.now + SNTPEX_MOCK_POLL_STEP );
+
+    return SLNETERR_BSD_EAGAIN;
+  }
+
+  int8_t cServer = prv_mock_server_find( to, tolen );
+
+  xg_mock.stats.sent++;
+  pxSocket->lastTx = sntpex_mock_local_time();
+
+  if( cServer >= 0 )
+  {
+    prv_mock_serve( pxSocket, ( uint8_t )cServer, ( const uint8_t * )buf, len );
+  }
+  else
+  {
+    xg_mock.stats.unreachable++;
+  }
+
+  /* Send event of the Spawn task, while the send event is armed */
+  if( ( xg_mock.mode == SNTPEX_MOCK_TS_SPAWN ) && ( NULL != xg_mock.pfHook ) )
+  {
+    ( void )xg_mock.pfHook( sd, exlibSNTP_SOFTSR_SEND_BIT );
+  }
+
+  return ( int32_t )len;
+}
+
+int32_t SlNetSock_recvFrom( int16_t sd, void * buf, uint32_t len, int32_t flags, SlNetSock_Addr_t * from, SlNetSocklen_t * fromlen )
+{
+  struct xSntpMockSocket_t   * pxSocket = prv_mock_socket( sd );
+  struct xSntpMockDatagram_t * pxData;
+
+  ( void )flags;
+
+  if( ( NULL == pxSocket ) || ( NULL == buf ) )
+  {
+    return SLNETERR_BSD_EBADF;
+  }
+
+  pxData = prv_mock_ready( pxSocket );
+
+  if( NULL == pxData )
+  {
+    if( pxSocket->nonBlocking != 0u )
+    {
+      /* Nothing received, the attempt takes one poll step */
+      prv_mock_deliver( xg_mock.now + SNTPEX_MOCK_POLL_STEP );
+
+      return SLNETERR_BSD_EAGAIN;
+    }
+
+    /* Blocking socket, wait for the next datagram until the receive timeout */
+    uint64_t ullDeadline = ( pxSocket->rcvTimeoutUs != 0u ) ? ( xg_mock.now + pxSocket->rcvTimeoutUs ) : SNTPEX_MOCK_FOREVER;
+
+    pxData = prv_mock_pending( pxSocket, ullDeadline );
+
+    if( NULL == pxData )
+    {
+      if( ullDeadline != SNTPEX_MOCK_FOREVER )
+      {
+        prv_mock_deliver( ullDeadline );
+      }
+
+      return SLNETERR_BSD_EAGAIN;
+    }
+
+    prv_mock_deliver( pxData->deliverAt );
+  }
+
+  uint32_t ulLength = ( pxData->length < len ) ? pxData->length : len;
+
+  ( void )memcpy( buf, pxData->data, ulLength );
+
+  if( ( NULL != from ) && ( NULL != fromlen ) )
+  {
+    sntpex_sockaddr_t xSource;
+    uint16_t          usLength = ( xg_mock.server[ pxData->server ].family == SLNETSOCK_AF_INET ) ?
+                                 ( uint16_t )sizeof( SlNetSock_AddrIn_t ) : ( uint16_t )sizeof( sntpex_sockaddr_t );
+
+    sntpex_mock_server_sockaddr( &xg_mock.server[ pxData->server ], &xSource );
+
+    usLength = ( usLength < *fromlen ) ? usLength : *fromlen;
+    ( void )memcpy( from, &xSource, usLength );
+    *fromlen = usLength;
+  }
+
+  pxSocket->lastRx = pxData->rxLocal;
+  pxData->used     = 0u;
+  xg_mock.stats.delivered++;
+
+  return ( int32_t )ulLength;
+}
+
+int32_t SlNetSock_select( int16_t nsds, SlNetSock_SdSet_t * readsds, SlNetSock_SdSet_t * writesds, SlNetSock_SdSet_t * exceptsds,
+                          SlNetSock_Timeval_t * timeout )
+{
+  SlNetSock_SdSet_t xReady;
+  int32_t           lCount = 0;
+  int16_t           sd;
+
+  ( void )writesds;
+  ( void )exceptsds;
+
+  if( NULL == readsds )
+  {
+    return 0;
+  }
+
+  uint64_t ullDeadline = ( NULL != timeout ) ? ( xg_mock.now + ( ( uint64_t )timeout->tv_sec * 1000000u ) + ( uint64_t )timeout->tv_usec ) :
+                                               SNTPEX_MOCK_FOREVER;
+
+  do
+  {
+    struct xSntpMockDatagram_t * pxNext = NULL;
+
+    SlNetSock_sdsClrAll( &xReady );
+    lCount = 0;
+
+    for( sd = 0; ( sd < nsds ) && ( sd < ( int16_t )SNTPEX_MOCK_MAX_SOCKETS ); sd++ )
+    {
+      struct xSntpMockSocket_t * pxSocket = prv_mock_socket( sd );
+
+      if( ( NULL == pxSocket ) || ( 0 == SlNetSock_sdsIsSet( sd, readsds ) ) )
+      {
+        continue;
+      }
+
+      if( NULL != prv_mock_ready( pxSocket ) )
+      {
+        SlNetSock_sdsSet( sd, &xReady );
+        lCount++;
+      }
+      else
+      {
+        struct xSntpMockDatagram_t * pxPending = prv_mock_pending( pxSocket, ullDeadline );
+
+        if( ( NULL != pxPending ) && ( ( NULL == pxNext ) || ( pxPending->deliverAt < pxNext->deliverAt ) ) )
+        {
+          pxNext = pxPending;
+        }
+      }
+    }
+
+    if( ( lCount > 0 ) || ( ullDeadline <= xg_mock.now ) )
+    {
+      break;
+    }
+
+    /* Wait for the next arrival, or for the timeout */
+    if( NULL != pxNext )
+    {
+      prv_mock_deliver( pxNext->deliverAt );
+    }
+    else
+    {
+      if( ullDeadline != SNTPEX_MOCK_FOREVER )
+      {
+        prv_mock_deliver( ullDeadline );
+      }
+
+      break;
+    }
+  }
+  while( lCount == 0 );
+
+  *readsds = xReady;
+
+  return lCount;
+}
+
+void SlNetSock_sdsSet( int16_t sd, SlNetSock_SdSet_t * sdset )
+{
+  if( ( sd >= 0 ) && ( sd < 64 ) )
+  {
+    sdset->sdSetBitmap[ sd / 32 ] |= ( 1u << ( sd % 32 ) );
+  }
+}
+
+void SlNetSock_sdsClr( int16_t sd, SlNetSock_SdSet_t * sdset )
+{
+  if( ( sd >= 0 ) && ( sd < 64 ) )
+  {
+    sdset->sdSetBitmap[ sd / 32 ] &= ~( 1u << ( sd % 32 ) );
+  }
+}
+
+void SlNetSock_sdsClrAll( SlNetSock_SdSet_t * sdset )
+{
+  ( void )memset( sdset, 0, sizeof( SlNetSock_SdSet_t ) );
+}
+
+int32_t SlNetSock_sdsIsSet( int16_t sd, SlNetSock_SdSet_t * sdset )
+{
+  return ( ( sd >= 0 ) && ( sd < 64 ) ) ? ( int32_t )( ( sdset->sdSetBitmap[ sd / 32 ] >> ( sd % 32 ) ) & 1u ) : 0;
+}
+
+/* SlNetUtil APIs ----------------------------------------------------------------*/
+
+uint32_t SlNetUtil_htonl( uint32_t val )
+{
+  uint8_t  aucBytes[ 4 ];
+  uint32_t ulResult;
+
+  prv_mock_store32( aucBytes, val );
+  ( void )memcpy( &ulResult, aucBytes, sizeof( ulResult ) );
+
+  return ulResult;
+}
+
+uint32_t SlNetUtil_ntohl( uint32_t val )
+{
+  uint8_t aucBytes[ 4 ];
+
+  ( void )memcpy( aucBytes, &val, sizeof( val ) );
+
+  return prv_mock_load32( aucBytes );
+}
+
+uint16_t SlNetUtil_htons( uint16_t val )
+{
+  uint8_t  aucBytes[ 2 ] = { ( uint8_t )( val >> 8 ), ( uint8_t )val };
+  uint16_t usResult;
+
+  ( void )memcpy( &usResult, aucBytes, sizeof( usResult ) );
+
+  return usResult;
+}
+
+uint16_t SlNetUtil_ntohs( uint16_t val )
+{
+  uint8_t aucBytes[ 2 ];
+
+  ( void )memcpy( aucBytes, &val, sizeof( val ) );
+
+  return ( uint16_t )( ( ( uint16_t )aucBytes[ 0 ] << 8 ) | aucBytes[ 1 ] );
+}
+
+int32_t SlNetUtil_getHostByName( uint32_t ifBitmap, char * name, const uint16_t nameLen, uint32_t * ipAddr,
+                                 uint16_t * ipAddrLen, const uint8_t family )
+{
+  uint16_t usCount = 0;
+  uint8_t  ucIndex;
+
+  ( void )ifBitmap;
+
+  if( ( NULL == name ) || ( nameLen == 0u ) || ( NULL == ipAddr ) || ( NULL == ipAddrLen ) )
+  {
+    return SLNETERR_BSD_EINVAL;
+  }
+
+  xg_mock.stats.dns++;
+
+  /* Every name resolves to the servers of the family, in their order of addition */
+  for( ucIndex = 0; ( ucIndex < xg_mock.serverCount ) && ( usCount < *ipAddrLen ); ucIndex++ )
+  {
+    const struct xSntpMockServer_t * pxServer = &xg_mock.server[ ucIndex ];
+
+    if( pxServer->family != family )
+    {
+      continue;
+    }
+
+    if( family == SLNETSOCK_AF_INET6 )
+    {
+      uint8_t ucWord;
+
+      for( ucWord = 0; ucWord < 4u; ucWord++ )
+      {
+        ipAddr[ ( usCount * 4u ) + ucWord ] = prv_mock_load32( &pxServer->address[ ucWord * 4u ] );
+      }
+    }
+    else
+    {
+      ipAddr[ usCount ] = prv_mock_load32( pxServer->address );
+    }
+
+    usCount++;
+  }
+
+  *ipAddrLen = usCount;
+
+  return ( usCount > 0u ) ? 0 : SLNETERR_BSD_EINVAL;
+}
+
+/* Private function   ------------------------------------------------------------*/
+
+static uint64_t prv_mock_local_at( uint64_t ullTrue )
+{
+  int64_t llElapsed = ( int64_t )( ullTrue - xg_mock.driftOrigin );
+
+  return ( uint64_t )( ( int64_t )ullTrue + xg_mock.clockOffset + ( ( llElapsed * xg_mock.driftPpb ) / 1000000000 ) );
+}
+
+/**
+ * @brief   Move the true time up to the given time, every datagram arriving meanwhile is delivered in arrival order.
+ * @note    In @ref SNTPEX_MOCK_TS_SPAWN mode the Spawn hook is called with the socket of every arrival, after the
+ *          Spawn latency.
+ */
+static void prv_mock_deliver( uint64_t ullUntil )
+{
+  for( ;; )
+  {
+    struct xSntpMockDatagram_t * pxNext       = NULL;
+    int16_t                      sNextSocket  = -1;
+    uint8_t                      ucSocket;
+    uint8_t                      ucSlot;
+
+    for( ucSocket = 0; ucSocket < SNTPEX_MOCK_MAX_SOCKETS; ucSocket++ )
+    {
+      for( ucSlot = 0; ( xg_mock.socket[ ucSocket ].used != 0u ) && ( ucSlot < SNTPEX_MOCK_QUEUE_SIZE ); ucSlot++ )
+      {
+        struct xSntpMockDatagram_t * pxData = &xg_mock.socket[ ucSocket ].queue[ ucSlot ];
+
+        if( ( pxData->used != 0u ) && ( pxData->arrived == 0u ) && ( pxData->deliverAt <= ullUntil ) &&
+            ( ( NULL == pxNext ) || ( pxData->deliverAt < pxNext->deliverAt ) ) )
+        {
+          pxNext      = pxData;
+          sNextSocket = ( int16_t )ucSocket;
+        }
+      }
+    }
+
+    if( NULL == pxNext )
+    {
+      break;
+    }
+
+    xg_mock.now       = ( pxNext->deliverAt > xg_mock.now ) ? pxNext->deliverAt : xg_mock.now;
+    pxNext->arrived   = 1u;
+    pxNext->rxLocal   = prv_mock_local_at( pxNext->deliverAt );
+
+    if( ( xg_mock.mode == SNTPEX_MOCK_TS_SPAWN ) && ( NULL != xg_mock.pfHook ) )
+    {
+      xg_mock.now += xg_mock.spawnLatency;
+      ( void )xg_mock.pfHook( sNextSocket, exlibSNTP_SOFTSR_RECV_BIT );
+    }
+  }
+
+  xg_mock.now = ( ullUntil > xg_mock.now ) ? ullUntil : xg_mock.now;
+}
+
+static struct xSntpMockSocket_t * prv_mock_socket( int16_t sd )
+{
+  if( ( sd < 0 ) || ( sd >= ( int16_t )SNTPEX_MOCK_MAX_SOCKETS ) || ( xg_mock.socket[ sd ].used == 0u ) )
+  {
+    return NULL;
+  }
+
+  return &xg_mock.socket[ sd ];
+}
+
+/* oldest datagram arrived on the socket */
+static struct xSntpMockDatagram_t * prv_mock_ready( struct xSntpMockSocket_t * pxSocket )
+{
+  struct xSntpMockDatagram_t * pxReady = NULL;
+  uint8_t                      ucSlot;
+
+  for( ucSlot = 0; ucSlot < SNTPEX_MOCK_QUEUE_SIZE; ucSlot++ )
+  {
+    struct xSntpMockDatagram_t * pxData = &pxSocket->queue[ ucSlot ];
+
+    if( ( pxData->used != 0u ) && ( pxData->arrived != 0u ) && ( ( NULL == pxReady ) || ( pxData->deliverAt < pxReady->deliverAt ) ) )
+    {
+      pxReady = pxData;
+    }
+  }
+
+  return pxReady;
+}
+
+/* next datagram arriving on the socket up to the deadline */
+static struct xSntpMockDatagram_t * prv_mock_pending( struct xSntpMockSocket_t * pxSocket, uint64_t ullDeadline )
+{
+  struct xSntpMockDatagram_t * pxPending = NULL;
+  uint8_t                      ucSlot;
+
+  for( ucSlot = 0; ucSlot < SNTPEX_MOCK_QUEUE_SIZE; ucSlot++ )
+  {
+    struct xSntpMockDatagram_t * pxData = &pxSocket->queue[ ucSlot ];
+
+    if( ( pxData->used != 0u ) && ( pxData->arrived == 0u ) && ( pxData->deliverAt <= ullDeadline ) &&
+        ( ( NULL == pxPending ) || ( pxData->deliverAt < pxPending->deliverAt ) ) )
+    {
+      pxPending = pxData;
+    }
+  }
+
+  return pxPending;
+}
+
+static int8_t prv_mock_server_find( const SlNetSock_Addr_t * pxAddress, SlNetSocklen_t xLength )
+{
+  uint8_t ucIndex;
+
+  for( ucIndex = 0; ucIndex < xg_mock.serverCount; ucIndex++ )
+  {
+    const struct xSntpMockServer_t * pxServer = &xg_mock.server[ ucIndex ];
+
+    if( pxServer->family != pxAddress->sa_family )
+    {
+      continue;
+    }
+
+    if( ( pxServer->family == SLNETSOCK_AF_INET ) && ( xLength >= sizeof( SlNetSock_AddrIn_t ) ) &&
+        ( 0 == memcmp( &( ( const SlNetSock_AddrIn_t * )pxAddress )->sin_addr.s_addr, pxServer->address, 4 ) ) )
+    {
+      return ( int8_t )ucIndex;
+    }
+
+    if( ( pxServer->family == SLNETSOCK_AF_INET6 ) && ( xLength >= sizeof( SlNetSock_AddrIn6_t ) ) &&
+        ( 0 == memcmp( ( ( const SlNetSock_AddrIn6_t * )pxAddress )->sin6_addr._S6_un._S6_u8, pxServer->address, 16 ) ) )
+    {
+      return ( int8_t )ucIndex;
+    }
+  }
+
+  return -1;
+}
+
+/**
+ * @brief   Answer a client request, the reply is queued on the socket with its arrival time.
+ * @note    The reply echoes the request transmit timestamp in its originate timestamp. A server with a key
+ *          signs the reply of a request signed with the same Key Identifier, and answers a crypto-NAK to a
+ *          request signed with another one.
+ */
+static void prv_mock_serve( struct xSntpMockSocket_t * pxSocket, uint8_t ucServer, const uint8_t * pucRequest, uint32_t ulLength )
+{
+  struct xSntpMockServer_t   * pxServer = &xg_mock.server[ ucServer ];
+  struct xSntpMockDatagram_t * pxData   = NULL;
+  uint8_t                      ucSlot;
+
+  pxServer->requests++;
+
+  if( ulLength < exlibSNTP_PACKET_HEADER_SIZE )
+  {
+    return;
+  }
+
+  if( ( pucRequest[ 0 ] & 0x07u ) != specNTP_MODE_CLIENT )
+  {
+    /* Reply of the responder mode to a host, kept for the checks */
+    ( void )memcpy( pxServer->answer, pucRequest, exlibSNTP_PACKET_HEADER_SIZE );
+    pxServer->answers++;
+    return;
+  }
+
+  if( ( pxServer->lossPermille > 0u ) && ( ( sntpex_mock_random() % 1000u ) < pxServer->lossPermille ) )
+  {
+    pxServer->lost++;
+    return;
+  }
+
+  for( ucSlot = 0; ( ucSlot < SNTPEX_MOCK_QUEUE_SIZE ) && ( NULL == pxData ); ucSlot++ )
+  {
+    pxData = ( pxSocket->queue[ ucSlot ].used == 0u ) ? &pxSocket->queue[ ucSlot ] : NULL;
+  }
+
+  if( NULL == pxData )
+  {
+    /* Socket buffers full, the reply is dropped */
+    return;
+  }
+
+  uint64_t  ullArrival = xg_mock.now + pxServer->latencyUs + prv_mock_jitter( pxServer->jitterUs );
+  uint64_t  ullT2      = ( uint64_t )( ( int64_t )ullArrival + pxServer->offsetUs );
+  uint64_t  ullT3      = ullT2 + pxServer->processingUs;
+  uint8_t * pucReply   = pxData->data;
+  uint8_t   ucPoll     = ( pucRequest[ exlibSNTP_PKT_OFFSET_POLL ] > pxServer->minPoll ) ? pucRequest[ exlibSNTP_PKT_OFFSET_POLL ] : pxServer->minPoll;
+  uint8_t   ucLi       = ( pxServer->kissCode != 0u ) ? ( uint8_t )specNTP_LI_ALARM : pxServer->li;
+
+  ( void )memset( pxData, 0, sizeof( struct xSntpMockDatagram_t ) );
+
+  pucReply[ exlibSNTP_PKT_OFFSET_FLAGS ]     = ( uint8_t )( ( ucLi << 6 ) | ( pucRequest[ 0 ] & 0x38u ) | specNTP_MODE_SERVER );
+  pucReply[ exlibSNTP_PKT_OFFSET_STRATUM ]   = ( pxServer->kissCode != 0u ) ? ( uint8_t )specNTP_STRATUM_KISS_O_DEATH : pxServer->stratum;
+  pucReply[ exlibSNTP_PKT_OFFSET_POLL ]      = ucPoll;
+  pucReply[ exlibSNTP_PKT_OFFSET_PRECISION ] = ( uint8_t )( -20 );
+  prv_mock_store32( &pucReply[ exlibSNTP_PKT_OFFSET_ROOT_DELAY ], SNTPEX_MOCK_ROOT_DELAY );
+  prv_mock_store32( &pucReply[ exlibSNTP_PKT_OFFSET_ROOT_DISP ],  SNTPEX_MOCK_ROOT_DISPERSION );
+  prv_mock_store32( &pucReply[ exlibSNTP_PKT_OFFSET_REF_ID ],     ( pxServer->kissCode != 0u ) ? pxServer->kissCode : SNTPEX_MOCK_REFID_GPS );
+  prv_mock_store_ts( &pucReply[ exlibSNTP_PKT_OFFSET_REF_TS ], ullT2 - 16000000u );
+  ( void )memcpy( &pucReply[ exlibSNTP_PKT_OFFSET_ORIG_TS ], &pucRequest[ exlibSNTP_PKT_OFFSET_XMIT_TS ], 8 );
+  prv_mock_store_ts( &pucReply[ exlibSNTP_PKT_OFFSET_RECV_TS ], ullT2 );
+  prv_mock_store_ts( &pucReply[ exlibSNTP_PKT_OFFSET_XMIT_TS ], ullT3 );
+
+  pxData->length = exlibSNTP_PACKET_HEADER_SIZE;
+
+  if( ( pxServer->keyId != 0u ) && ( ulLength >= ( exlibSNTP_PACKET_HEADER_SIZE + exlibSNTP_AUTH_KEY_ID_SIZE ) ) )
+  {
+    if( prv_mock_load32( &pucRequest[ exlibSNTP_PACKET_HEADER_SIZE ] ) == pxServer->keyId )
+    {
+      prv_mock_store32( &pucReply[ exlibSNTP_PACKET_HEADER_SIZE ], pxServer->keyId );
+      sntpex_mock_md5( pxServer->key, pxServer->keyLength, pucReply, exlibSNTP_PACKET_HEADER_SIZE,
+                       &pucReply[ exlibSNTP_PACKET_HEADER_SIZE + exlibSNTP_AUTH_KEY_ID_SIZE ] );
+      pxData->length = exlibSNTP_PACKET_HEADER_SIZE + exlibSNTP_AUTH_KEY_ID_SIZE + SNTPEX_MOCK_MD5_SIZE;
+    }
+    else
+    {
+      /* crypto-NAK, a zero Key Identifier without MAC */
+      prv_mock_store32( &pucReply[ exlibSNTP_PACKET_HEADER_SIZE ], 0 );
+      pxData->length = exlibSNTP_PACKET_HEADER_SIZE + exlibSNTP_AUTH_KEY_ID_SIZE;
+    }
+  }
+
+  pxData->used      = 1u;
+  pxData->server    = ucServer;
+  pxData->deliverAt = ullArrival + pxServer->processingUs + pxServer->latencyUs + pxServer->asymmetryUs +
+                      prv_mock_jitter( pxServer->jitterUs );
+  pxServer->replies++;
+}
+
+/* free slot of the socket bound to the NTP port of the family, NULL when no socket listens */
+static struct xSntpMockDatagram_t * prv_mock_listener_slot( uint16_t usFamily )
+{
+  uint8_t ucSocket;
+  uint8_t ucSlot;
+
+  for( ucSocket = 0; ucSocket < SNTPEX_MOCK_MAX_SOCKETS; ucSocket++ )
+  {
+    struct xSntpMockSocket_t * pxSocket = &xg_mock.socket[ ucSocket ];
+
+    if( ( pxSocket->used == 0u ) || ( pxSocket->port != exlibSNTP_SERVER_PORT ) || ( pxSocket->family != usFamily ) )
+    {
+      continue;
+    }
+
+    for( ucSlot = 0; ucSlot < SNTPEX_MOCK_QUEUE_SIZE; ucSlot++ )
+    {
+      if( pxSocket->queue[ ucSlot ].used == 0u )
+      {
+        ( void )memset( &pxSocket->queue[ ucSlot ], 0, sizeof( struct xSntpMockDatagram_t ) );
+
+        return &pxSocket->queue[ ucSlot ];
+      }
+    }
+
+    /* Socket buffers full, the packet is dropped */
+    return NULL;
+  }
+
+  return NULL;
+}
+
+/* header of a packet sent by a server or a host, the timestamps other than the reference one are cleared */
+static void prv_mock_header_set( uint8_t * pucPacket, const struct xSntpMockServer_t * pxServer, uint8_t ucMode, uint64_t ullReference )
+{
+  ( void )memset( pucPacket, 0, exlibSNTP_PACKET_HEADER_SIZE );
+
+  pucPacket[ exlibSNTP_PKT_OFFSET_FLAGS ]     = ( uint8_t )( ( pxServer->li << 6 ) | ( 4u << 3 ) | ucMode );
+  pucPacket[ exlibSNTP_PKT_OFFSET_STRATUM ]   = ( ucMode == specNTP_MODE_CLIENT ) ? 0u : pxServer->stratum;
+  pucPacket[ exlibSNTP_PKT_OFFSET_POLL ]      = pxServer->minPoll;
+  pucPacket[ exlibSNTP_PKT_OFFSET_PRECISION ] = ( uint8_t )( -20 );
+
+  if( ucMode != specNTP_MODE_CLIENT )
+  {
+    prv_mock_store32( &pucPacket[ exlibSNTP_PKT_OFFSET_ROOT_DELAY ], SNTPEX_MOCK_ROOT_DELAY );
+    prv_mock_store32( &pucPacket[ exlibSNTP_PKT_OFFSET_ROOT_DISP ],  SNTPEX_MOCK_ROOT_DISPERSION );
+    prv_mock_store32( &pucPacket[ exlibSNTP_PKT_OFFSET_REF_ID ],     SNTPEX_MOCK_REFID_GPS );
+    prv_mock_store_ts( &pucPacket[ exlibSNTP_PKT_OFFSET_REF_TS ], ullReference );
+  }
+}
+
+static uint32_t prv_mock_jitter( uint32_t ulJitter )
+{
+  return ( ulJitter > 0u ) ? ( sntpex_mock_random() % ( ulJitter + 1u ) ) : 0u;
+}
+
+static void prv_mock_store32( uint8_t * pucBuffer, uint32_t ulValue )
+{
+  pucBuffer[ 0 ] = ( uint8_t )( ulValue >> 24 );
+  pucBuffer[ 1 ] = ( uint8_t )( ulValue >> 16 );
+  pucBuffer[ 2 ] = ( uint8_t )( ulValue >>  8 );
+  pucBuffer[ 3 ] = ( uint8_t )( ulValue );
+}
+
+static uint32_t prv_mock_load32( const uint8_t * pucBuffer )
+{
+  return ( ( uint32_t )pucBuffer[ 0 ] << 24 ) | ( ( uint32_t )pucBuffer[ 1 ] << 16 ) |
+         ( ( uint32_t )pucBuffer[ 2 ] <<  8 ) |   ( uint32_t )pucBuffer[ 3 ];
+}
+
+/* NTP timestamp of a 64-UNIX time in us, the fraction is rounded up as done by the library */
+static void prv_mock_store_ts( uint8_t * pucBuffer, uint64_t ullTime )
+{
+  uint64_t ullMicros = ullTime % 1000000u;
+
+  prv_mock_store32( &pucBuffer[ 0 ], ( uint32_t )( ( ullTime / 1000000u ) + 2208988800u ) );
+  prv_mock_store32( &pucBuffer[ 4 ], ( uint32_t )( ( ( ullMicros << 32 ) + 999999u ) / 1000000u ) );
+}
+
+/* MD5 (RFC 1321) ----------------------------------------------------------------*/
+
+static void prv_mock_md5_init( struct xSntpMockMd5_t * pxMd5 )
+{
+  ( void )memset( pxMd5, 0, sizeof( struct xSntpMockMd5_t ) );
+
+  pxMd5->state[ 0 ] = 0x67452301u;
+  pxMd5->state[ 1 ] = 0xEFCDAB89u;
+  pxMd5->state[ 2 ] = 0x98BADCFEu;
+  pxMd5->state[ 3 ] = 0x10325476u;
+}
+
+static void prv_mock_md5_update( struct xSntpMockMd5_t * pxMd5, const uint8_t * pucData, uint32_t ulLength )
+{
+  uint32_t ulIndex;
+
+  for( ulIndex = 0; ulIndex < ulLength; ulIndex++ )
+  {
+    pxMd5->block[ pxMd5->used++ ] = pucData[ ulIndex ];
+
+    if( pxMd5->used == sizeof( pxMd5->block ) )
+    {
+      prv_mock_md5_block( pxMd5->state, pxMd5->block );
+      pxMd5->used = 0;
+    }
+  }
+
+  pxMd5->length += ulLength;
+}
+
+static void prv_mock_md5_final( struct xSntpMockMd5_t * pxMd5, uint8_t * pucDigest )
+{
+  uint64_t ullBits = pxMd5->length * 8u;
+  uint8_t  aucLength[ 8 ];
+  uint8_t  ucPad   = 0x80u;
+  uint8_t  ucZero  = 0;
+  uint8_t  ucIndex;
+
+  for( ucIndex = 0; ucIndex < 8u; ucIndex++ )
+  {
+    aucLength[ ucIndex ] = ( uint8_t )( ullBits >> ( 8u * ucIndex ) );
+  }
+
+  prv_mock_md5_update( pxMd5, &ucPad, 1 );
+
+  while( pxMd5->used != 56u )
+  {
+    prv_mock_md5_update( pxMd5, &ucZero, 1 );
+  }
+
+  prv_mock_md5_update( pxMd5, aucLength, sizeof( aucLength ) );
+
+  for( ucIndex = 0; ucIndex < 16u; ucIndex++ )
+  {
+    pucDigest[ ucIndex ] = ( uint8_t )( pxMd5->state[ ucIndex / 4u ] >> ( 8u * ( ucIndex % 4u ) ) );
+  }
+}
+
+static void prv_mock_md5_block( uint32_t * pulState, const uint8_t * pucBlock )
+{
+  static const uint32_t aulK[ 64 ] =
+  {
+    0xd76aa478u, 0xe8c7b756u, 0x242070dbu, 0xc1bdceeeu, 0xf57c0fafu, 0x4787c62au, 0xa8304613u, 0xfd469501u,
+    0x698098d8u, 0x8b44f7afu, 0xffff5bb1u, 0x895cd7beu, 0x6b901122u, 0xfd987193u, 0xa679438eu, 0x49b40821u,
+    0xf61e2562u, 0xc040b340u, 0x265e5a51u, 0xe9b6c7aau, 0xd62f105du, 0x02441453u, 0xd8a1e681u, 0xe7d3fbc8u,
+    0x21e1cde6u, 0xc33707d6u, 0xf4d50d87u, 0x455a14edu, 0xa9e3e905u, 0xfcefa3f8u, 0x676f02d9u, 0x8d2a4c8au,
+    0xfffa3942u, 0x8771f681u, 0x6d9d6122u, 0xfde5380cu, 0xa4beea44u, 0x4bdecfa9u, 0xf6bb4b60u, 0xbebfbc70u,
+    0x289b7ec6u, 0xeaa127fau, 0xd4ef3085u, 0x04881d05u, 0xd9d4d039u, 0xe6db99e5u, 0x1fa27cf8u, 0xc4ac5665u,
+    0xf4292244u, 0x432aff97u, 0xab9423a7u, 0xfc93a039u, 0x655b59c3u, 0x8f0ccc92u, 0xffeff47du, 0x85845dd1u,
+    0x6fa87e4fu, 0xfe2ce6e0u, 0xa3014314u, 0x4e0811a1u, 0xf7537e82u, 0xbd3af235u, 0x2ad7d2bbu, 0xeb86d391u,
+  };
+  static const uint8_t aucShift[ 16 ] = { 7, 12, 17, 22, 5, 9, 14, 20, 4, 11, 16, 23, 6, 10, 15, 21 };
+
+  uint32_t aulWord[ 16 ];
+  uint32_t ulA = pulState[ 0 ];
+  uint32_t ulB = pulState[ 1 ];
+  uint32_t ulC = pulState[ 2 ];
+  uint32_t ulD = pulState[ 3 ];
+  uint8_t  ucIndex;
+
+  for( ucIndex = 0; ucIndex < 16u; ucIndex++ )
+  {
+    aulWord[ ucIndex ] = ( uint32_t )pucBlock[ 4u * ucIndex ] | ( ( uint32_t )pucBlock[ ( 4u * ucIndex ) + 1u ] << 8 ) |
+                         ( ( uint32_t )pucBlock[ ( 4u * ucIndex ) + 2u ] << 16 ) | ( ( uint32_t )pucBlock[ ( 4u * ucIndex ) + 3u ] << 24 );
+  }
+
+  for( ucIndex = 0; ucIndex < 64u; ucIndex++ )
+  {
+    uint32_t ulF;
+    uint8_t  ucWord;
+
+    switch( ucIndex / 16u )
+    {
+      case 0:  ulF = ( ulB & ulC ) | ( ~ulB & ulD ); ucWord = ucIndex;                              break;
+      case 1:  ulF = ( ulD & ulB ) | ( ~ulD & ulC ); ucWord = ( uint8_t )( ( 5u * ucIndex + 1u ) % 16u ); break;
+      case 2:  ulF = ulB ^ ulC ^ ulD;                ucWord = ( uint8_t )( ( 3u * ucIndex + 5u ) % 16u ); break;
+      default: ulF = ulC ^ ( ulB | ~ulD );           ucWord = ( uint8_t )( ( 7u * ucIndex ) % 16u );      break;
+    }
+
+    uint8_t  ucShift = aucShift[ ( ( ucIndex / 16u ) * 4u ) + ( ucIndex % 4u ) ];
+    uint32_t ulSum   = ulA + ulF + aulK[ ucIndex ] + aulWord[ ucWord ];
+
+    ulA = ulD;
+    ulD = ulC;
+    ulC = ulB;
+    ulB = ulB + ( ( ulSum << ucShift ) | ( ulSum >> ( 32u - ucShift ) ) );
+  }
+
+  pulState[ 0 ] += ulA;
+  pulState[ 1 ] += ulB;
+  pulState[ 2 ] += ulC;
+  pulState[ 3 ] += ulD;
+}
+
+/* Virtual table APIs ------------------------------------------------------------*/
+
+static int8_t prv_mock_get_sntp_time( uint32_t * pulSeconds, uint32_t * pulFraction )
+{
+  uint8_t aucTimestamp[ 8 ];
+
+  prv_mock_store_ts( aucTimestamp, sntpex_mock_local_time() );
+
+  *pulSeconds  = prv_mock_load32( &aucTimestamp[ 0 ] );
+  *pulFraction = prv_mock_load32( &aucTimestamp[ 4 ] );
+
+  return 0;
+}
+
+static uint64_t prv_mock_get_unix_timestamp( void )
+{
+  return sntpex_mock_local_time();
+}
+
+static uint32_t prv_mock_get_os_tick( void )
+{
+  return ( uint32_t )( xg_mock.now / 1000u );
+}
+
+static void prv_mock_delay_ms( uint32_t ulDelay )
+{
+  prv_mock_deliver( xg_mock.now + ( ( uint64_t )ulDelay * 1000u ) );
+}
+
+static uint64_t prv_mock_get_rx_timestamp( int sd )
+{
+  struct xSntpMockSocket_t * pxSocket = prv_mock_socket( ( int16_t )sd );
+
+  return ( ( NULL != pxSocket ) && ( xg_mock.mode == SNTPEX_MOCK_TS_DRIVER ) ) ? pxSocket->lastRx : 0u;
+}
+
+static uint64_t prv_mock_get_tx_timestamp( int sd )
+{
+  struct xSntpMockSocket_t * pxSocket = prv_mock_socket( ( int16_t )sd );
+
+  return ( ( NULL != pxSocket ) && ( xg_mock.mode == SNTPEX_MOCK_TS_DRIVER ) ) ? pxSocket->lastTx : 0u;
+}
+
+static int32_t prv_mock_get_random( void * pvBuffer, uint16_t usLength )
+{
+  uint8_t * pucBuffer = ( uint8_t * )pvBuffer;
+  uint16_t  usIndex;
+
+  for( usIndex = 0; usIndex < usLength; usIndex++ )
+  {
+    pucBuffer[ usIndex ] = ( uint8_t )sntpex_mock_random();
+  }
+
+  return 0;
+}
+
+static int32_t prv_mock_compute_mac( uint8_t ucType, const uint8_t * pucKey, uint8_t ucKeyLength,
+                                     const uint8_t * pucData, uint16_t usLength, uint8_t * pucMac, uint8_t * pucMacLength )
+{
+  /* Only the MD5 digest is simulated */
+  if( ( ucType != SNTPEX_AUTH_MD5 ) || ( *pucMacLength < SNTPEX_MOCK_MD5_SIZE ) )
+  {
+    return -1;
+  }
+
+  sntpex_mock_md5( pucKey, ucKeyLength, pucData, usLength, pucMac );
+  *pucMacLength = SNTPEX_MOCK_MD5_SIZE;
+
+  return 0;
+}
+
+static int32_t prv_mock_nv_write( uint32_t ulOffset, const void * pvData, uint16_t usLength )
+{
+  if( ( xg_mock.nvFail != 0u ) || ( ( ulOffset + usLength ) > SNTPEX_MOCK_NV_SIZE ) )
+  {
+    return -1;
+  }
+
+  ( void )memcpy( &xg_mock.nv[ ulOffset ], pvData, usLength );
+  xg_mock.stats.nvWrites++;
+
+  return 0;
+}
+
+static int32_t prv_mock_nv_read( uint32_t ulOffset, void * pvData, uint16_t usLength )
+{
+  if( ( xg_mock.nvFail != 0u ) || ( ( ulOffset + usLength ) > SNTPEX_MOCK_NV_SIZE ) )
+  {
+    return -1;
+  }
+
+  ( void )memcpy( pvData, &xg_mock.nv[ ulOffset ], usLength );
+
+  return 0;
+}
+
+static uint32_t prv_mock_get_clock_epoch( void )
+{
+  return xg_mock.clockEpoch;
+}
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
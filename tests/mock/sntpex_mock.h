@@ -0,0 +1,135 @@
+/**
+ * @file    sntpex_ti/tests/mock/sntpex_mock.h
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Simulated network, NTP servers and local clock of the host tests and benchmarks.
+ *
+ * @details The simulation runs on a virtual true time in us, it only moves forward when the library waits
+ *          (blocking receive, select, busy socket, @ref delay_ms) or when the test advances it.
+ *          - The local clock reads the true time plus an offset and a frequency error, it is the clock the
+ *            library disciplines. The os tick counts the true ms.
+ *          - Every simulated server answers the requests sent to its address, with its own clock offset,
+ *            path latency and asymmetry, uniform jitter, request loss, Kiss-of-Death code and MD5 key.
+ *          - The replies are delivered on the socket at their arrival time, the driver receive timestamp or
+ *            the Spawn hook (@ref sntpex_eventTriggingFromISR) gives the local time of the arrival.
+ *          - A server can also send broadcasts, or act as a LAN host sending requests, to the sockets bound
+ *            to the NTP port (broadcast and responder modes). The packets it receives back are kept.
+ *          The ground truth of a sample is @ref sntpex_mock_true_offset , the server time minus the local time.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Oct 14, 2026
+ * @author  Ridha MASTOURI
+ */
+
+#ifndef SNTPEX_MOCK_SIMULATION_H_
+#define SNTPEX_MOCK_SIMULATION_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntp_ex_lib_ti.h"
+
+/* Exported macros ---------------------------------------------------------------*/
+#define SNTPEX_MOCK_MAX_SERVERS        ( 8u )
+#define SNTPEX_MOCK_MAX_SOCKETS        ( 8u )
+#define SNTPEX_MOCK_QUEUE_SIZE         ( 8u )
+#define SNTPEX_MOCK_NV_SIZE            ( 4096u )
+
+/* True time of @ref sntpex_mock_reset , 2026-01-01 00:00:00 UTC in us */
+#define SNTPEX_MOCK_START_TIME         ( 1767225600ull * 1000000ull )
+
+/* Time spent by a non-blocking receive or send attempt which returns SLNETERR_BSD_EAGAIN, in us */
+#define SNTPEX_MOCK_POLL_STEP          ( 100u )
+
+/* Exported types ----------------------------------------------------------------*/
+typedef enum
+{
+  SNTPEX_MOCK_TS_DRIVER = 0,     /* get_rx_timestamp / get_tx_timestamp vtable APIs of the socket.  */
+  SNTPEX_MOCK_TS_SPAWN  = 1,     /* Spawn hook on the transmission and on every arrival.            */
+} sntpex_mock_ts_mode_t;
+
+/* Spawn hook, @ref sntpex_eventTriggingFromISR , called with the socket and the type of the event */
+typedef sntp_ud_t ( * pf_mockSpawnHook )( int16_t sd, uint8_t ucEvent );
+
+struct xSntpMockServer_t
+{
+  /* configuration, set by the test after @ref sntpex_mock_server_add_v4 or @ref sntpex_mock_server_add_v6 */
+  int64_t      offsetUs;         /* server clock minus the true time.                         */
+  uint32_t     latencyUs;        /* one-way latency of the request and of the reply.          */
+  uint32_t     asymmetryUs;      /* extra latency of the reply path, biases the offset by half. */
+  uint32_t     jitterUs;         /* uniform extra latency of each path, from 0 to jitterUs.    */
+  uint32_t     processingUs;     /* time between the request arrival (T2) and the reply (T3).  */
+  uint16_t     lossPermille;     /* probability of a lost request, per thousand.               */
+  uint32_t     kissCode;         /* Kiss-of-Death code of the replies, 0 for a normal reply.   */
+  uint8_t      stratum;          /* stratum of the normal replies.                             */
+  uint8_t      li;               /* leap indicator of the replies.                             */
+  uint8_t      minPoll;          /* lowest poll exponent returned in the replies.              */
+  uint32_t     keyId;            /* MD5 key of the authenticated replies, 0 without key.       */
+  uint8_t      key[ exlibSNTP_AUTH_KEY_MAX_SIZE ];
+  uint8_t      keyLength;
+
+  /* address, network order, an IPV4 address uses the first four bytes */
+  uint16_t     family;
+  uint8_t      address[ 16 ];
+
+  /* counters */
+  uint32_t     requests;         /* requests received, lost ones included.                     */
+  uint32_t     lost;             /* requests lost.                                             */
+  uint32_t     replies;          /* replies sent.                                              */
+  uint32_t     answers;          /* packets of another mode than a request received back.      */
+  uint8_t      answer[ exlibSNTP_PACKET_HEADER_SIZE ]; /* header of the last one.                  */
+};
+
+struct xSntpMockStats_t
+{
+  uint32_t     sent;             /* datagrams sent by the library.                             */
+  uint32_t     busy;             /* send attempts refused with SLNETERR_BSD_EAGAIN.            */
+  uint32_t     unreachable;      /* datagrams sent to an unknown address.                      */
+  uint32_t     delivered;        /* datagrams received by the library.                         */
+  uint32_t     dns;              /* name resolutions.                                          */
+  uint32_t     nvWrites;         /* storage writes.                                            */
+};
+
+/* Exported functions ------------------------------------------------------------*/
+
+/* Simulation */
+void     sntpex_mock_reset( uint64_t ullSeed );
+void     sntpex_mock_advance( uint64_t ullMicros );
+uint64_t sntpex_mock_true_time( void );
+uint64_t sntpex_mock_local_time( void );
+void     sntpex_mock_clock_set( int64_t llOffsetUs, int32_t lDriftPpb );
+void     sntpex_mock_clock_epoch_set( uint32_t ulEpoch );
+void     sntpex_mock_busy_set( uint32_t ulAttempts );
+void     sntpex_mock_timestamp_mode_set( sntpex_mock_ts_mode_t xMode, pf_mockSpawnHook pfHook, uint32_t ulSpawnLatencyUs );
+void     sntpex_mock_vtable_get( struct ud_op_vtable * pxVtable );
+const struct xSntpMockStats_t * sntpex_mock_stats_get( void );
+uint32_t sntpex_mock_random( void );
+
+/* Servers */
+struct xSntpMockServer_t * sntpex_mock_server_add_v4( uint32_t ulAddress );
+struct xSntpMockServer_t * sntpex_mock_server_add_v6( const uint8_t * pucAddress );
+void     sntpex_mock_server_sockaddr( const struct xSntpMockServer_t * pxServer, sntpex_sockaddr_t * pxAddress );
+int64_t  sntpex_mock_true_offset( const struct xSntpMockServer_t * pxServer );
+uint64_t sntpex_mock_peer_request( struct xSntpMockServer_t * pxPeer );
+uint64_t sntpex_mock_broadcast_send( struct xSntpMockServer_t * pxServer );
+
+/* Storage */
+void     sntpex_mock_nv_corrupt( uint32_t ulOffset );
+void     sntpex_mock_nv_fail_set( uint8_t ucFail );
+
+/* MD5 digest( key || data ), the compute_mac vtable API of the mock */
+void     sntpex_mock_md5( const uint8_t * pucKey, uint8_t ucKeyLength, const uint8_t * pucData, uint16_t usLength, uint8_t * pucDigest );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SNTPEX_MOCK_SIMULATION_H_ */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
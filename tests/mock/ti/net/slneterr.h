@@ -0,0 +1,27 @@
+/**
+ * @file    sntpex_ti/tests/mock/ti/net/slneterr.h
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Host stand-in of the SimpleLink SlNetErr codes used by the Extended SNTP library.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Oct 14, 2026
+ * @author  Ridha MASTOURI
+ */
+
+#ifndef SNTPEX_MOCK_TI_NET_SLNETERR_H_
+#define SNTPEX_MOCK_TI_NET_SLNETERR_H_
+
+#define SLNETERR_RET_CODE_OK               ( 0 )
+#define SLNETERR_BSD_EBADF                 ( -9 )
+#define SLNETERR_BSD_EAGAIN                ( -11 )
+#define SLNETERR_BSD_ENOMEM                ( -12 )
+#define SLNETERR_BSD_EINVAL                ( -22 )
+
+#endif /* SNTPEX_MOCK_TI_NET_SLNETERR_H_ */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
@@ -0,0 +1,138 @@
+/**
+ * @file    sntpex_ti/tests/mock/ti/net/slnetsock.h
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Host stand-in of the SimpleLink SlNetSock API, the subset used by the Extended SNTP library.
+ *
+ * @note    The types and values follow the SimpleLink SDK, the calls are served by the simulated network
+ *          of @ref sntpex_mock.h . Only built with the host tests (SNTPEX_HOST_TESTS).
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Oct 14, 2026
+ * @author  Ridha MASTOURI
+ */
+
+#ifndef SNTPEX_MOCK_TI_NET_SLNETSOCK_H_
+#define SNTPEX_MOCK_TI_NET_SLNETSOCK_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/* Exported macros ---------------------------------------------------------------*/
+#define SLNETSOCK_AF_INET                  ( 2 )
+#define SLNETSOCK_AF_INET6                 ( 3 )
+
+#define SLNETSOCK_SOCK_DGRAM               ( 2 )
+#define SLNETSOCK_PROTO_UDP                ( 17 )
+
+#define SLNETSOCK_LVL_SOCKET               ( 1 )
+#define SLNETSOCK_LVL_IP                   ( 2 )
+
+#define SLNETSOCK_OPSOCK_RCV_TIMEO         ( 20 )
+#define SLNETSOCK_OPSOCK_NON_BLOCKING      ( 24 )
+#define SLNETSOCK_OPIP_ADD_MEMBERSHIP      ( 65 )
+#define SLNETSOCK_OPIP_DROP_MEMBERSHIP     ( 66 )
+#define SLNETSOCK_OPIPV6_ADD_MEMBERSHIP    ( 134 )
+
+#define SLNETSOCK_INADDR_ANY               ( 0 )
+
+/* Exported types ----------------------------------------------------------------*/
+typedef uint16_t SlNetSocklen_t;
+
+typedef struct SlNetSock_Addr_t
+{
+  uint16_t sa_family;
+  uint8_t  sa_data[ 14 ];
+} SlNetSock_Addr_t;
+
+typedef struct SlNetSock_InAddr_t
+{
+  uint32_t s_addr;                   /* network order */
+} SlNetSock_InAddr_t;
+
+typedef struct SlNetSock_AddrIn_t
+{
+  uint16_t           sin_family;
+  uint16_t           sin_port;       /* network order */
+  SlNetSock_InAddr_t sin_addr;
+  int8_t             sin_zero[ 8 ];
+} SlNetSock_AddrIn_t;
+
+typedef struct SlNetSock_In6Addr_t
+{
+  union
+  {
+    uint8_t  _S6_u8[ 16 ];
+    uint16_t _S6_u16[ 8 ];
+    uint32_t _S6_u32[ 4 ];
+  } _S6_un;
+} SlNetSock_In6Addr_t;
+
+typedef struct SlNetSock_AddrIn6_t
+{
+  uint16_t            sin6_family;
+  uint16_t            sin6_port;     /* network order */
+  uint32_t            sin6_flowinfo;
+  SlNetSock_In6Addr_t sin6_addr;
+  uint32_t            sin6_scope_id;
+} SlNetSock_AddrIn6_t;
+
+typedef struct SlNetSock_Timeval_t
+{
+  int32_t tv_sec;
+  int32_t tv_usec;
+} SlNetSock_Timeval_t;
+
+typedef struct SlNetSock_Nonblocking_t
+{
+  uint32_t nonBlockingEnabled;
+} SlNetSock_Nonblocking_t;
+
+typedef struct SlNetSock_SdSet_t
+{
+  uint32_t sdSetBitmap[ 2 ];
+} SlNetSock_SdSet_t;
+
+typedef struct SlNetSock_IpMreq_t
+{
+  SlNetSock_InAddr_t imr_multiaddr;
+  uint32_t           imr_interface;
+} SlNetSock_IpMreq_t;
+
+typedef struct SlNetSock_IpV6Mreq_t
+{
+  uint8_t  ipv6mr_multiaddr[ 16 ];
+  uint32_t ipv6mr_interface;
+} SlNetSock_IpV6Mreq_t;
+
+/* Exported functions ------------------------------------------------------------*/
+int16_t SlNetSock_create  ( int16_t domain, int16_t type, int16_t protocol, uint32_t ifBitmap, int16_t flags );
+int32_t SlNetSock_close   ( int16_t sd );
+int32_t SlNetSock_setOpt  ( int16_t sd, int16_t level, int16_t optname, void * optval, SlNetSocklen_t optlen );
+int32_t SlNetSock_bind    ( int16_t sd, const SlNetSock_Addr_t * addr, int16_t addrlen );
+int32_t SlNetSock_sendTo  ( int16_t sd, const void * buf, uint32_t len, int32_t flags, const SlNetSock_Addr_t * to, SlNetSocklen_t tolen );
+int32_t SlNetSock_recvFrom( int16_t sd, void * buf, uint32_t len, int32_t flags, SlNetSock_Addr_t * from, SlNetSocklen_t * fromlen );
+int32_t SlNetSock_select  ( int16_t nsds, SlNetSock_SdSet_t * readsds, SlNetSock_SdSet_t * writesds, SlNetSock_SdSet_t * exceptsds,
+                            SlNetSock_Timeval_t * timeout );
+void    SlNetSock_sdsSet   ( int16_t sd, SlNetSock_SdSet_t * sdset );
+void    SlNetSock_sdsClr   ( int16_t sd, SlNetSock_SdSet_t * sdset );
+void    SlNetSock_sdsClrAll( SlNetSock_SdSet_t * sdset );
+int32_t SlNetSock_sdsIsSet ( int16_t sd, SlNetSock_SdSet_t * sdset );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SNTPEX_MOCK_TI_NET_SLNETSOCK_H_ */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
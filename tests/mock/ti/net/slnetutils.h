@@ -0,0 +1,40 @@
+/**
+ * @file    sntpex_ti/tests/mock/ti/net/slnetutils.h
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Host stand-in of the SimpleLink SlNetUtil API, the subset used by the Extended SNTP library.
+ *
+ * @note    @ref SlNetUtil_getHostByName resolves every name to the simulated servers of the family.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Oct 14, 2026
+ * @author  Ridha MASTOURI
+ */
+
+#ifndef SNTPEX_MOCK_TI_NET_SLNETUTILS_H_
+#define SNTPEX_MOCK_TI_NET_SLNETUTILS_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdint.h>
+
+uint32_t SlNetUtil_htonl( uint32_t val );
+uint32_t SlNetUtil_ntohl( uint32_t val );
+uint16_t SlNetUtil_htons( uint16_t val );
+uint16_t SlNetUtil_ntohs( uint16_t val );
+int32_t  SlNetUtil_getHostByName( uint32_t ifBitmap, char * name, const uint16_t nameLen, uint32_t * ipAddr,
+                                  uint16_t * ipAddrLen, const uint8_t family );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SNTPEX_MOCK_TI_NET_SLNETUTILS_H_ */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
@@ -0,0 +1,86 @@
+/**
+ * @file    sntpex_ti/tests/sntpex_test.h
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Minimal assertions of the host tests, one executable per module.
+ *
+ * @note    A failed check prints its location and the test goes on, the executable returns 1 to ctest
+ *          when any check failed.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Oct 14, 2026
+ * @author  Ridha MASTOURI
+ */
+
+#ifndef SNTPEX_TEST_H_
+#define SNTPEX_TEST_H_
+
+/* Includes ----------------------------------------------------------------------*/
+#include <stdio.h>
+#include "sntpex_mock.h"
+
+/* Exported variables ------------------------------------------------------------*/
+static int sntpex_test_failures;
+
+/* Exported macros ---------------------------------------------------------------*/
+#define CHECK( cond )                                                                   \
+  do                                                                                    \
+  {                                                                                     \
+    if( !( cond ) )                                                                     \
+    {                                                                                   \
+      ( void )printf( "%s:%d: CHECK( %s ) failed\n", __FILE__, __LINE__, #cond );        \
+      sntpex_test_failures++;                                                           \
+    }                                                                                   \
+  }                                                                                     \
+  while( 0 )
+
+#define CHECK_EQ( actual, expected )                                                    \
+  do                                                                                    \
+  {                                                                                     \
+    long long llActual_   = ( long long )( actual );                                    \
+    long long llExpected_ = ( long long )( expected );                                  \
+    if( llActual_ != llExpected_ )                                                      \
+    {                                                                                   \
+      ( void )printf( "%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual, \
+                      llActual_, llExpected_ );                                         \
+      sntpex_test_failures++;                                                           \
+    }                                                                                   \
+  }                                                                                     \
+  while( 0 )
+
+/* |actual - expected| <= tolerance */
+#define CHECK_NEAR( actual, expected, tolerance )                                       \
+  do                                                                                    \
+  {                                                                                     \
+    long long llActual_   = ( long long )( actual );                                    \
+    long long llExpected_ = ( long long )( expected );                                  \
+    long long llDiff_     = ( llActual_ > llExpected_ ) ? ( llActual_ - llExpected_ ) :  \
+                                                          ( llExpected_ - llActual_ );  \
+    if( llDiff_ > ( long long )( tolerance ) )                                          \
+    {                                                                                   \
+      ( void )printf( "%s:%d: %s is %lld, expected %lld +/- %lld\n", __FILE__, __LINE__, \
+                      #actual, llActual_, llExpected_, ( long long )( tolerance ) );     \
+      sntpex_test_failures++;                                                           \
+    }                                                                                   \
+  }                                                                                     \
+  while( 0 )
+
+#define RUN( test )                                                                     \
+  do                                                                                    \
+  {                                                                                     \
+    int iBefore_ = sntpex_test_failures;                                                \
+    test();                                                                             \
+    ( void )printf( "%s %s\n", ( iBefore_ == sntpex_test_failures ) ? "PASS" : "FAIL",  \
+                    #test );                                                            \
+  }                                                                                     \
+  while( 0 )
+
+#define TEST_RESULT()  ( ( sntpex_test_failures != 0 ) ? 1 : 0 )
+
+#endif /* SNTPEX_TEST_H_ */
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
@@ -0,0 +1,153 @@
+/**
+ * @file    sntpex_ti/tests/test_auth.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Host tests of the symmetric-key authentication : MAC sign and verify, crypto-NAK, and the
+ *          authenticated exchange with a simulated server.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Oct 14, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntpex_test.h"
+
+/* Private variables -------------------------------------------------------------*/
+static const uint8_t xg_key[ 8 ] = { 's', 'n', 't', 'p', 'e', 'x', 'k', '1' };
+
+/* Private function   ------------------------------------------------------------*/
+
+static void prv_key( struct xSntpKey_t * pxKey, uint32_t ulKeyId )
+{
+  ( void )memset( pxKey, 0, sizeof( struct xSntpKey_t ) );
+
+  pxKey->keyId   = ulKeyId;
+  pxKey->type    = SNTPEX_AUTH_MD5;
+  pxKey->length  = sizeof( xg_key );
+  pxKey->macSize = sntpex_auth_mac_size( SNTPEX_AUTH_MD5 );
+  ( void )memcpy( pxKey->key, xg_key, sizeof( xg_key ) );
+}
+
+static void test_auth_md5_known_answer( void )
+{
+  static const uint8_t aucExpected[ 16 ] =
+  {
+    0x90, 0x01, 0x50, 0x98, 0x3c, 0xd2, 0x4f, 0xb0, 0xd6, 0x96, 0x3f, 0x7d, 0x28, 0xe1, 0x7f, 0x72
+  };
+  uint8_t aucDigest[ 16 ];
+
+  /* RFC 1321 test suite, MD5( "abc" ) */
+  sntpex_mock_md5( NULL, 0, ( const uint8_t * )"abc", 3, aucDigest );
+  CHECK( 0 == memcmp( aucDigest, aucExpected, sizeof( aucExpected ) ) );
+
+  CHECK_EQ( sntpex_auth_mac_size( SNTPEX_AUTH_MD5 ), 16 );
+  CHECK_EQ( sntpex_auth_mac_size( SNTPEX_AUTH_SHA1 ), 20 );
+  CHECK_EQ( sntpex_auth_mac_size( SNTPEX_AUTH_AES_CMAC ), 16 );
+  CHECK_EQ( sntpex_auth_mac_size( SNTPEX_AUTH_NONE ), 0 );
+}
+
+static void test_auth_sign_verify( void )
+{
+  struct ud_op_vtable xVtable;
+  struct xSntpKey_t   xKey;
+  struct xSntpKey_t   xOther;
+  uint8_t             aucPacket[ exlibSNTP_TIME_MESSAGE_MAX_SIZE ] = { 0x23, 0, };
+  uint16_t            usLength = exlibSNTP_PACKET_HEADER_SIZE;
+
+  sntpex_mock_reset( 1 );
+  sntpex_mock_vtable_get( &xVtable );
+  prv_key( &xKey, 7 );
+  prv_key( &xOther, 8 );
+
+  CHECK_EQ( sntpex_auth_sign( &xVtable, &xKey, aucPacket, sizeof( aucPacket ), &usLength ), SNTPEX_SUCCESS );
+  CHECK_EQ( usLength, exlibSNTP_PACKET_HEADER_SIZE + 4u + 16u );
+  CHECK_EQ( aucPacket[ 51 ], 7 );
+  CHECK_EQ( sntpex_auth_verify( &xVtable, &xKey, aucPacket, usLength ), SNTPEX_SUCCESS );
+
+  /* Another Key Identifier, a tampered header or MAC */
+  CHECK_EQ( sntpex_auth_verify( &xVtable, &xOther, aucPacket, usLength ), SNTPEX_ERR_AUTH );
+  aucPacket[ 40 ] ^= 1u;
+  CHECK_EQ( sntpex_auth_verify( &xVtable, &xKey, aucPacket, usLength ), SNTPEX_ERR_AUTH );
+  aucPacket[ 40 ] ^= 1u;
+  aucPacket[ usLength - 1u ] ^= 0x80u;
+  CHECK_EQ( sntpex_auth_verify( &xVtable, &xKey, aucPacket, usLength ), SNTPEX_ERR_AUTH );
+
+  /* Unsigned packet and crypto-NAK */
+  CHECK_EQ( sntpex_auth_verify( &xVtable, &xKey, aucPacket, exlibSNTP_PACKET_HEADER_SIZE ), SNTPEX_ERR_AUTH );
+  ( void )memset( &aucPacket[ 48 ], 0, 4 );
+  CHECK_EQ( sntpex_auth_verify( &xVtable, &xKey, aucPacket, exlibSNTP_PACKET_HEADER_SIZE + 4u ), SNTPEX_ERR_AUTH );
+
+  /* Too small buffer, algorithm not provided by the accelerator */
+  usLength = exlibSNTP_PACKET_HEADER_SIZE;
+  CHECK_EQ( sntpex_auth_sign( &xVtable, &xKey, aucPacket, exlibSNTP_PACKET_HEADER_SIZE + 8u, &usLength ), SNTPEX_ERR_INVALID_MESSAGE );
+  xKey.type    = SNTPEX_AUTH_SHA1;
+  xKey.macSize = 20;
+  CHECK_EQ( sntpex_auth_sign( &xVtable, &xKey, aucPacket, sizeof( aucPacket ), &usLength ), SNTPEX_ERR_AUTH );
+}
+
+static void test_auth_exchange( void )
+{
+  static sntpex_client_handle_t xClient;
+  struct ud_op_vtable           xVtable;
+  struct xTimestampCtx_t        xCtx;
+  sntpex_sockaddr_t             xAddress;
+
+  sntpex_mock_reset( 3 );
+  sntpex_mock_vtable_get( &xVtable );
+
+  struct xSntpMockServer_t * pxServer = sntpex_mock_server_add_v4( 0x0A000001u );
+
+  pxServer->keyId     = 7;
+  pxServer->keyLength = sizeof( xg_key );
+  ( void )memcpy( pxServer->key, xg_key, sizeof( xg_key ) );
+  sntpex_mock_server_sockaddr( pxServer, &xAddress );
+
+  ( void )sntpex_clientInitialization( &xClient, &xVtable );
+  ( void )sntpex_client_set_server_address( &xClient, &xAddress.sa );
+
+  CHECK_EQ( sntpex_client_auth_key_add( &xClient, 0, SNTPEX_AUTH_MD5, xg_key, sizeof( xg_key ) ), SNTPEX_ERROR );
+  CHECK_EQ( sntpex_client_auth_key_add( &xClient, 7, SNTPEX_AUTH_MD5, xg_key, sizeof( xg_key ) ), SNTPEX_SUCCESS );
+  CHECK_EQ( sntpex_client_auth_key_add( &xClient, 9, SNTPEX_AUTH_MD5, xg_key, sizeof( xg_key ) ), SNTPEX_SUCCESS );
+
+  /* Signed request, signed reply */
+  CHECK_EQ( sntpex_client_auth_key_select( &xClient, 7 ), SNTPEX_SUCCESS );
+  CHECK_EQ( sntpex_client_timestamp_get( &xClient, &xCtx ), SNTPEX_SUCCESS );
+
+  /* Unknown key on the server : crypto-NAK */
+  CHECK_EQ( sntpex_client_auth_key_select( &xClient, 9 ), SNTPEX_SUCCESS );
+  CHECK_EQ( sntpex_client_timestamp_get( &xClient, &xCtx ), SNTPEX_ERR_AUTH );
+
+  /* Another key on the server, the reply MAC does not verify */
+  CHECK_EQ( sntpex_client_auth_key_select( &xClient, 7 ), SNTPEX_SUCCESS );
+  pxServer->key[ 0 ] ^= 0xFFu;
+  CHECK_EQ( sntpex_client_timestamp_get( &xClient, &xCtx ), SNTPEX_ERR_AUTH );
+  pxServer->key[ 0 ] ^= 0xFFu;
+
+  /* Unsigned reply of an authenticated request */
+  pxServer->keyId = 0;
+  CHECK_EQ( sntpex_client_timestamp_get( &xClient, &xCtx ), SNTPEX_ERR_AUTH );
+
+  /* Authentication disabled */
+  CHECK_EQ( sntpex_client_auth_key_select( &xClient, 0 ), SNTPEX_SUCCESS );
+  CHECK_EQ( sntpex_client_timestamp_get( &xClient, &xCtx ), SNTPEX_SUCCESS );
+
+  sntpex_client_deinitialization( &xClient );
+}
+
+/* Exported function   ------------------------------------------------------------*/
+
+int main( void )
+{
+  RUN( test_auth_md5_known_answer );
+  RUN( test_auth_sign_verify );
+  RUN( test_auth_exchange );
+
+  return TEST_RESULT();
+}
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
@@ -0,0 +1,137 @@
+/**
+ * @file    sntpex_ti/tests/test_filter.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Host tests of the minimum-delay clock filter.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Oct 14, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntpex_test.h"
+
+/* Private function   ------------------------------------------------------------*/
+
+static struct xSntpSample_t prv_sample( int64_t llOffset, int64_t llDelay, uint64_t ullEpoch )
+{
+  struct xSntpSample_t xSample;
+
+  xSample.offset = llOffset;
+  xSample.delay  = llDelay;
+  xSample.epoch  = ullEpoch;
+
+  return xSample;
+}
+
+static void test_filter_empty( void )
+{
+  struct xSntpFilter_t xFilter;
+  struct xSntpSample_t xBest;
+
+  sntpex_filter_reset( &xFilter );
+
+  CHECK_EQ( sntpex_filter_best_get( &xFilter, &xBest ), SNTPEX_ERROR );
+  CHECK_EQ( sntpex_filter_push( NULL, &xBest ), SNTPEX_ERR_NULL_PTR );
+}
+
+static void test_filter_minimum_delay( void )
+{
+  struct xSntpFilter_t xFilter;
+  struct xSntpSample_t xSample;
+  struct xSntpSample_t xBest;
+
+  sntpex_filter_reset( &xFilter );
+
+  xSample = prv_sample( 1000, 30000, 1 );
+  ( void )sntpex_filter_push( &xFilter, &xSample );
+  xSample = prv_sample( 200,  8000,  2 );
+  ( void )sntpex_filter_push( &xFilter, &xSample );
+  xSample = prv_sample( -500, 20000, 3 );
+  ( void )sntpex_filter_push( &xFilter, &xSample );
+
+  CHECK_EQ( sntpex_filter_best_get( &xFilter, &xBest ), SNTPEX_SUCCESS );
+  CHECK_EQ( xBest.offset, 200 );
+  CHECK_EQ( xBest.delay, 8000 );
+
+  /* Equal delay, the most recent sample wins */
+  xSample = prv_sample( 300, 8000, 4 );
+  ( void )sntpex_filter_push( &xFilter, &xSample );
+  ( void )sntpex_filter_best_get( &xFilter, &xBest );
+  CHECK_EQ( xBest.offset, 300 );
+
+  /* The ring replaces the oldest samples, the best one ages out */
+  uint8_t ucIndex;
+
+  for( ucIndex = 0; ucIndex < exlibSNTP_FILTER_SIZE; ucIndex++ )
+  {
+    xSample = prv_sample( 50, 9000 + ucIndex, 10u + ucIndex );
+    ( void )sntpex_filter_push( &xFilter, &xSample );
+  }
+
+  CHECK_EQ( xFilter.count, exlibSNTP_FILTER_SIZE );
+  ( void )sntpex_filter_best_get( &xFilter, &xBest );
+  CHECK_EQ( xBest.delay, 9000 );
+  CHECK_EQ( xBest.epoch, 10 );
+}
+
+static void test_filter_jitter( void )
+{
+  struct xSntpFilter_t xFilter;
+  struct xSntpSample_t xSample;
+
+  sntpex_filter_reset( &xFilter );
+
+  /* One sample, no jitter */
+  xSample = prv_sample( 0, 1000, 1 );
+  ( void )sntpex_filter_push( &xFilter, &xSample );
+  CHECK_EQ( xFilter.jitter, 0 );
+
+  /* Differences 0, 300, -400 with the best sample : sqrt( ( 0 + 90000 + 160000 ) / 2 ) */
+  xSample = prv_sample( 300, 2000, 2 );
+  ( void )sntpex_filter_push( &xFilter, &xSample );
+  xSample = prv_sample( -400, 3000, 3 );
+  ( void )sntpex_filter_push( &xFilter, &xSample );
+  CHECK_EQ( xFilter.jitter, 353 );
+}
+
+static void test_filter_jitter_saturation( void )
+{
+  struct xSntpFilter_t xFilter;
+  struct xSntpSample_t xSample;
+  uint8_t              ucIndex;
+
+  sntpex_filter_reset( &xFilter );
+
+  /* Offsets hours apart, the differences saturate instead of overflowing the squares sum */
+  xSample = prv_sample( 0, 1000, 1 );
+  ( void )sntpex_filter_push( &xFilter, &xSample );
+
+  for( ucIndex = 1; ucIndex < exlibSNTP_FILTER_SIZE; ucIndex++ )
+  {
+    xSample = prv_sample( ( int64_t )ucIndex * 3600000000ll, 2000, 1u + ucIndex );
+    ( void )sntpex_filter_push( &xFilter, &xSample );
+  }
+
+  CHECK( xFilter.jitter > 0 );
+  CHECK( xFilter.jitter <= ( ( int64_t )1 << 28 ) + 1 );
+}
+
+/* Exported function   ------------------------------------------------------------*/
+
+int main( void )
+{
+  RUN( test_filter_empty );
+  RUN( test_filter_minimum_delay );
+  RUN( test_filter_jitter );
+  RUN( test_filter_jitter_saturation );
+
+  return TEST_RESULT();
+}
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
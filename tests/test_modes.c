@@ -0,0 +1,467 @@
+/**
+ * @file    sntpex_ti/tests/test_modes.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Host tests of the clients running at the same time on the Spawn timestamps : stepped requests,
+ *          dual-stack race, timer wheel, responder next to its upstream client, broadcast listen and the
+ *          fast time. Every T4 and T2 is checked against the ground truth of the simulation.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Oct 14, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntpex_test.h"
+
+/* Private macros ----------------------------------------------------------------*/
+#define TEST_SPAWN_LATENCY             ( 20u )    /* Spawn queue latency, in us.          */
+#define TEST_STEP_PERIOD               ( 200u )   /* time between two steps, in us.       */
+#define TEST_MAX_STEPS                 ( 10000u )
+
+/* Private variables -------------------------------------------------------------*/
+static sntpex_client_handle_t axg_client[ 2 ];
+static struct ud_op_vtable    xg_vtable;
+#if ( exlibSNTP_CONFIG_TIMER_WHEEL == 1 )
+static sntp_ud_t              axg_status[ 2 ];
+static uint8_t                ucg_completed;
+#endif
+
+/* Private function   ------------------------------------------------------------*/
+
+/* Fresh simulation, the receptions are only timestamped by the Spawn task */
+static void prv_modes_setup( uint64_t ullSeed )
+{
+  sntpex_mock_reset( ullSeed );
+  sntpex_mock_vtable_get( &xg_vtable );
+  sntpex_mock_timestamp_mode_set( SNTPEX_MOCK_TS_SPAWN, sntpex_eventTriggingFromISR, TEST_SPAWN_LATENCY );
+}
+
+/* Initialize a client of the server */
+static void prv_client_start( sntpex_client_handle_t * p_client, const struct xSntpMockServer_t * pxServer )
+{
+  sntpex_sockaddr_t xAddress;
+
+  sntpex_mock_server_sockaddr( pxServer, &xAddress );
+
+  ( void )memset( p_client, 0, sizeof( sntpex_client_handle_t ) );
+  CHECK_EQ( sntpex_clientInitialization( p_client, &xg_vtable ), SNTPEX_SUCCESS );
+  CHECK_EQ( sntpex_client_set_server_address( p_client, &xAddress.sa ), SNTPEX_SUCCESS );
+}
+
+/* Offset of the sample of a timestamp list against the ground truth of the simulation */
+static int64_t prv_offset_error( const struct xTimestampCtx_t * pxCtx, const struct xSntpMockServer_t * pxServer )
+{
+  struct xSntpSample_t xSample;
+
+  if( sntpex_sample_compute( pxCtx, &xSample ) != SNTPEX_SUCCESS )
+  {
+    return INT64_MAX;
+  }
+
+  return xSample.offset - sntpex_mock_true_offset( pxServer );
+}
+
+/* Two stepped requests in flight at the same time, each reply takes the Spawn event of its own socket */
+static void test_modes_spawn_steps( void )
+{
+  struct xTimestampCtx_t     axCtx[ 2 ];
+  struct xSntpMockServer_t * apxServer[ 2 ];
+  sntp_ud_t                  axStatus[ 2 ] = { SNTPEX_PENDING, SNTPEX_PENDING };
+  uint32_t                   ulSteps       = 0;
+  uint8_t                    ucIndex;
+
+  prv_modes_setup( 21 );
+  sntpex_mock_clock_set( -400000, 0 );
+
+  /* The reply of the closest server arrives first, while the other request is still in flight */
+  apxServer[ 0 ] = sntpex_mock_server_add_v4( 0x0A000001u );
+  apxServer[ 1 ] = sntpex_mock_server_add_v4( 0x0A000002u );
+  apxServer[ 0 ]->latencyUs = 10000u;
+  apxServer[ 0 ]->offsetUs  = 2000;
+  apxServer[ 1 ]->latencyUs = 3000u;
+  apxServer[ 1 ]->offsetUs  = -7000;
+
+  for( ucIndex = 0; ucIndex < 2u; ucIndex++ )
+  {
+    prv_client_start( &axg_client[ ucIndex ], apxServer[ ucIndex ] );
+  }
+
+  while( ( ( axStatus[ 0 ] == SNTPEX_PENDING ) || ( axStatus[ 1 ] == SNTPEX_PENDING ) ) && ( ulSteps < TEST_MAX_STEPS ) )
+  {
+    for( ucIndex = 0; ucIndex < 2u; ucIndex++ )
+    {
+      if( axStatus[ ucIndex ] == SNTPEX_PENDING )
+      {
+        axStatus[ ucIndex ] = sntpex_client_step( &axg_client[ ucIndex ], &axCtx[ ucIndex ] );
+      }
+    }
+
+    sntpex_mock_advance( TEST_STEP_PERIOD );
+    ulSteps++;
+  }
+
+  /* The Spawn latency delays T4, half of it biases the offset */
+  for( ucIndex = 0; ucIndex < 2u; ucIndex++ )
+  {
+    CHECK_EQ( axStatus[ ucIndex ], SNTPEX_SUCCESS );
+    CHECK_EQ( sntpex_client_rx_timestamp_source_get( &axg_client[ ucIndex ] ), SNTPEX_TS_SOURCE_SPAWN );
+    CHECK_NEAR( prv_offset_error( &axCtx[ ucIndex ], apxServer[ ucIndex ] ), -( int64_t )( TEST_SPAWN_LATENCY / 2u ), 2 );
+    sntpex_client_deinitialization( &axg_client[ ucIndex ] );
+  }
+}
+
+#if ( exlibSNTP_CONFIG_IPV6 == 1 )
+/* The requests of both families race, the reply of the fastest path wins with its own T4 */
+static void test_modes_dual_stack( void )
+{
+  static const uint8_t       aucAddress6[ 16 ] = { 0xFD, 0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01 };
+  struct xTimestampCtx_t     xCtx;
+  struct xSntpMockServer_t * pxServer4;
+  struct xSntpMockServer_t * pxServer6;
+  uint8_t                    ucWinner = 0xFFu;
+
+  prv_modes_setup( 22 );
+  sntpex_mock_clock_set( 250000, 0 );
+
+  pxServer4 = sntpex_mock_server_add_v4( 0x0A000001u );
+  pxServer6 = sntpex_mock_server_add_v6( aucAddress6 );
+  pxServer4->latencyUs = 12000u;
+  pxServer4->offsetUs  = 1000;
+  pxServer6->latencyUs = 2000u;
+  pxServer6->offsetUs  = -3000;
+
+  prv_client_start( &axg_client[ 0 ], pxServer4 );
+  prv_client_start( &axg_client[ 1 ], pxServer6 );
+
+  CHECK_EQ( sntpex_client_dual_stack_timestamp_get( &axg_client[ 0 ], &axg_client[ 1 ], &xCtx, &ucWinner ), SNTPEX_SUCCESS );
+  CHECK_EQ( ucWinner, 1 );
+  CHECK_NEAR( prv_offset_error( &xCtx, pxServer6 ), -( int64_t )( TEST_SPAWN_LATENCY / 2u ), 2 );
+
+  /* The late reply of the other family is not taken by the next race */
+  sntpex_mock_advance( 30000u );
+  CHECK_EQ( sntpex_client_dual_stack_timestamp_get( &axg_client[ 0 ], &axg_client[ 1 ], &xCtx, &ucWinner ), SNTPEX_SUCCESS );
+  CHECK_EQ( ucWinner, 1 );
+  CHECK_NEAR( prv_offset_error( &xCtx, pxServer6 ), -( int64_t )( TEST_SPAWN_LATENCY / 2u ), 2 );
+
+#if ( exlibSNTP_CONFIG_FILTER == 1 )
+  {
+    /* Both replies arrive in the same pass, the alternate one has the lower delay : the preferred
+     * client is fed once, with its own reply */
+    uint8_t ucFilterHead = axg_client[ 0 ].xFilter.head;
+
+    sntpex_mock_advance( 30000u );
+    pxServer4->latencyUs    = 2000u;
+    pxServer4->processingUs = 0u;
+    pxServer6->latencyUs    = 1900u;
+    pxServer6->processingUs = 200u;
+
+    CHECK_EQ( sntpex_client_dual_stack_timestamp_get( &axg_client[ 0 ], &axg_client[ 1 ], &xCtx, &ucWinner ), SNTPEX_SUCCESS );
+    CHECK_EQ( ucWinner, 1 );
+    CHECK_EQ( ( axg_client[ 0 ].xFilter.head + exlibSNTP_FILTER_SIZE - ucFilterHead ) % exlibSNTP_FILTER_SIZE, 1 );
+  }
+#endif
+
+  sntpex_client_deinitialization( &axg_client[ 0 ] );
+  sntpex_client_deinitialization( &axg_client[ 1 ] );
+}
+#endif
+
+#if ( exlibSNTP_CONFIG_TIMER_WHEEL == 1 )
+/* Completion callback of the timer wheel requests */
+static void prv_request_done( sntpex_client_handle_t * p_client, sntp_ud_t xStatus )
+{
+  axg_status[ ( p_client == &axg_client[ 1 ] ) ? 1 : 0 ] = xStatus;
+  ucg_completed++;
+}
+
+/* The wheel steps the clients woken up by the Spawn events of their own socket */
+static void test_modes_timer_wheel( void )
+{
+  struct xSntpTimerWheel_t   xWheel;
+  struct xTimestampCtx_t     axCtx[ 2 ];
+  struct xSntpMockServer_t * apxServer[ 2 ];
+  uint32_t                   ulSteps = 0;
+  uint8_t                    ucIndex;
+
+  prv_modes_setup( 23 );
+
+  apxServer[ 0 ] = sntpex_mock_server_add_v4( 0x0A000001u );
+  apxServer[ 1 ] = sntpex_mock_server_add_v4( 0x0A000002u );
+  /* The reply of the second client arrives first, while the first one waits for its own */
+  apxServer[ 0 ]->latencyUs = 9000u;
+  apxServer[ 0 ]->offsetUs  = 60000;
+  apxServer[ 1 ]->latencyUs = 4000u;
+  apxServer[ 1 ]->offsetUs  = 500;
+
+  ( void )sntpex_timer_wheel_init( &xWheel, xg_vtable.get_os_tick() );
+  ucg_completed = 0;
+
+  for( ucIndex = 0; ucIndex < 2u; ucIndex++ )
+  {
+    prv_client_start( &axg_client[ ucIndex ], apxServer[ ucIndex ] );
+    axg_status[ ucIndex ] = SNTPEX_PENDING;
+    CHECK_EQ( sntpex_client_wheel_start( &axg_client[ ucIndex ], &xWheel, &axCtx[ ucIndex ] ), SNTPEX_PENDING );
+  }
+
+  while( ( ucg_completed < 2u ) && ( ulSteps < TEST_MAX_STEPS ) )
+  {
+    sntpex_mock_advance( TEST_STEP_PERIOD );
+    ( void )sntpex_timer_wheel_poll( &xWheel, xg_vtable.get_os_tick(), prv_request_done );
+    ulSteps++;
+  }
+
+  CHECK_EQ( ucg_completed, 2 );
+  CHECK_EQ( xWheel.armedCount, 0 );
+
+  for( ucIndex = 0; ucIndex < 2u; ucIndex++ )
+  {
+    CHECK_EQ( axg_status[ ucIndex ], SNTPEX_SUCCESS );
+    CHECK_NEAR( prv_offset_error( &axCtx[ ucIndex ], apxServer[ ucIndex ] ), -( int64_t )( TEST_SPAWN_LATENCY / 2u ), 2 );
+    sntpex_client_deinitialization( &axg_client[ ucIndex ] );
+  }
+}
+#endif
+
+#if ( exlibSNTP_CONFIG_RESPONDER == 1 )
+/* Receive time (T2) of the last reply of the responder to a host, 64-UNIX time in us */
+static uint64_t prv_answer_receive_time( const struct xSntpMockServer_t * pxPeer )
+{
+  struct xSntpPacket_t xPacket;
+
+  if( sntpex_packet_decode( pxPeer->answer, exlibSNTP_PACKET_HEADER_SIZE, &xPacket ) != SNTPEX_SUCCESS )
+  {
+    return 0;
+  }
+
+  return sntpex_ntp_to_unix64_us( xPacket.receiveTimestamp.seconds, xPacket.receiveTimestamp.fraction );
+}
+
+/* The responder answers back-to-back requests while its upstream client has a request in flight */
+static void test_modes_responder( void )
+{
+  struct xTimestampCtx_t     xCtx;
+  struct xSntpMockServer_t * pxServer;
+  struct xSntpMockServer_t * pxPeer;
+  uint64_t                   aullArrival[ 2 ];
+  sntp_ud_t                  xStatus = SNTPEX_PENDING;
+  uint32_t                   ulSteps = 0;
+  uint8_t                    ucIndex;
+
+  prv_modes_setup( 24 );
+  sntpex_mock_clock_set( -300000, 0 );
+
+  /* Upstream server on the true time, LAN host 1 ms away */
+  pxServer = sntpex_mock_server_add_v4( 0x0A000001u );
+  pxPeer   = sntpex_mock_server_add_v4( 0xC0A80164u );
+  pxServer->latencyUs = 8000u;
+  pxPeer->latencyUs   = 1000u;
+
+  /* The upstream client is synchronized first */
+  prv_client_start( &axg_client[ 0 ], pxServer );
+
+  do
+  {
+    xStatus = sntpex_client_step( &axg_client[ 0 ], &xCtx );
+    sntpex_mock_advance( TEST_STEP_PERIOD );
+    ulSteps++;
+  }
+  while( ( xStatus == SNTPEX_PENDING ) && ( ulSteps < TEST_MAX_STEPS ) );
+
+  CHECK_EQ( xStatus, SNTPEX_SUCCESS );
+
+  prv_client_start( &axg_client[ 1 ], pxServer );
+  CHECK_EQ( sntpex_client_responder_start( &axg_client[ 1 ], &axg_client[ 0 ], SLNETSOCK_AF_INET ), SNTPEX_SUCCESS );
+
+  /* Next upstream request in flight, two host requests queued 500 us apart before the responder runs */
+  CHECK_EQ( sntpex_client_step( &axg_client[ 0 ], &xCtx ), SNTPEX_PENDING );
+  aullArrival[ 0 ] = sntpex_mock_peer_request( pxPeer );
+  sntpex_mock_advance( 500u );
+  aullArrival[ 1 ] = sntpex_mock_peer_request( pxPeer );
+  sntpex_mock_advance( 2000u );
+
+  /* Event of a request dropped by the stack, left without its datagram */
+  CHECK_EQ( sntpex_eventTriggingFromISR( ( int16_t )axg_client[ 1 ].sock->fd, exlibSNTP_SOFTSR_RECV_BIT ), SNTPEX_SUCCESS );
+
+  CHECK( aullArrival[ 0 ] != 0u );
+
+  for( ucIndex = 0; ucIndex < 2u; ucIndex++ )
+  {
+    /* T2 is the disciplined time of the Spawn event of this request */
+    CHECK_EQ( sntpex_client_responder_step( &axg_client[ 1 ] ), SNTPEX_SUCCESS );
+    CHECK_EQ( pxPeer->answers, ucIndex + 1u );
+    CHECK_NEAR( ( int64_t )( prv_answer_receive_time( pxPeer ) - aullArrival[ ucIndex ] ), TEST_SPAWN_LATENCY, 20 );
+  }
+
+  CHECK_EQ( sntpex_client_responder_step( &axg_client[ 1 ] ), SNTPEX_PENDING );
+
+  /* A later request takes its own event, not the one left by the dropped request */
+  sntpex_mock_advance( 3000u );
+  aullArrival[ 0 ] = sntpex_mock_peer_request( pxPeer );
+  sntpex_mock_advance( 2000u );
+  CHECK_EQ( sntpex_client_responder_step( &axg_client[ 1 ] ), SNTPEX_SUCCESS );
+  CHECK_NEAR( ( int64_t )( prv_answer_receive_time( pxPeer ) - aullArrival[ 0 ] ), TEST_SPAWN_LATENCY, 20 );
+
+  /* The reply of the upstream request kept its own T4 */
+  ulSteps = 0;
+
+  do
+  {
+    xStatus = sntpex_client_step( &axg_client[ 0 ], &xCtx );
+    sntpex_mock_advance( TEST_STEP_PERIOD );
+    ulSteps++;
+  }
+  while( ( xStatus == SNTPEX_PENDING ) && ( ulSteps < TEST_MAX_STEPS ) );
+
+  CHECK_EQ( xStatus, SNTPEX_SUCCESS );
+  CHECK_NEAR( prv_offset_error( &xCtx, pxServer ), -( int64_t )( TEST_SPAWN_LATENCY / 2u ), 2 );
+
+  CHECK_EQ( sntpex_client_responder_stop( &axg_client[ 1 ] ), SNTPEX_SUCCESS );
+
+#if ( exlibSNTP_CONFIG_IPV6 == 1 )
+  {
+    /* The responder started on the IPV6 family answers the IPV6 hosts */
+    static const uint8_t       aucAddress6[ 16 ] = { 0xFD, 0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x64 };
+    struct xSntpMockServer_t * pxPeer6 = sntpex_mock_server_add_v6( aucAddress6 );
+
+    pxPeer6->latencyUs = 1000u;
+
+    CHECK_EQ( sntpex_client_responder_start( &axg_client[ 1 ], &axg_client[ 0 ], SLNETSOCK_AF_INET6 ), SNTPEX_SUCCESS );
+    CHECK_EQ( sntpex_mock_peer_request( pxPeer ), 0u );
+
+    aullArrival[ 0 ] = sntpex_mock_peer_request( pxPeer6 );
+    sntpex_mock_advance( 2000u );
+    CHECK( aullArrival[ 0 ] != 0u );
+    CHECK_EQ( sntpex_client_responder_step( &axg_client[ 1 ] ), SNTPEX_SUCCESS );
+    CHECK_EQ( pxPeer6->answers, 1 );
+    CHECK_NEAR( ( int64_t )( prv_answer_receive_time( pxPeer6 ) - aullArrival[ 0 ] ), TEST_SPAWN_LATENCY, 20 );
+
+    CHECK_EQ( sntpex_client_responder_stop( &axg_client[ 1 ] ), SNTPEX_SUCCESS );
+  }
+#endif
+  sntpex_client_deinitialization( &axg_client[ 1 ] );
+  sntpex_client_deinitialization( &axg_client[ 0 ] );
+}
+#endif
+
+#if ( exlibSNTP_CONFIG_BROADCAST == 1 )
+/* Every broadcast takes the Spawn event of its own arrival, also when they are read back-to-back */
+static void test_modes_broadcast( void )
+{
+  struct xTimestampCtx_t     xCtx;
+  struct xSntpMockServer_t * pxServer;
+  uint8_t                    ucIndex;
+
+  prv_modes_setup( 25 );
+  sntpex_mock_clock_set( 700000, 0 );
+
+  pxServer = sntpex_mock_server_add_v4( 0x0A000001u );
+  pxServer->latencyUs = 6000u;
+  pxServer->offsetUs  = -1500;
+
+  /* The delay is calibrated on the driver timestamps, the broadcasts on the Spawn ones */
+  sntpex_mock_timestamp_mode_set( SNTPEX_MOCK_TS_DRIVER, sntpex_eventTriggingFromISR, TEST_SPAWN_LATENCY );
+  prv_client_start( &axg_client[ 0 ], pxServer );
+  CHECK_EQ( sntpex_client_broadcast_calibrate( &axg_client[ 0 ], &xCtx ), SNTPEX_SUCCESS );
+
+  sntpex_mock_timestamp_mode_set( SNTPEX_MOCK_TS_SPAWN, sntpex_eventTriggingFromISR, TEST_SPAWN_LATENCY );
+  CHECK_EQ( sntpex_client_broadcast_listen( &axg_client[ 0 ], NULL ), SNTPEX_SUCCESS );
+  CHECK_EQ( sntpex_client_broadcast_step( &axg_client[ 0 ], &xCtx ), SNTPEX_PENDING );
+
+  /* Two broadcasts 1 ms apart, then a single one after the events of the first ones are consumed */
+  CHECK( sntpex_mock_broadcast_send( pxServer ) != 0u );
+  sntpex_mock_advance( 1000u );
+  CHECK( sntpex_mock_broadcast_send( pxServer ) != 0u );
+  sntpex_mock_advance( 10000u );
+
+  /* Event of a broadcast dropped by the stack, left without its datagram */
+  CHECK_EQ( sntpex_eventTriggingFromISR( ( int16_t )axg_client[ 0 ].sock->fd, exlibSNTP_SOFTSR_RECV_BIT ), SNTPEX_SUCCESS );
+
+  for( ucIndex = 0; ucIndex < 3u; ucIndex++ )
+  {
+    if( ucIndex == 2u )
+    {
+      sntpex_mock_advance( 1000000u );
+      CHECK( sntpex_mock_broadcast_send( pxServer ) != 0u );
+      sntpex_mock_advance( 10000u );
+    }
+
+    /* The Spawn latency delays T4, the whole of it biases the offset of the synthesized exchange */
+    CHECK_EQ( sntpex_client_broadcast_step( &axg_client[ 0 ], &xCtx ), SNTPEX_SUCCESS );
+    CHECK_EQ( sntpex_client_rx_timestamp_source_get( &axg_client[ 0 ] ), SNTPEX_TS_SOURCE_SPAWN );
+    CHECK_NEAR( xCtx.reference64_ts - xCtx.originate64_ts, 2u * pxServer->latencyUs, 2 );
+    CHECK_NEAR( prv_offset_error( &xCtx, pxServer ), -( int64_t )TEST_SPAWN_LATENCY, 2 );
+  }
+
+  CHECK_EQ( sntpex_client_broadcast_step( &axg_client[ 0 ], &xCtx ), SNTPEX_PENDING );
+  CHECK_EQ( sntpex_client_broadcast_stop( &axg_client[ 0 ] ), SNTPEX_SUCCESS );
+  sntpex_client_deinitialization( &axg_client[ 0 ] );
+}
+#endif
+
+#if ( exlibSNTP_CONFIG_FAST_NOW == 1 )
+/* The fast time follows the attached client, until the client is released */
+static void test_modes_now( void )
+{
+  struct xTimestampCtx_t     xCtx;
+  struct xSntpMockServer_t * pxServer;
+  uint64_t                   ullTime = 0;
+
+  prv_modes_setup( 26 );
+  sntpex_mock_timestamp_mode_set( SNTPEX_MOCK_TS_DRIVER, NULL, 0 );
+  sntpex_mock_clock_set( -900000, 0 );
+
+  pxServer = sntpex_mock_server_add_v4( 0x0A000001u );
+  prv_client_start( &axg_client[ 0 ], pxServer );
+
+  CHECK_EQ( sntpex_now(), 0 );
+  CHECK_EQ( sntpex_now_attach( &axg_client[ 0 ], NULL ), SNTPEX_SUCCESS );
+
+  /* Not disciplined yet, the raw local time is returned */
+  CHECK_NEAR( ( int64_t )( sntpex_now() - sntpex_mock_local_time() ), 0, 1 );
+
+  CHECK_EQ( sntpex_client_timestamp_get( &axg_client[ 0 ], &xCtx ), SNTPEX_SUCCESS );
+  sntpex_mock_advance( 1000000u );
+
+  CHECK_EQ( sntpex_client_time_get( &axg_client[ 0 ], &ullTime ), SNTPEX_SUCCESS );
+  CHECK_NEAR( ( int64_t )( sntpex_now() - ullTime ), 0, 3 );
+  CHECK_NEAR( ( int64_t )( sntpex_now() - sntpex_mock_true_time() ), 0, 10 );
+
+  /* A client initialized again is released from the fast time */
+  CHECK_EQ( sntpex_clientInitialization( &axg_client[ 0 ], &xg_vtable ), SNTPEX_SUCCESS );
+  CHECK_EQ( sntpex_now(), 0 );
+  CHECK_EQ( sntpex_now_detach( &axg_client[ 0 ] ), SNTPEX_ERROR );
+
+  sntpex_client_deinitialization( &axg_client[ 0 ] );
+}
+#endif
+
+/* Exported function   ------------------------------------------------------------*/
+
+int main( void )
+{
+  RUN( test_modes_spawn_steps );
+#if ( exlibSNTP_CONFIG_IPV6 == 1 )
+  RUN( test_modes_dual_stack );
+#endif
+#if ( exlibSNTP_CONFIG_TIMER_WHEEL == 1 )
+  RUN( test_modes_timer_wheel );
+#endif
+#if ( exlibSNTP_CONFIG_RESPONDER == 1 )
+  RUN( test_modes_responder );
+#endif
+#if ( exlibSNTP_CONFIG_BROADCAST == 1 )
+  RUN( test_modes_broadcast );
+#endif
+#if ( exlibSNTP_CONFIG_FAST_NOW == 1 )
+  RUN( test_modes_now );
+#endif
+
+  return TEST_RESULT();
+}
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
@@ -0,0 +1,187 @@
+/**
+ * @file    sntpex_ti/tests/test_packet.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Host tests of the time message codec, of the trailer parser, of the sample computation
+ *          and of the NTP / UNIX time conversions.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Oct 14, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntpex_test.h"
+
+/* Private function   ------------------------------------------------------------*/
+
+static void test_codec_roundtrip( void )
+{
+  struct xSntpPacket_t xPacket = { 0, };
+  struct xSntpPacket_t xDecoded;
+  uint8_t              aucBuffer[ exlibSNTP_PACKET_HEADER_SIZE ];
+  uint16_t             usLength = 0;
+
+  xPacket.li                          = specNTP_LI_LAST_MIN_61;
+  xPacket.vn                          = specNTP_VERSION_V4;
+  xPacket.mode                        = specNTP_MODE_SERVER;
+  xPacket.stratum                     = 2;
+  xPacket.poll                        = 6;
+  xPacket.precision                   = -20;
+  xPacket.rootDelay                   = 0x00010203u;
+  xPacket.rootDispersion              = 0x04050607u;
+  xPacket.referenceId                 = 0x47505300u;
+  xPacket.originateTimestamp.seconds  = 0xE0000001u;
+  xPacket.originateTimestamp.fraction = 0x80000000u;
+  xPacket.transmitTimestamp.seconds   = 0xE0000002u;
+  xPacket.transmitTimestamp.fraction  = 0x00000001u;
+
+  CHECK_EQ( sntpex_packet_encode( &xPacket, aucBuffer, sizeof( aucBuffer ), &usLength ), SNTPEX_SUCCESS );
+  CHECK_EQ( usLength, exlibSNTP_PACKET_HEADER_SIZE );
+
+  /* Big-endian layout, flags byte LI VN Mode */
+  CHECK_EQ( aucBuffer[ exlibSNTP_PKT_OFFSET_FLAGS ], ( 1u << 6 ) | ( 4u << 3 ) | 4u );
+  CHECK_EQ( aucBuffer[ exlibSNTP_PKT_OFFSET_PRECISION ], 0xECu );
+  CHECK_EQ( aucBuffer[ exlibSNTP_PKT_OFFSET_ROOT_DELAY + 3u ], 0x03u );
+  CHECK_EQ( aucBuffer[ exlibSNTP_PKT_OFFSET_ORIG_TS ], 0xE0u );
+  CHECK_EQ( aucBuffer[ exlibSNTP_PKT_OFFSET_ORIG_TS + 4u ], 0x80u );
+  CHECK_EQ( aucBuffer[ exlibSNTP_PKT_OFFSET_XMIT_TS + 7u ], 0x01u );
+
+  CHECK_EQ( sntpex_packet_decode( aucBuffer, usLength, &xDecoded ), SNTPEX_SUCCESS );
+  CHECK_EQ( xDecoded.li, xPacket.li );
+  CHECK_EQ( xDecoded.vn, xPacket.vn );
+  CHECK_EQ( xDecoded.mode, xPacket.mode );
+  CHECK_EQ( xDecoded.stratum, xPacket.stratum );
+  CHECK_EQ( xDecoded.poll, xPacket.poll );
+  CHECK_EQ( xDecoded.precision, xPacket.precision );
+  CHECK_EQ( xDecoded.rootDelay, xPacket.rootDelay );
+  CHECK_EQ( xDecoded.rootDispersion, xPacket.rootDispersion );
+  CHECK_EQ( xDecoded.referenceId, xPacket.referenceId );
+  CHECK_EQ( xDecoded.originateTimestamp.seconds, xPacket.originateTimestamp.seconds );
+  CHECK_EQ( xDecoded.originateTimestamp.fraction, xPacket.originateTimestamp.fraction );
+  CHECK_EQ( xDecoded.transmitTimestamp.seconds, xPacket.transmitTimestamp.seconds );
+  CHECK_EQ( xDecoded.transmitTimestamp.fraction, xPacket.transmitTimestamp.fraction );
+
+  /* Short buffers */
+  CHECK( sntpex_packet_encode( &xPacket, aucBuffer, exlibSNTP_PACKET_HEADER_SIZE - 1u, &usLength ) != SNTPEX_SUCCESS );
+  CHECK_EQ( sntpex_packet_decode( aucBuffer, exlibSNTP_PACKET_HEADER_SIZE - 1u, &xDecoded ), SNTPEX_ERR_INVALID_MESSAGE );
+  CHECK_EQ( sntpex_packet_decode( NULL, usLength, &xDecoded ), SNTPEX_ERR_NULL_PTR );
+}
+
+static void test_trailer( void )
+{
+  struct xSntpTrailer_t xTrailer;
+  uint8_t               aucBuffer[ exlibSNTP_TIME_MESSAGE_MAX_SIZE ] = { 0, };
+
+  /* Header only */
+  CHECK_EQ( sntpex_packet_trailer_parse( aucBuffer, exlibSNTP_PACKET_HEADER_SIZE, &xTrailer ), SNTPEX_SUCCESS );
+  CHECK_EQ( xTrailer.macOffset, 0 );
+  CHECK_EQ( xTrailer.extCount, 0 );
+
+  /* crypto-NAK, Key Identifier alone */
+  CHECK_EQ( sntpex_packet_trailer_parse( aucBuffer, exlibSNTP_PACKET_HEADER_SIZE + 4u, &xTrailer ), SNTPEX_SUCCESS );
+  CHECK_EQ( xTrailer.macOffset, exlibSNTP_PACKET_HEADER_SIZE );
+  CHECK_EQ( xTrailer.macLength, 0 );
+  CHECK_EQ( xTrailer.keyId, 0 );
+
+  /* Key Identifier and MD5 digest */
+  aucBuffer[ 48 ] = 0x00u;
+  aucBuffer[ 49 ] = 0x00u;
+  aucBuffer[ 50 ] = 0x01u;
+  aucBuffer[ 51 ] = 0x02u;
+  CHECK_EQ( sntpex_packet_trailer_parse( aucBuffer, exlibSNTP_PACKET_HEADER_SIZE + 20u, &xTrailer ), SNTPEX_SUCCESS );
+  CHECK_EQ( xTrailer.macLength, 16 );
+  CHECK_EQ( xTrailer.keyId, 0x0102u );
+
+  /* One 28 bytes extension field, then a SHA1 MAC */
+  ( void )memset( &aucBuffer[ 48 ], 0, sizeof( aucBuffer ) - 48u );
+  aucBuffer[ 51 ] = 28u;
+  aucBuffer[ 76 ] = 0x12u;
+  CHECK_EQ( sntpex_packet_trailer_parse( aucBuffer, exlibSNTP_PACKET_HEADER_SIZE + 28u + 24u, &xTrailer ), SNTPEX_SUCCESS );
+  CHECK_EQ( xTrailer.extCount, 1 );
+  CHECK_EQ( xTrailer.extLength, 28 );
+  CHECK_EQ( xTrailer.macOffset, exlibSNTP_PACKET_HEADER_SIZE + 28u );
+  CHECK_EQ( xTrailer.macLength, 20 );
+  CHECK_EQ( xTrailer.keyId, 0x12000000u );
+
+  /* Last extension field of a packet without MAC shorter than 28 bytes */
+  aucBuffer[ 51 ] = 16u;
+  CHECK_EQ( sntpex_packet_trailer_parse( aucBuffer, exlibSNTP_PACKET_HEADER_SIZE + 16u, &xTrailer ), SNTPEX_ERR_INVALID_MESSAGE );
+
+  /* Field length not a multiple of 4, or longer than the packet */
+  aucBuffer[ 51 ] = 30u;
+  CHECK_EQ( sntpex_packet_trailer_parse( aucBuffer, exlibSNTP_PACKET_HEADER_SIZE + 32u, &xTrailer ), SNTPEX_ERR_INVALID_MESSAGE );
+  aucBuffer[ 51 ] = 64u;
+  CHECK_EQ( sntpex_packet_trailer_parse( aucBuffer, exlibSNTP_PACKET_HEADER_SIZE + 32u, &xTrailer ), SNTPEX_ERR_INVALID_MESSAGE );
+}
+
+static void test_sample_compute( void )
+{
+  struct xTimestampCtx_t xCtx = { 0, };
+  struct xSntpSample_t   xSample;
+
+  /* Server 1 s ahead, 10 ms each way, 1 ms of processing */
+  xCtx.originate64_ts = SNTPEX_MOCK_START_TIME;
+  xCtx.receive64_ts   = SNTPEX_MOCK_START_TIME + 1000000u + 10000u;
+  xCtx.transmit64_ts  = SNTPEX_MOCK_START_TIME + 1000000u + 11000u;
+  xCtx.reference64_ts = SNTPEX_MOCK_START_TIME + 21000u;
+
+  CHECK_EQ( sntpex_sample_compute( &xCtx, &xSample ), SNTPEX_SUCCESS );
+  CHECK_EQ( xSample.offset, 1000000 );
+  CHECK_EQ( xSample.delay, 20000 );
+  CHECK_EQ( xSample.epoch, xCtx.reference64_ts );
+
+  /* Asymmetric path, half of the asymmetry biases the offset */
+  xCtx.reference64_ts += 4000u;
+  CHECK_EQ( sntpex_sample_compute( &xCtx, &xSample ), SNTPEX_SUCCESS );
+  CHECK_EQ( xSample.offset, 1000000 - 2000 );
+  CHECK_EQ( xSample.delay, 24000 );
+
+  /* Negative delay of the clocks resolution is clamped */
+  xCtx.reference64_ts = SNTPEX_MOCK_START_TIME;
+  xCtx.receive64_ts   = SNTPEX_MOCK_START_TIME + 10u;
+  xCtx.transmit64_ts  = SNTPEX_MOCK_START_TIME + 20u;
+  CHECK_EQ( sntpex_sample_compute( &xCtx, &xSample ), SNTPEX_SUCCESS );
+  CHECK_EQ( xSample.delay, 0 );
+
+  /* Missing timestamp */
+  xCtx.transmit64_ts = 0;
+  CHECK_EQ( sntpex_sample_compute( &xCtx, &xSample ), SNTPEX_ERR_INVALID_MESSAGE );
+}
+
+static void test_conversions( void )
+{
+  NtpTimestamp xTimestamp;
+  uint64_t     ullTime = SNTPEX_MOCK_START_TIME + 123456u;
+
+  sntpex_unix64_us_to_ntp( ullTime, &xTimestamp );
+  CHECK_EQ( xTimestamp.seconds, 1767225600u + 2208988800u );
+  CHECK_NEAR( xTimestamp.fraction, ( uint32_t )( ( 123456ull << 32 ) / 1000000u ), 1 );
+
+  /* The us round trip is exact */
+  CHECK_EQ( sntpex_ntp_to_unix64_us( xTimestamp.seconds, xTimestamp.fraction ), ullTime );
+  CHECK_NEAR( sntpex_ntp_to_unix64_ns( xTimestamp.seconds, xTimestamp.fraction ), ullTime * 1000u, 1 );
+  CHECK_EQ( sntpex_ntp_to_ntp64( xTimestamp.seconds, xTimestamp.fraction ),
+            ( ( uint64_t )xTimestamp.seconds << 32 ) | xTimestamp.fraction );
+
+  /* Half a second */
+  CHECK_EQ( sntpex_ntp_to_unix64_us( 2208988800u, 0x80000000u ), 500000u );
+}
+
+/* Exported function   ------------------------------------------------------------*/
+
+int main( void )
+{
+  RUN( test_codec_roundtrip );
+  RUN( test_trailer );
+  RUN( test_sample_compute );
+  RUN( test_conversions );
+
+  return TEST_RESULT();
+}
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
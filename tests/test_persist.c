@@ -0,0 +1,159 @@
+/**
+ * @file    sntpex_ti/tests/test_persist.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Host tests of the warm-start persistence : record round trip, CRC-32 check and cold start.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Oct 14, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntpex_test.h"
+
+/* Private variables -------------------------------------------------------------*/
+static sntpex_client_handle_t xg_client;
+static sntpex_client_handle_t xg_restored;
+
+/* Private function   ------------------------------------------------------------*/
+
+/* Client with a filtered sample and a disciplined frequency, saved on the storage */
+static void prv_saved_client( void )
+{
+  struct ud_op_vtable  xVtable;
+  struct xSntpSample_t xSample = { 1500, 8000, 0 };
+
+  sntpex_mock_reset( 1 );
+  sntpex_mock_vtable_get( &xVtable );
+
+  ( void )sntpex_clientInitialization( &xg_client, &xVtable );
+
+  xSample.epoch = sntpex_mock_local_time();
+#if ( exlibSNTP_CONFIG_FILTER == 1 )
+  ( void )sntpex_filter_push( &xg_client.xFilter, &xSample );
+#else
+  xg_client.xLastSample = xSample;
+#endif
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 1 )
+  xg_client.xDiscipline.phase      = 1500;
+  xg_client.xDiscipline.freq       = -12345;
+  xg_client.xDiscipline.lastUpdate = xSample.epoch;
+  xg_client.xDiscipline.state      = SNTPEX_DISCIPLINE_SYNC;
+#endif
+#if ( exlibSNTP_CONFIG_POLL == 1 )
+  xg_client.xPoll.exponent = 9;
+#endif
+
+  CHECK_EQ( sntpex_client_state_save( &xg_client ), SNTPEX_SUCCESS );
+  CHECK( sntpex_mock_stats_get()->nvWrites > 0u );
+
+  sntpex_client_deinitialization( &xg_client );
+}
+
+static void prv_restored_client( void )
+{
+  struct ud_op_vtable xVtable;
+
+  sntpex_mock_vtable_get( &xVtable );
+  ( void )sntpex_clientInitialization( &xg_restored, &xVtable );
+}
+
+static void test_persist_roundtrip( void )
+{
+  prv_saved_client();
+
+  /* Warm start ten seconds later, the raw clock kept running */
+  sntpex_mock_advance( 10000000u );
+  prv_restored_client();
+
+  CHECK_EQ( sntpex_client_state_restore( &xg_restored ), SNTPEX_SUCCESS );
+#if ( exlibSNTP_CONFIG_FILTER == 1 )
+  CHECK_EQ( xg_restored.xFilter.count, 1 );
+  CHECK_EQ( xg_restored.xFilter.samples[ 0 ].offset, 1500 );
+#else
+  CHECK_EQ( xg_restored.xLastSample.offset, 1500 );
+#endif
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 1 )
+  CHECK_EQ( xg_restored.xDiscipline.state, SNTPEX_DISCIPLINE_SYNC );
+  CHECK_EQ( xg_restored.xDiscipline.freq, -12345 );
+  CHECK_EQ( xg_restored.xDiscipline.phase, 1500 );
+#endif
+#if ( exlibSNTP_CONFIG_POLL == 1 )
+  /* The exponent is kept, the next request is due at once */
+  CHECK_EQ( xg_restored.xPoll.exponent, 9 );
+  CHECK_EQ( xg_restored.xPoll.interval, 0 );
+#endif
+
+  sntpex_client_deinitialization( &xg_restored );
+}
+
+static void test_persist_corruption( void )
+{
+  prv_saved_client();
+
+  /* One flipped byte of the sections fails the CRC-32, the client state is not modified */
+  sntpex_mock_nv_corrupt( sizeof( struct xSntpPersistHeader_t ) + 3u );
+  prv_restored_client();
+
+  CHECK_EQ( sntpex_client_state_restore( &xg_restored ), SNTPEX_ERR_PERSIST );
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 1 )
+  CHECK_EQ( xg_restored.xDiscipline.freq, 0 );
+  CHECK_EQ( xg_restored.xDiscipline.state, SNTPEX_DISCIPLINE_UNSET );
+#endif
+  sntpex_client_deinitialization( &xg_restored );
+
+  /* Nothing saved */
+  sntpex_mock_reset( 2 );
+  prv_restored_client();
+  CHECK_EQ( sntpex_client_state_restore( &xg_restored ), SNTPEX_ERR_PERSIST );
+
+  /* Storage errors */
+  sntpex_mock_nv_fail_set( 1 );
+  CHECK_EQ( sntpex_client_state_save( &xg_restored ), SNTPEX_ERR_PERSIST );
+  CHECK_EQ( sntpex_client_state_restore( &xg_restored ), SNTPEX_ERR_PERSIST );
+
+  /* No storage */
+  xg_restored.vtable_api.nv_write = NULL;
+  CHECK_EQ( sntpex_client_state_save( &xg_restored ), SNTPEX_ERR_FAULT_INIT );
+
+  sntpex_client_deinitialization( &xg_restored );
+}
+
+static void test_persist_cold_start( void )
+{
+  prv_saved_client();
+
+  /* The raw clock restarted, its times are meaningless but the frequency is kept */
+  sntpex_mock_clock_epoch_set( 2 );
+  prv_restored_client();
+
+  CHECK_EQ( sntpex_client_state_restore( &xg_restored ), SNTPEX_SUCCESS );
+#if ( exlibSNTP_CONFIG_FILTER == 1 )
+  CHECK_EQ( xg_restored.xFilter.count, 0 );
+#endif
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 1 )
+  CHECK_EQ( xg_restored.xDiscipline.state, SNTPEX_DISCIPLINE_UNSET );
+  CHECK_EQ( xg_restored.xDiscipline.phase, 0 );
+  CHECK_EQ( xg_restored.xDiscipline.freq, -12345 );
+#endif
+
+  sntpex_client_deinitialization( &xg_restored );
+}
+
+/* Exported function   ------------------------------------------------------------*/
+
+int main( void )
+{
+  RUN( test_persist_roundtrip );
+  RUN( test_persist_corruption );
+  RUN( test_persist_cold_start );
+
+  return TEST_RESULT();
+}
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
@@ -0,0 +1,169 @@
+/**
+ * @file    sntpex_ti/tests/test_poll.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Host tests of the adaptive poll scheduler and of the Kiss-of-Death backoff.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Oct 14, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntpex_test.h"
+
+/* Private function   ------------------------------------------------------------*/
+
+static void test_poll_range( void )
+{
+  struct xSntpPoll_t xPoll;
+
+  CHECK_EQ( sntpex_poll_reset( &xPoll, 8, 6 ), SNTPEX_ERROR );
+  CHECK_EQ( sntpex_poll_reset( &xPoll, 6, exlibSNTP_POLL_KOD_MAX_EXPONENT + 1u ), SNTPEX_ERROR );
+  CHECK_EQ( sntpex_poll_reset( NULL, 6, 10 ), SNTPEX_ERR_NULL_PTR );
+  CHECK_EQ( sntpex_poll_reset( &xPoll, 6, 10 ), SNTPEX_SUCCESS );
+  CHECK_EQ( xPoll.exponent, 6 );
+}
+
+static void test_poll_hysteresis( void )
+{
+  struct xSntpPoll_t       xPoll;
+  struct xSntpDiscipline_t xDiscipline = { 0, };
+  uint8_t                  ucIndex;
+
+  ( void )sntpex_poll_reset( &xPoll, 6, 8 );
+
+  /* Frequency not estimated yet, the interval stays at the minimum */
+  xDiscipline.state = SNTPEX_DISCIPLINE_FREQ;
+
+  for( ucIndex = 0; ucIndex < 8u; ucIndex++ )
+  {
+    ( void )sntpex_poll_update( &xPoll, SNTPEX_SUCCESS, 0, 500, &xDiscipline, 0 );
+  }
+
+  CHECK_EQ( xPoll.exponent, 6 );
+  CHECK_EQ( xPoll.interval, 64000 );
+
+  /* Good predictions raise the exponent once per hysteresis count, up to the maximum */
+  xDiscipline.state    = SNTPEX_DISCIPLINE_SYNC;
+  xDiscipline.residual = 2000;
+
+  for( ucIndex = 0; ucIndex < ( exlibSNTP_POLL_HYSTERESIS - 1 ); ucIndex++ )
+  {
+    ( void )sntpex_poll_update( &xPoll, SNTPEX_SUCCESS, 0, 500, &xDiscipline, 0 );
+  }
+
+  CHECK_EQ( xPoll.exponent, 6 );
+  ( void )sntpex_poll_update( &xPoll, SNTPEX_SUCCESS, 0, 500, &xDiscipline, 0 );
+  CHECK_EQ( xPoll.exponent, 7 );
+
+  for( ucIndex = 0; ucIndex < ( 4 * exlibSNTP_POLL_HYSTERESIS ); ucIndex++ )
+  {
+    ( void )sntpex_poll_update( &xPoll, SNTPEX_SUCCESS, 0, 500, &xDiscipline, 0 );
+  }
+
+  CHECK_EQ( xPoll.exponent, 8 );
+  CHECK_EQ( xPoll.interval, 256000 );
+
+  /* Residuals beyond the jitter gate lower it, a bad prediction weights twice */
+  xDiscipline.residual = 50000;
+
+  for( ucIndex = 0; ucIndex < ( exlibSNTP_POLL_HYSTERESIS / 2 ); ucIndex++ )
+  {
+    ( void )sntpex_poll_update( &xPoll, SNTPEX_SUCCESS, 0, 500, &xDiscipline, 0 );
+  }
+
+  CHECK_EQ( xPoll.exponent, 7 );
+
+  /* An unstable frequency is a bad prediction too */
+  xDiscipline.residual = 0;
+  xDiscipline.freq     = 5000;
+  xPoll.counter        = 0;
+  ( void )sntpex_poll_update( &xPoll, SNTPEX_SUCCESS, 0, 500, &xDiscipline, 0 );
+  CHECK_EQ( xPoll.counter, -2 );
+}
+
+static void test_poll_kiss_of_death( void )
+{
+  struct xSntpPoll_t       xPoll;
+  struct xSntpDiscipline_t xDiscipline = { 0, };
+
+  ( void )sntpex_poll_reset( &xPoll, 6, 10 );
+
+  /* RATE doubles the interval on every kiss */
+  ( void )sntpex_poll_update( &xPoll, SNTPEX_ERR_REQUEST_REJECTED, exlibSNTP_KOD_RATE, 0, &xDiscipline, 1000 );
+  CHECK_EQ( xPoll.interval, 128000 );
+  ( void )sntpex_poll_update( &xPoll, SNTPEX_ERR_REQUEST_REJECTED, exlibSNTP_KOD_RATE, 0, &xDiscipline, 1000 );
+  CHECK_EQ( xPoll.interval, 256000 );
+
+  /* The server poll of the kiss is honoured */
+  xPoll.serverPoll = 12;
+  ( void )sntpex_poll_update( &xPoll, SNTPEX_ERR_REQUEST_REJECTED, exlibSNTP_KOD_RATE, 0, &xDiscipline, 1000 );
+  CHECK_EQ( xPoll.interval, ( 1u << 12 ) * 1000u );
+
+  /* A reply clears the backoff */
+  xPoll.serverPoll = 0;
+  ( void )sntpex_poll_update( &xPoll, SNTPEX_SUCCESS, 0, 0, &xDiscipline, 1000 );
+  CHECK_EQ( xPoll.backoff, 0 );
+  CHECK_EQ( xPoll.interval, 64000 );
+
+  /* DENY jumps to the maximum, never beyond the os tick range */
+  ( void )sntpex_poll_update( &xPoll, SNTPEX_ERR_REQUEST_REJECTED, exlibSNTP_KOD_DENY, 0, &xDiscipline, 1000 );
+  CHECK_EQ( xPoll.exponent, 10 );
+  CHECK_EQ( xPoll.interval, ( 1u << 11 ) * 1000u );
+
+  uint8_t ucIndex;
+
+  for( ucIndex = 0; ucIndex < 20u; ucIndex++ )
+  {
+    ( void )sntpex_poll_update( &xPoll, SNTPEX_ERR_REQUEST_REJECTED, exlibSNTP_KOD_DENY, 0, &xDiscipline, 1000 );
+  }
+
+  CHECK_EQ( xPoll.interval, ( 1u << exlibSNTP_POLL_KOD_MAX_EXPONENT ) * 1000u );
+
+  /* Time until the next request, across the os tick wrap */
+  xPoll.lastRequest = 0xFFFFF000u;
+  xPoll.interval    = 0x2000u;
+  CHECK_EQ( sntpex_poll_time_until_next( &xPoll, 0x00000800u ), 0x0800u );
+  CHECK_EQ( sntpex_poll_time_until_next( &xPoll, 0x00002000u ), 0u );
+}
+
+static void test_poll_loss( void )
+{
+  struct xSntpPoll_t       xPoll;
+  struct xSntpDiscipline_t xDiscipline = { 0, };
+
+  ( void )sntpex_poll_reset( &xPoll, 4, 10 );
+  xPoll.exponent = 7;
+
+  /* A lost request is retried from the minimum interval, up to the current one */
+  ( void )sntpex_poll_update( &xPoll, SNTPEX_ERR_TIMEOUT, 0, 0, &xDiscipline, 0 );
+  CHECK_EQ( xPoll.interval, 16000 );
+  ( void )sntpex_poll_update( &xPoll, SNTPEX_ERR_TIMEOUT, 0, 0, &xDiscipline, 0 );
+  CHECK_EQ( xPoll.interval, 32000 );
+  ( void )sntpex_poll_update( &xPoll, SNTPEX_ERR_TIMEOUT, 0, 0, &xDiscipline, 0 );
+  CHECK_EQ( xPoll.interval, 64000 );
+  ( void )sntpex_poll_update( &xPoll, SNTPEX_ERR_TIMEOUT, 0, 0, &xDiscipline, 0 );
+  CHECK_EQ( xPoll.interval, 128000 );
+  ( void )sntpex_poll_update( &xPoll, SNTPEX_ERR_TIMEOUT, 0, 0, &xDiscipline, 0 );
+  CHECK_EQ( xPoll.interval, 128000 );
+  CHECK_EQ( xPoll.exponent, 7 );
+}
+
+/* Exported function   ------------------------------------------------------------*/
+
+int main( void )
+{
+  RUN( test_poll_range );
+  RUN( test_poll_hysteresis );
+  RUN( test_poll_kiss_of_death );
+  RUN( test_poll_loss );
+
+  return TEST_RESULT();
+}
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
@@ -0,0 +1,114 @@
+/**
+ * @file    sntpex_ti/tests/test_select.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Host tests of the servers selection and combining.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Oct 14, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntpex_test.h"
+
+/* Private function   ------------------------------------------------------------*/
+
+/* Timestamp list of a server with the given offset and delay, no root distance */
+static void prv_ctx( struct xTimestampCtx_t * pxCtx, int64_t llOffset, int64_t llDelay, uint8_t ucStratum )
+{
+  ( void )memset( pxCtx, 0, sizeof( struct xTimestampCtx_t ) );
+
+  pxCtx->originate64_ts = SNTPEX_MOCK_START_TIME;
+  pxCtx->receive64_ts   = ( uint64_t )( ( int64_t )SNTPEX_MOCK_START_TIME + llOffset + ( llDelay / 2 ) );
+  pxCtx->transmit64_ts  = pxCtx->receive64_ts;
+  pxCtx->reference64_ts = SNTPEX_MOCK_START_TIME + ( uint64_t )llDelay;
+  pxCtx->server.stratum = ucStratum;
+}
+
+static void test_select_falseticker( void )
+{
+  struct xTimestampCtx_t axCtx[ 3 ];
+  sntp_ud_t              axStatus[ 3 ] = { SNTPEX_SUCCESS, SNTPEX_SUCCESS, SNTPEX_SUCCESS };
+  struct xSntpSample_t   xResult;
+  uint8_t                ucSurvivors = 0;
+
+  prv_ctx( &axCtx[ 0 ], 1000,    4000, 2 );
+  prv_ctx( &axCtx[ 1 ], 1400,    4000, 2 );
+  prv_ctx( &axCtx[ 2 ], 5000000, 4000, 1 );
+
+  CHECK_EQ( sntpex_select_combine( axCtx, axStatus, 3, &xResult, &ucSurvivors ), SNTPEX_SUCCESS );
+  CHECK_EQ( ucSurvivors, 0x03 );
+
+  /* Equal distances, the survivors are averaged */
+  CHECK_NEAR( xResult.offset, 1200, 1 );
+  CHECK_EQ( xResult.delay, 4000 );
+}
+
+static void test_select_weights( void )
+{
+  struct xTimestampCtx_t axCtx[ 2 ];
+  sntp_ud_t              axStatus[ 2 ] = { SNTPEX_SUCCESS, SNTPEX_SUCCESS };
+  struct xSntpSample_t   xResult;
+
+  /* The closest server weighs more */
+  prv_ctx( &axCtx[ 0 ], 0,    2000,  1 );
+  prv_ctx( &axCtx[ 1 ], 6000, 20000, 3 );
+
+  CHECK_EQ( sntpex_select_combine( axCtx, axStatus, 2, &xResult, NULL ), SNTPEX_SUCCESS );
+  CHECK( xResult.offset > 0 );
+  CHECK( xResult.offset < 3000 );
+  CHECK_EQ( xResult.delay, 2000 );
+}
+
+static void test_select_no_majority( void )
+{
+  struct xTimestampCtx_t axCtx[ 2 ];
+  sntp_ud_t              axStatus[ 2 ] = { SNTPEX_SUCCESS, SNTPEX_SUCCESS };
+  struct xSntpSample_t   xResult;
+
+  /* Two disjoint intervals, none of them is a majority */
+  prv_ctx( &axCtx[ 0 ], 0,       2000, 2 );
+  prv_ctx( &axCtx[ 1 ], 1000000, 2000, 2 );
+
+  CHECK_EQ( sntpex_select_combine( axCtx, axStatus, 2, &xResult, NULL ), SNTPEX_ERROR );
+}
+
+static void test_select_candidates( void )
+{
+  struct xTimestampCtx_t axCtx[ 3 ];
+  sntp_ud_t              axStatus[ 3 ] = { SNTPEX_ERR_TIMEOUT, SNTPEX_SUCCESS, SNTPEX_SUCCESS };
+  struct xSntpSample_t   xResult;
+  uint8_t                ucSurvivors = 0;
+
+  /* Lost reply, unsynchronized server, only the last server is a candidate */
+  prv_ctx( &axCtx[ 0 ], 0,   2000, 2 );
+  prv_ctx( &axCtx[ 1 ], 0,   2000, specNTP_STRATUM_UNSYNC );
+  prv_ctx( &axCtx[ 2 ], 700, 2000, 2 );
+
+  CHECK_EQ( sntpex_select_combine( axCtx, axStatus, 3, &xResult, &ucSurvivors ), SNTPEX_SUCCESS );
+  CHECK_EQ( ucSurvivors, 0x04 );
+  CHECK_EQ( xResult.offset, 700 );
+
+  /* No candidate */
+  axStatus[ 2 ] = SNTPEX_ERR_TIMEOUT;
+  CHECK_EQ( sntpex_select_combine( axCtx, axStatus, 3, &xResult, NULL ), SNTPEX_ERROR );
+}
+
+/* Exported function   ------------------------------------------------------------*/
+
+int main( void )
+{
+  RUN( test_select_falseticker );
+  RUN( test_select_weights );
+  RUN( test_select_no_majority );
+  RUN( test_select_candidates );
+
+  return TEST_RESULT();
+}
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
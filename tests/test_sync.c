@@ -0,0 +1,425 @@
+/**
+ * @file    sntpex_ti/tests/test_sync.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Host tests of the client requests on the simulated network : blocking, step and burst
+ *          requests, loss, Kiss-of-Death and unsynchronized replies, busy socket, Spawn timestamps,
+ *          multi-server query, name resolution and clock discipline.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Oct 14, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntpex_test.h"
+
+/* Private variables -------------------------------------------------------------*/
+static sntpex_client_handle_t xg_client;
+static struct ud_op_vtable    xg_vtable;
+
+/* Private function   ------------------------------------------------------------*/
+
+/* Fresh simulation, one server at 10.0.0.1 with a 10 ms path, and a client on it */
+static struct xSntpMockServer_t * prv_client_setup( uint64_t ullSeed )
+{
+  sntpex_sockaddr_t xAddress;
+
+  sntpex_mock_reset( ullSeed );
+  sntpex_mock_vtable_get( &xg_vtable );
+
+  struct xSntpMockServer_t * pxServer = sntpex_mock_server_add_v4( 0x0A000001u );
+
+  pxServer->latencyUs = 10000u;
+  sntpex_mock_server_sockaddr( pxServer, &xAddress );
+
+  ( void )memset( &xg_client, 0, sizeof( xg_client ) );
+  CHECK_EQ( sntpex_clientInitialization( &xg_client, &xg_vtable ), SNTPEX_SUCCESS );
+  CHECK_EQ( sntpex_client_set_server_address( &xg_client, &xAddress.sa ), SNTPEX_SUCCESS );
+
+  return pxServer;
+}
+
+/* Offset of the sample of a timestamp list against the ground truth of the simulation */
+static int64_t prv_offset_error( const struct xTimestampCtx_t * pxCtx, const struct xSntpMockServer_t * pxServer )
+{
+  struct xSntpSample_t xSample;
+
+  if( sntpex_sample_compute( pxCtx, &xSample ) != SNTPEX_SUCCESS )
+  {
+    return INT64_MAX;
+  }
+
+  return xSample.offset - sntpex_mock_true_offset( pxServer );
+}
+
+static void test_sync_blocking( void )
+{
+  struct xTimestampCtx_t     xCtx;
+  struct xSntpMockServer_t * pxServer = prv_client_setup( 1 );
+
+  /* Local clock 1.2 s late, server 250 ms ahead of the true time, 500 us of jitter each way */
+  sntpex_mock_clock_set( -1200000, 0 );
+  pxServer->offsetUs     = 250000;
+  pxServer->jitterUs     = 500u;
+  pxServer->processingUs = 200u;
+
+  CHECK_EQ( sntpex_client_timestamp_get( &xg_client, &xCtx ), SNTPEX_SUCCESS );
+  CHECK_NEAR( prv_offset_error( &xCtx, pxServer ), 0, 500 );
+  CHECK_EQ( sntpex_client_rx_timestamp_source_get( &xg_client ), SNTPEX_TS_SOURCE_DRIVER );
+  CHECK_EQ( pxServer->replies, 1 );
+
+  /* Asymmetric path, half of the asymmetry biases the offset */
+  pxServer->jitterUs    = 0u;
+  pxServer->asymmetryUs = 4000u;
+  CHECK_EQ( sntpex_client_timestamp_get( &xg_client, &xCtx ), SNTPEX_SUCCESS );
+  CHECK_NEAR( prv_offset_error( &xCtx, pxServer ), -2000, 10 );
+
+  sntpex_client_deinitialization( &xg_client );
+}
+
+static void test_sync_failures( void )
+{
+  struct xTimestampCtx_t     xCtx;
+  struct xSntpMockServer_t * pxServer = prv_client_setup( 2 );
+
+  /* Every request is lost */
+  pxServer->lossPermille = 1000u;
+  CHECK_EQ( sntpex_client_timestamp_get( &xg_client, &xCtx ), SNTPEX_ERR_TIMEOUT );
+  CHECK_EQ( pxServer->replies, 0 );
+
+  /* Kiss-of-Death */
+  pxServer->lossPermille = 0u;
+  pxServer->kissCode     = exlibSNTP_KOD_RATE;
+  CHECK_EQ( sntpex_client_timestamp_get( &xg_client, &xCtx ), SNTPEX_ERR_REQUEST_REJECTED );
+  CHECK_EQ( sntpex_client_Kiss_code_get( &xg_client ), exlibSNTP_KOD_RATE );
+
+  /* Unsynchronized server */
+  pxServer->kissCode = 0u;
+  pxServer->stratum  = 16u;
+  CHECK_EQ( sntpex_client_timestamp_get( &xg_client, &xCtx ), SNTPEX_ERR_UNSYNCHRONIZED );
+  pxServer->stratum  = 2u;
+  pxServer->li       = specNTP_LI_ALARM;
+  CHECK_EQ( sntpex_client_timestamp_get( &xg_client, &xCtx ), SNTPEX_ERR_UNSYNCHRONIZED );
+
+  /* Back to normal */
+  pxServer->li = specNTP_LI_NO_WARNING;
+  CHECK_EQ( sntpex_client_timestamp_get( &xg_client, &xCtx ), SNTPEX_SUCCESS );
+
+  sntpex_client_deinitialization( &xg_client );
+}
+
+#if ( exlibSNTP_CONFIG_NONBLOCKING_TIMEOUT == 1 )
+static void test_sync_busy_socket( void )
+{
+  struct xTimestampCtx_t     xCtx;
+  struct xSntpMockServer_t * pxServer = prv_client_setup( 3 );
+
+  /* The send is refused a few times, the request goes out once the socket is free */
+  sntpex_mock_busy_set( 5u );
+  CHECK_EQ( sntpex_client_timestamp_get( &xg_client, &xCtx ), SNTPEX_SUCCESS );
+  CHECK_EQ( sntpex_mock_stats_get()->busy, 5 );
+  CHECK_NEAR( prv_offset_error( &xCtx, pxServer ), 0, 10 );
+
+  sntpex_client_deinitialization( &xg_client );
+}
+#endif
+
+static void test_sync_step( void )
+{
+  struct xTimestampCtx_t     xCtx;
+  struct xSntpMockServer_t * pxServer = prv_client_setup( 4 );
+  sntp_ud_t                  xStatus;
+  uint32_t                   ulSteps  = 0;
+
+  pxServer->offsetUs = -50000;
+
+  /* One transition per call, the application runs between the calls */
+  do
+  {
+    xStatus = sntpex_client_step( &xg_client, &xCtx );
+    sntpex_mock_advance( 1000u );
+    ulSteps++;
+  }
+  while( ( xStatus == SNTPEX_PENDING ) && ( ulSteps < 10000u ) );
+
+  CHECK_EQ( xStatus, SNTPEX_SUCCESS );
+  CHECK( ulSteps > 1u );
+
+  /* The reply waits in the socket up to 1 ms before the next step reads it */
+  CHECK_NEAR( prv_offset_error( &xCtx, pxServer ), 0, 10 );
+
+  sntpex_client_deinitialization( &xg_client );
+}
+
+static void test_sync_burst( void )
+{
+  struct xTimestampCtx_t     xCtx;
+  struct xSntpMockServer_t * pxServer = prv_client_setup( 5 );
+  struct xSntpSample_t       xSample;
+  uint64_t                   ullStart = sntpex_mock_true_time();
+
+  pxServer->jitterUs = 5000u;
+
+  CHECK_EQ( sntpex_client_burst_timestamp_get( &xg_client, &xCtx, 4, 100u ), SNTPEX_SUCCESS );
+  CHECK_EQ( pxServer->replies, 4 );
+
+  /* Three spacings at least */
+  CHECK( ( sntpex_mock_true_time() - ullStart ) >= 300000u );
+
+  /* The lowest-delay sample of the burst is the filtered one */
+  CHECK_EQ( sntpex_client_clock_offset_get( &xg_client, &xSample ), SNTPEX_SUCCESS );
+  CHECK_NEAR( xSample.offset - sntpex_mock_true_offset( pxServer ), 0, 2500 );
+
+  sntpex_client_deinitialization( &xg_client );
+}
+
+static void test_sync_spawn( void )
+{
+  struct xTimestampCtx_t     xCtx;
+  struct xSntpMockServer_t * pxServer = prv_client_setup( 6 );
+
+  /* No driver timestamps, the Spawn task reports the events 20 us late */
+  sntpex_mock_timestamp_mode_set( SNTPEX_MOCK_TS_SPAWN, sntpex_eventTriggingFromISR, 20u );
+
+  CHECK_EQ( sntpex_client_timestamp_get( &xg_client, &xCtx ), SNTPEX_SUCCESS );
+  CHECK_EQ( sntpex_client_rx_timestamp_source_get( &xg_client ), SNTPEX_TS_SOURCE_SPAWN );
+  CHECK_NEAR( prv_offset_error( &xCtx, pxServer ), 0, 50 );
+
+  sntpex_client_deinitialization( &xg_client );
+}
+
+/* No source captured the reception, T4 is the local time read after the reception */
+static void test_sync_local_timestamp( void )
+{
+  struct xTimestampCtx_t     xCtx;
+  struct xSntpMockServer_t * pxServer = prv_client_setup( 11 );
+
+  sntpex_mock_timestamp_mode_set( SNTPEX_MOCK_TS_SPAWN, NULL, 0u );
+
+  CHECK_EQ( sntpex_client_timestamp_get( &xg_client, &xCtx ), SNTPEX_SUCCESS );
+  CHECK_EQ( sntpex_client_rx_timestamp_source_get( &xg_client ), SNTPEX_TS_SOURCE_LOCAL );
+  CHECK_NEAR( prv_offset_error( &xCtx, pxServer ), 0, 1000 );
+
+  sntpex_client_deinitialization( &xg_client );
+}
+
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+static void test_sync_multi_server( void )
+{
+  struct xTimestampCtx_t     axCtx[ exlibSNTP_CLIENT_MAX_SERVERS ];
+  sntp_ud_t                  axStatus[ exlibSNTP_CLIENT_MAX_SERVERS ];
+  struct xSntpMockServer_t * apxServer[ 3 ];
+  struct xSntpSample_t       xSample;
+  sntpex_sockaddr_t          xAddress;
+  uint8_t                    ucIndex;
+
+  apxServer[ 0 ] = prv_client_setup( 7 );
+  apxServer[ 1 ] = sntpex_mock_server_add_v4( 0x0A000002u );
+  apxServer[ 2 ] = sntpex_mock_server_add_v4( 0x0A000003u );
+
+  /* Two truechimers a few ms apart, one falseticker 5 s ahead */
+  apxServer[ 0 ]->offsetUs  = 1000;
+  apxServer[ 1 ]->latencyUs = 20000u;
+  apxServer[ 1 ]->offsetUs  = 3000;
+  apxServer[ 2 ]->latencyUs = 5000u;
+  apxServer[ 2 ]->offsetUs  = 5000000;
+
+  for( ucIndex = 1; ucIndex < 3u; ucIndex++ )
+  {
+    sntpex_mock_server_sockaddr( apxServer[ ucIndex ], &xAddress );
+    CHECK_EQ( sntpex_client_add_server_address( &xg_client, &xAddress.sa ), SNTPEX_SUCCESS );
+  }
+
+  CHECK_EQ( sntpex_client_multi_timestamp_get( &xg_client, axCtx, axStatus ), SNTPEX_SUCCESS );
+
+  for( ucIndex = 0; ucIndex < 3u; ucIndex++ )
+  {
+    CHECK_EQ( axStatus[ ucIndex ], SNTPEX_SUCCESS );
+    CHECK_NEAR( prv_offset_error( &axCtx[ ucIndex ], apxServer[ ucIndex ] ), 0, 10 );
+  }
+
+  /* The falseticker is dropped, the combined offset lies between the truechimers */
+  CHECK_EQ( sntpex_client_clock_offset_get( &xg_client, &xSample ), SNTPEX_SUCCESS );
+  CHECK( xSample.offset >= sntpex_mock_true_offset( apxServer[ 0 ] ) - 10 );
+  CHECK( xSample.offset <= sntpex_mock_true_offset( apxServer[ 1 ] ) + 10 );
+
+  /* Two falsetickers apart from each other, no majority : the round is discarded and the poll not adapted */
+  {
+    struct xSntpSample_t xBefore;
+#if ( exlibSNTP_CONFIG_FILTER == 1 )
+    uint8_t              ucFilterHead = xg_client.xFilter.head;
+#endif
+
+    CHECK_EQ( sntpex_client_clock_offset_get( &xg_client, &xBefore ), SNTPEX_SUCCESS );
+
+    apxServer[ 1 ]->offsetUs = -5000000;
+
+    CHECK_EQ( sntpex_client_multi_timestamp_get( &xg_client, axCtx, axStatus ), SNTPEX_ERROR );
+
+    for( ucIndex = 0; ucIndex < 3u; ucIndex++ )
+    {
+      CHECK_EQ( axStatus[ ucIndex ], SNTPEX_SUCCESS );
+    }
+
+#if ( exlibSNTP_CONFIG_FILTER == 1 )
+    CHECK_EQ( xg_client.xFilter.head, ucFilterHead );
+#endif
+    CHECK_EQ( sntpex_client_clock_offset_get( &xg_client, &xSample ), SNTPEX_SUCCESS );
+    CHECK_EQ( xSample.offset, xBefore.offset );
+#if ( exlibSNTP_CONFIG_POLL == 1 )
+    CHECK_EQ( xg_client.xPoll.interval, ( 1u << xg_client.xPoll.minExponent ) * 1000u );
+#endif
+
+    apxServer[ 1 ]->offsetUs = 3000;
+  }
+
+  /* A lost server does not fail the query, the two remaining servers agree */
+  apxServer[ 1 ]->lossPermille = 1000u;
+  apxServer[ 2 ]->offsetUs     = 2000;
+  CHECK_EQ( sntpex_client_multi_timestamp_get( &xg_client, axCtx, axStatus ), SNTPEX_SUCCESS );
+  CHECK_EQ( axStatus[ 0 ], SNTPEX_SUCCESS );
+  CHECK( axStatus[ 1 ] != SNTPEX_SUCCESS );
+
+  /* A request started by a step is not replaced by the query, the step completes it */
+  apxServer[ 1 ]->lossPermille = 0u;
+  {
+    struct xTimestampCtx_t xStepCtx;
+    sntp_ud_t              xStatus;
+    uint32_t               ulSteps = 0;
+
+    CHECK_EQ( sntpex_client_step( &xg_client, &xStepCtx ), SNTPEX_PENDING );
+    CHECK_EQ( sntpex_client_multi_timestamp_get( &xg_client, axCtx, axStatus ), SNTPEX_ERR_FAULT_INIT );
+
+    do
+    {
+      xStatus = sntpex_client_step( &xg_client, &xStepCtx );
+      sntpex_mock_advance( 1000u );
+      ulSteps++;
+    }
+    while( ( xStatus == SNTPEX_PENDING ) && ( ulSteps < 10000u ) );
+
+    CHECK_EQ( xStatus, SNTPEX_SUCCESS );
+    CHECK_NEAR( prv_offset_error( &xStepCtx, apxServer[ 0 ] ), 0, 10 );
+  }
+
+#if ( exlibSNTP_CONFIG_POLL == 1 )
+  /* Every server rejects the requests, the strongest kiss code schedules the next poll */
+  apxServer[ 0 ]->kissCode     = exlibSNTP_KOD_RATE;
+  apxServer[ 1 ]->lossPermille = 0u;
+  apxServer[ 1 ]->kissCode     = exlibSNTP_KOD_DENY;
+  apxServer[ 2 ]->kissCode     = exlibSNTP_KOD_RATE;
+  CHECK_EQ( sntpex_client_multi_timestamp_get( &xg_client, axCtx, axStatus ), SNTPEX_ERR_REQUEST_REJECTED );
+  CHECK_EQ( xg_client.xPoll.exponent, xg_client.xPoll.maxExponent );
+  CHECK_EQ( xg_client.xPoll.backoff, 1 );
+#endif
+
+  sntpex_client_deinitialization( &xg_client );
+}
+#endif
+
+/* A live client initialized again releases its socket and its Spawn slot first */
+static void test_sync_reinit( void )
+{
+  struct xTimestampCtx_t xCtx;
+  sntpex_sockaddr_t      xAddress;
+  uint32_t               ulIndex;
+
+  struct xSntpMockServer_t * pxServer = prv_client_setup( 10 );
+
+  sntpex_mock_server_sockaddr( pxServer, &xAddress );
+
+  for( ulIndex = 0; ulIndex < ( 2u * SNTPEX_MOCK_MAX_SOCKETS ); ulIndex++ )
+  {
+    /* The socket of the previous request is kept opened */
+    CHECK_EQ( sntpex_client_timestamp_get( &xg_client, &xCtx ), SNTPEX_SUCCESS );
+    CHECK_EQ( sntpex_clientInitialization( &xg_client, &xg_vtable ), SNTPEX_SUCCESS );
+    CHECK_EQ( sntpex_client_set_server_address( &xg_client, &xAddress.sa ), SNTPEX_SUCCESS );
+  }
+
+  CHECK_EQ( pxServer->replies, 2u * SNTPEX_MOCK_MAX_SOCKETS );
+
+  sntpex_client_deinitialization( &xg_client );
+}
+
+static void test_sync_server_name( void )
+{
+  struct xTimestampCtx_t xCtx;
+
+  ( void )prv_client_setup( 8 );
+
+  CHECK_EQ( sntpex_client_set_server_name( &xg_client, "pool.ntp.org", SLNETSOCK_AF_INET ), SNTPEX_SUCCESS );
+  CHECK_EQ( sntpex_mock_stats_get()->dns, 1 );
+  CHECK_EQ( sntpex_client_timestamp_get( &xg_client, &xCtx ), SNTPEX_SUCCESS );
+
+  /* The name is resolved again, or taken from the names cache */
+  CHECK_EQ( sntpex_client_set_server_name( &xg_client, "pool.ntp.org", SLNETSOCK_AF_INET ), SNTPEX_SUCCESS );
+  CHECK_EQ( sntpex_mock_stats_get()->dns, ( exlibSNTP_CONFIG_DNS_CACHE == 1 ) ? 1 : 2 );
+
+#if ( exlibSNTP_CONFIG_IPV6 == 1 )
+  /* No server of this family */
+  CHECK_EQ( sntpex_client_set_server_name( &xg_client, "pool.ntp.org", SLNETSOCK_AF_INET6 ), SNTPEX_ERR_DNS_RESOLVE );
+#endif
+
+  sntpex_client_deinitialization( &xg_client );
+}
+
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 1 )
+static void test_sync_discipline( void )
+{
+  struct xTimestampCtx_t     xCtx;
+  struct xSntpMockServer_t * pxServer = prv_client_setup( 9 );
+  uint64_t                   ullTime  = 0;
+  uint32_t                   ulIndex;
+
+  /* Local clock 300 ms late and 20 ppm slow */
+  sntpex_mock_clock_set( -300000, -20000 );
+  pxServer->jitterUs = 50u;
+
+  CHECK_EQ( sntpex_client_time_get( &xg_client, &ullTime ), SNTPEX_ERROR );
+
+  for( ulIndex = 0; ulIndex < 16u; ulIndex++ )
+  {
+    ( void )sntpex_client_timestamp_get( &xg_client, &xCtx );
+    sntpex_mock_advance( 64000000u );
+  }
+
+  /* 64 s after the last sample, the frequency error is corrected */
+  CHECK_EQ( sntpex_client_time_get( &xg_client, &ullTime ), SNTPEX_SUCCESS );
+  CHECK_NEAR( ( int64_t )( ullTime - sntpex_mock_true_time() ), 0, 1000 );
+  CHECK_NEAR( sntpex_client_frequency_get( &xg_client ), 20000, 2000 );
+
+  sntpex_client_deinitialization( &xg_client );
+}
+#endif
+
+/* Exported function   ------------------------------------------------------------*/
+
+int main( void )
+{
+  RUN( test_sync_blocking );
+  RUN( test_sync_failures );
+#if ( exlibSNTP_CONFIG_NONBLOCKING_TIMEOUT == 1 )
+  RUN( test_sync_busy_socket );
+#endif
+  RUN( test_sync_step );
+  RUN( test_sync_burst );
+  RUN( test_sync_spawn );
+  RUN( test_sync_local_timestamp );
+#if ( exlibSNTP_CONFIG_MULTI_SERVER == 1 )
+  RUN( test_sync_multi_server );
+#endif
+  RUN( test_sync_reinit );
+  RUN( test_sync_server_name );
+#if ( exlibSNTP_CONFIG_DISCIPLINE == 1 )
+  RUN( test_sync_discipline );
+#endif
+
+  return TEST_RESULT();
+}
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
@@ -0,0 +1,111 @@
+/**
+ * @file    sntpex_ti/tests/test_timer.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Host tests of the timer wheel and of the 64-bit os tick extension.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Oct 14, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntpex_test.h"
+
+/* Private function   ------------------------------------------------------------*/
+
+static void test_tick64_wrap( void )
+{
+  struct xSntpTick64_t xTick = { 0, };
+
+  CHECK_EQ( sntpex_tick64_update( &xTick, 0xFFFFFF00u ), 0xFFFFFF00ull );
+  CHECK_EQ( sntpex_tick64_update( &xTick, 0x00000010u ), 0x100000010ull );
+  CHECK_EQ( sntpex_tick64_update( &xTick, 0x00000020u ), 0x100000020ull );
+  CHECK_EQ( sntpex_tick64_update( NULL, 0x00000020u ), 0 );
+}
+
+static void test_timer_expiry_order( void )
+{
+  struct xSntpTimerWheel_t xWheel;
+  struct xSntpTimer_t      axTimer[ 3 ];
+
+  ( void )memset( axTimer, 0, sizeof( axTimer ) );
+  ( void )sntpex_timer_wheel_init( &xWheel, 0 );
+
+  /* The third deadline is one revolution later, on the slot of the second one */
+  CHECK_EQ( sntpex_timer_arm( &xWheel, &axTimer[ 0 ], 100 ), SNTPEX_SUCCESS );
+  CHECK_EQ( sntpex_timer_arm( &xWheel, &axTimer[ 1 ], 1000 ), SNTPEX_SUCCESS );
+  CHECK_EQ( sntpex_timer_arm( &xWheel, &axTimer[ 2 ], 1000 + ( exlibSNTP_WHEEL_SLOTS << exlibSNTP_WHEEL_SLOT_SHIFT ) ), SNTPEX_SUCCESS );
+  CHECK_EQ( xWheel.armedCount, 3 );
+
+  CHECK( sntpex_timer_expire( &xWheel, 99 ) == NULL );
+  CHECK( sntpex_timer_expire( &xWheel, 1100 ) == &axTimer[ 0 ] );
+  CHECK( sntpex_timer_expire( &xWheel, 1100 ) == &axTimer[ 1 ] );
+  CHECK( sntpex_timer_expire( &xWheel, 1100 ) == NULL );
+  CHECK_EQ( axTimer[ 0 ].armed, 0 );
+  CHECK_EQ( axTimer[ 2 ].armed, 1 );
+
+  CHECK( sntpex_timer_expire( &xWheel, axTimer[ 2 ].deadline ) == &axTimer[ 2 ] );
+  CHECK_EQ( xWheel.armedCount, 0 );
+}
+
+static void test_timer_disarm_and_rearm( void )
+{
+  struct xSntpTimerWheel_t xWheel;
+  struct xSntpTimer_t      axTimer[ 2 ];
+
+  ( void )memset( axTimer, 0, sizeof( axTimer ) );
+  ( void )sntpex_timer_wheel_init( &xWheel, 5000 );
+
+  ( void )sntpex_timer_arm( &xWheel, &axTimer[ 0 ], 6000 );
+  ( void )sntpex_timer_arm( &xWheel, &axTimer[ 1 ], 6010 );
+
+  /* Disarmed timers never expire, disarming twice is harmless */
+  sntpex_timer_disarm( &xWheel, &axTimer[ 0 ] );
+  sntpex_timer_disarm( &xWheel, &axTimer[ 0 ] );
+  CHECK_EQ( xWheel.armedCount, 1 );
+
+  /* Arming an armed timer moves it, an elapsed deadline expires on the next call */
+  ( void )sntpex_timer_arm( &xWheel, &axTimer[ 1 ], 4000 );
+  CHECK_EQ( xWheel.armedCount, 1 );
+  CHECK( sntpex_timer_expire( &xWheel, 5001 ) == &axTimer[ 1 ] );
+  CHECK( sntpex_timer_expire( &xWheel, 10000 ) == NULL );
+}
+
+static void test_timer_wait( void )
+{
+  struct xSntpTimerWheel_t xWheel;
+  struct xSntpTimer_t      xTimer = { 0, };
+
+  ( void )sntpex_timer_wheel_init( &xWheel, 0 );
+
+  CHECK_EQ( sntpex_timer_wait_get( &xWheel, 0 ), 0xFFFFFFFFu );
+
+  ( void )sntpex_timer_arm( &xWheel, &xTimer, 3000 );
+  CHECK_EQ( sntpex_timer_wait_get( &xWheel, 1000 ), 2000 );
+  CHECK_EQ( sntpex_timer_wait_get( &xWheel, 3000 ), 0 );
+  CHECK_EQ( sntpex_timer_wait_get( &xWheel, 9000 ), 0 );
+
+  /* Many revolutions late, the timer still expires once */
+  CHECK( sntpex_timer_expire( &xWheel, 1000000 ) == &xTimer );
+  CHECK( sntpex_timer_expire( &xWheel, 1000000 ) == NULL );
+  CHECK_EQ( sntpex_timer_wait_get( &xWheel, 1000000 ), 0xFFFFFFFFu );
+}
+
+/* Exported function   ------------------------------------------------------------*/
+
+int main( void )
+{
+  RUN( test_tick64_wrap );
+  RUN( test_timer_expiry_order );
+  RUN( test_timer_disarm_and_rearm );
+  RUN( test_timer_wait );
+
+  return TEST_RESULT();
+}
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/
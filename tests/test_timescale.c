@@ -0,0 +1,144 @@
+/**
+ * @file    sntpex_ti/tests/test_timescale.c
+ *          This file is part of sntpex_ti.
+ *
+ * @section License
+ * @par     COPYRIGHT NOTICE: (c) 2026 Ridha MASTOURI
+ *
+ * @brief   Host tests of the leap seconds table and of the UTC / TAI / GPS conversions.
+ *
+ * @version V1.0.0
+ *
+ * @date    Created on :Oct 14, 2026
+ * @author  Ridha MASTOURI
+ */
+
+/* Includes ----------------------------------------------------------------------*/
+#include "sntpex_test.h"
+
+/* Private macros ----------------------------------------------------------------*/
+#define TEST_US                 ( 1000000ull )
+#define TEST_2026_06_15         ( 1781481600u )
+#define TEST_2026_07_01         ( 1782864000u )
+#define TEST_2027_01_01         ( 1798761600u )
+#define TEST_GPS_EPOCH_TAI_US   ( ( 315964800ull + 19u ) * TEST_US )
+
+/* Private function   ------------------------------------------------------------*/
+
+static void test_timescale_offsets( void )
+{
+  struct xSntpTimescale_t xTimescale;
+  uint64_t                ullClock = SNTPEX_MOCK_START_TIME + 250000u;
+  uint64_t                ullTime  = 0;
+
+  CHECK_EQ( sntpex_timescale_init( &xTimescale, 2 ), SNTPEX_ERROR );
+  CHECK_EQ( sntpex_timescale_init( &xTimescale, SNTPEX_LEAP_STEP ), SNTPEX_SUCCESS );
+  CHECK_EQ( xTimescale.count, 28 );
+  CHECK_EQ( xTimescale.entry[ xTimescale.index ].taiOffset, 37 );
+
+  /* TAI - UTC = 37 s, GPS = TAI - 19 s from the GPS epoch */
+  CHECK_EQ( sntpex_timescale_from_clock( &xTimescale, ullClock, SNTPEX_TIMESCALE_UTC ), ullClock );
+  CHECK_EQ( sntpex_timescale_from_clock( &xTimescale, ullClock, SNTPEX_TIMESCALE_TAI ), ullClock + 37u * TEST_US );
+  CHECK_EQ( sntpex_timescale_from_clock( &xTimescale, ullClock, SNTPEX_TIMESCALE_GPS ),
+            ullClock + 37u * TEST_US - TEST_GPS_EPOCH_TAI_US );
+
+  CHECK_EQ( sntpex_timescale_convert( &xTimescale, SNTPEX_TIMESCALE_UTC, SNTPEX_TIMESCALE_GPS, ullClock, &ullTime ), SNTPEX_SUCCESS );
+  CHECK_EQ( ullTime, ullClock + 18u * TEST_US - 315964800ull * TEST_US );
+  CHECK_EQ( sntpex_timescale_convert( &xTimescale, SNTPEX_TIMESCALE_GPS, SNTPEX_TIMESCALE_UTC, ullTime, &ullTime ), SNTPEX_SUCCESS );
+  CHECK_EQ( ullTime, ullClock );
+
+  /* Past timestamps use the offset of their time, 10 s in 1972 */
+  CHECK_EQ( sntpex_timescale_convert( &xTimescale, SNTPEX_TIMESCALE_UTC, SNTPEX_TIMESCALE_TAI, 70000000ull * TEST_US, &ullTime ), SNTPEX_SUCCESS );
+  CHECK_EQ( ullTime, ( 70000000ull + 10u ) * TEST_US );
+
+  /* No GPS time before the GPS epoch */
+  CHECK_EQ( sntpex_timescale_convert( &xTimescale, SNTPEX_TIMESCALE_TAI, SNTPEX_TIMESCALE_GPS, TEST_US, &ullTime ), SNTPEX_ERROR );
+}
+
+static void test_timescale_leap_step( void )
+{
+  struct xSntpTimescale_t xTimescale;
+  uint64_t                ullSwitch = ( uint64_t )TEST_2027_01_01 * TEST_US;
+  int64_t                 llShift   = 0;
+
+  ( void )sntpex_timescale_init( &xTimescale, SNTPEX_LEAP_STEP );
+
+  /* Only one second per leap */
+  CHECK_EQ( sntpex_timescale_leap_add( &xTimescale, TEST_2027_01_01, 39 ), SNTPEX_ERROR );
+  CHECK_EQ( sntpex_timescale_leap_add( &xTimescale, TEST_2027_01_01, 38 ), SNTPEX_SUCCESS );
+  CHECK_EQ( xTimescale.nextDelta, 1 );
+
+  /* The UTC time repeats the last second until the clock is folded */
+  CHECK_EQ( sntpex_timescale_from_clock( &xTimescale, ullSwitch - 1u, SNTPEX_TIMESCALE_UTC ), ullSwitch - 1u );
+  CHECK_EQ( sntpex_timescale_from_clock( &xTimescale, ullSwitch + 500000u, SNTPEX_TIMESCALE_UTC ), ullSwitch + 500000u - TEST_US );
+  CHECK_EQ( sntpex_timescale_from_clock( &xTimescale, ullSwitch + 500000u, SNTPEX_TIMESCALE_TAI ), ullSwitch + 500000u + 37u * TEST_US );
+
+  /* The fold moves the clock on the new entry, the TAI time is continuous */
+  CHECK_EQ( sntpex_timescale_leap_fold( &xTimescale, ullSwitch - 1u, &llShift ), SNTPEX_SUCCESS );
+  CHECK_EQ( llShift, 0 );
+  CHECK_EQ( sntpex_timescale_leap_fold( &xTimescale, ullSwitch + 500000u, &llShift ), SNTPEX_SUCCESS );
+  CHECK_EQ( llShift, -( int64_t )TEST_US );
+  CHECK_EQ( xTimescale.entry[ xTimescale.index ].taiOffset, 38 );
+  CHECK_EQ( sntpex_timescale_from_clock( &xTimescale, ullSwitch - 500000u, SNTPEX_TIMESCALE_TAI ), ullSwitch + 500000u + 37u * TEST_US );
+}
+
+static void test_timescale_leap_smear( void )
+{
+  struct xSntpTimescale_t xTimescale;
+  uint64_t                ullSwitch = ( uint64_t )TEST_2027_01_01 * TEST_US;
+  uint64_t                ullWindow = ( uint64_t )exlibSNTP_LEAP_SMEAR_WINDOW * TEST_US;
+
+  ( void )sntpex_timescale_init( &xTimescale, SNTPEX_LEAP_SMEAR );
+  ( void )sntpex_timescale_leap_add( &xTimescale, TEST_2027_01_01, 38 );
+
+  /* Before the window, in the middle of the window, then the whole second on the leap */
+  CHECK_EQ( sntpex_timescale_from_clock( &xTimescale, ullSwitch - ullWindow, SNTPEX_TIMESCALE_UTC ), ullSwitch - ullWindow );
+  CHECK_EQ( sntpex_timescale_from_clock( &xTimescale, ullSwitch - ( ullWindow / 2u ), SNTPEX_TIMESCALE_UTC ),
+            ullSwitch - ( ullWindow / 2u ) - 500000u );
+  CHECK_EQ( sntpex_timescale_from_clock( &xTimescale, ullSwitch, SNTPEX_TIMESCALE_UTC ), ullSwitch - TEST_US );
+
+  /* 10^6 / W us of correction per elapsed second */
+  uint64_t ullLate = ullSwitch - ( ullWindow / 2u ) + 1000u * TEST_US;
+
+  CHECK_NEAR( sntpex_timescale_from_clock( &xTimescale, ullLate, SNTPEX_TIMESCALE_UTC ),
+              ullLate - 500000u - ( 1000u * TEST_US ) / exlibSNTP_LEAP_SMEAR_WINDOW, 1 );
+}
+
+static void test_timescale_announcement( void )
+{
+  struct xSntpTimescale_t xTimescale;
+  uint64_t                ullClock = ( uint64_t )TEST_2026_06_15 * TEST_US;
+
+  ( void )sntpex_timescale_init( &xTimescale, SNTPEX_LEAP_STEP );
+
+  /* An inserted second announced in June takes place at the end of the month */
+  CHECK_EQ( sntpex_timescale_update( &xTimescale, specNTP_LI_LAST_MIN_61, ullClock ), SNTPEX_SUCCESS );
+  CHECK_EQ( xTimescale.count, 29 );
+  CHECK_EQ( xTimescale.announced, 1 );
+  CHECK_EQ( xTimescale.entry[ 28 ].utc, TEST_2026_07_01 );
+  CHECK_EQ( xTimescale.entry[ 28 ].taiOffset, 38 );
+  CHECK_EQ( xTimescale.nextSwitch, ( uint64_t )TEST_2026_07_01 * TEST_US );
+
+  /* Repeated announcements keep one entry */
+  ( void )sntpex_timescale_update( &xTimescale, specNTP_LI_LAST_MIN_61, ullClock + TEST_US );
+  CHECK_EQ( xTimescale.count, 29 );
+
+  /* Withdrawn by the servers */
+  ( void )sntpex_timescale_update( &xTimescale, specNTP_LI_NO_WARNING, ullClock + 2u * TEST_US );
+  CHECK_EQ( xTimescale.count, 28 );
+  CHECK_EQ( xTimescale.nextDelta, 0 );
+}
+
+/* Exported function   ------------------------------------------------------------*/
+
+int main( void )
+{
+  RUN( test_timescale_offsets );
+  RUN( test_timescale_leap_step );
+  RUN( test_timescale_leap_smear );
+  RUN( test_timescale_announcement );
+
+  return TEST_RESULT();
+}
+
+/************************ (C) COPYRIGHT RIDHA MASTOURI *****END OF FILE*****************/